@@ -8,11 +8,26 @@
 #include "Android/GameActivity.h"
 #include "Android/LocalAssociationScenario.h"
 #include "Android/MobileWalletAdapterClient.h"
+#include "Async/Async.h"
 
 #if PLATFORM_ANDROID
 #include "Android/AndroidApplication.h"
 #endif
 
+UWalletAdapterClient::FAuthorizedDelegate UWalletAdapterClient::OnAuthorized;
+
+void UWalletAdapterClient::BroadcastAuthorized()
+{
+	// The futures complete on a worker, listeners add and remove themselves on the game thread.
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UWalletAdapterClient>(this)]
+	{
+		if (UWalletAdapterClient* AuthorizedClient = WeakThis.Get())
+		{
+			OnAuthorized.Broadcast(AuthorizedClient);
+		}
+	});
+}
+
 #if PLATFORM_ANDROID
 
 FSignedMessage::FSignedMessage(const FSignedMessageWrapper& SignedMessage)
@@ -66,6 +81,7 @@ void UWalletAdapterClient::Authorize(FString IdentityUri, FString IconUri, FStri
 		AccountLabel = AuthResult->GetAccountLabel();
 		WalletUriBase = AuthResult->GetWalletUriBase();
 		
+		BroadcastAuthorized();
 		Success.ExecuteIfBound(AuthToken);
 	});;
 #else
@@ -109,6 +125,7 @@ void UWalletAdapterClient::Reauthorize(FString IdentityUri, FString IconUri, FSt
 		AccountLabel = AuthResult->GetAccountLabel();
 		WalletUriBase = AuthResult->GetWalletUriBase();
 			
+		BroadcastAuthorized();
 		Success.ExecuteIfBound(AuthToken);
 	});
 #else
@@ -76,6 +76,7 @@ public:
 	DECLARE_DELEGATE_OneParam(FSignSuccessDelegate, const TArray<FByteArray>& Transactions);
 	DECLARE_DELEGATE_OneParam(FSignMessagesSuccessDelegate, const TArray<FSignedMessage>& SignedMessages);
 	DECLARE_DELEGATE_OneParam(FFailureDelegate, const FString& ErrorMessage);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FAuthorizedDelegate, UWalletAdapterClient* Client);
 
 	DECLARE_DYNAMIC_DELEGATE(FSuccessDynDelegate);
 	DECLARE_DYNAMIC_DELEGATE_OneParam(FAuthSuccessDynDelegate, const FString&, AuthToken);
@@ -117,6 +118,10 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="SignMessagesDetached", ScriptName="SignMessagesDetached"), Category="Solana")
 	void K2_SignMessagesDetached(const TArray<FByteArray>& Messages, const TArray<FByteArray>& Addresses, const FSignMessagesSuccessDynDelegate& Success, const FFailureDynDelegate& Failure);	
 
+public:
+	/** Broadcast on the game thread when Authorize or Reauthorize succeeds, after PublicKey is set. */
+	static FAuthorizedDelegate OnAuthorized;
+
 public:
 	UPROPERTY(BlueprintReadOnly)
 	FString AuthToken;
@@ -128,6 +133,8 @@ public:
 	FString WalletUriBase;
 	
 protected:
+	void BroadcastAuthorized();
+
 #if PLATFORM_ANDROID
 	TSharedPtr<FMobileWalletAdapterClient> Client;
 #endif
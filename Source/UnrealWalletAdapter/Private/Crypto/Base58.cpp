@@ -17,9 +17,11 @@ Author: Jon Sawler
 */
 
 #include "Crypto/Base58.h"
-#include "Math/BigInt.h"
+#include "Crypto/CpuFeatures.h"
+#include "Crypto/CryptoDispatch.h"
+#include "Misc/AutomationTest.h"
 
-const char ALPHABET[58] = {
+static constexpr ANSICHAR Alphabet[58] = {
 	'1', '2', '3', '4', '5', '6', '7', '8',
 	'9', 'A', 'B', 'C', 'D', 'E', 'F', 'G',
 	'H', 'J', 'K', 'L', 'M', 'N', 'P', 'Q',
@@ -30,62 +32,719 @@ const char ALPHABET[58] = {
 	'y', 'z'
 };
 
-TArray<uint8> FBase58::EncodeBase58(const TArray<uint8>& Data)
+struct FDigitTable
 {
-	TBigInt<1024> IntData = 0;
-	for (int32 I = 0; I < Data.Num(); I++)
+	int8 Values[256];
+
+	constexpr FDigitTable() : Values()
 	{
-		IntData = IntData * 256 + Data[I];
+		for (int8& Value : Values)
+		{
+			Value = -1;
+		}
+		for (int32 Digit = 0; Digit < 58; Digit++)
+		{
+			Values[static_cast<uint8>(Alphabet[Digit])] = static_cast<int8>(Digit);
+		}
 	}
-	
-	TArray<uint8> Result;
-	while (IntData.IsGreater(0))
+};
+
+static constexpr FDigitTable DigitTable;
+
+// 58^5 is the largest power of 58 below 2^30, so a remainder shifted up by a 32-bit word still fits 64 bits.
+static constexpr uint32 Base58Pow5 = 656356768;
+
+// Converts a big-endian value held in 32-bit words into base58 digits, least significant first. The words
+// are consumed. Returns the number of digits without the leading zeros of the value.
+FORCEINLINE static int32 WordsToDigits(uint32* Words, int32 NumWords, uint8* Digits)
+{
+	int32 First = 0;
+	while (First < NumWords && Words[First] == 0)
+	{
+		First++;
+	}
+
+	int32 NumDigits = 0;
+	while (First < NumWords)
+	{
+		// Divide by 58^5 word by word, the remainder is the next five digits.
+		uint64 Remainder = 0;
+		for (int32 I = First; I < NumWords; I++)
+		{
+			const uint64 Value = (Remainder << 32) | Words[I];
+			Words[I] = static_cast<uint32>(Value / Base58Pow5);
+			Remainder = Value % Base58Pow5;
+		}
+
+		while (First < NumWords && Words[First] == 0)
+		{
+			First++;
+		}
+
+		for (int32 I = 0; I < 5; I++)
+		{
+			Digits[NumDigits++] = static_cast<uint8>(Remainder % 58);
+			Remainder /= 58;
+		}
+	}
+
+	while (NumDigits > 0 && Digits[NumDigits - 1] == 0)
+	{
+		NumDigits--;
+	}
+	return NumDigits;
+}
+
+FORCEINLINE static int32 WriteDigits(int32 LeadingZeros, const uint8* Digits, int32 NumDigits, ANSICHAR* Out)
+{
+	// Every leading zero byte is written as a '1'.
+	for (int32 I = 0; I < LeadingZeros; I++)
 	{
-		TBigInt<1024> Remainder = IntData % 58;
-		IntData /= 58;
-		Result.Insert(ALPHABET[Remainder.ToInt()], 0);
+		Out[I] = '1';
 	}
-	
-	for (int32 I = 0; I < Data.Num() && Data[I] == 0; I++)
+	for (int32 I = 0; I < NumDigits; I++)
 	{
-		Result.Insert('1', 0);
+		Out[LeadingZeros + I] = Alphabet[Digits[NumDigits - 1 - I]];
 	}
-	
-	return Result;	
+	return LeadingZeros + NumDigits;
+}
+
+// Accumulates base58 digits into a big-endian value held in 32-bit words. Returns false on a character
+// outside the alphabet or if the value doesn't fit.
+FORCEINLINE static bool DigitsToWords(const ANSICHAR* Encoded, int32 Length, uint32* Words, int32 NumWords)
+{
+	FMemory::Memzero(Words, NumWords * sizeof(uint32));
+
+	// Digits are taken five at a time as one base 58^5 limb, the first group takes what is left over.
+	int32 Index = 0;
+	int32 GroupLength = Length % 5 == 0 ? 5 : Length % 5;
+	while (Index < Length)
+	{
+		uint32 Limb = 0;
+		uint32 Multiplier = 1;
+		for (const int32 GroupEnd = Index + GroupLength; Index < GroupEnd; Index++)
+		{
+			const int8 Digit = DigitTable.Values[static_cast<uint8>(Encoded[Index])];
+			if (Digit < 0)
+				return false;
+
+			Limb = Limb * 58 + Digit;
+			Multiplier *= 58;
+		}
+		GroupLength = 5;
+
+		uint64 Carry = Limb;
+		for (int32 I = NumWords - 1; I >= 0; I--)
+		{
+			Carry += static_cast<uint64>(Words[I]) * Multiplier;
+			Words[I] = static_cast<uint32>(Carry);
+			Carry >>= 32;
+		}
+
+		if (Carry != 0)
+			return false;
+	}
+	return true;
+}
+
+FORCEINLINE static int32 CountLeading(const uint8* Data, int32 Num, uint8 Value)
+{
+	int32 Count = 0;
+	while (Count < Num && Data[Count] == Value)
+	{
+		Count++;
+	}
+	return Count;
+}
+
+/**
+ * Conversion tables between 32-bit words and base 58^5 limbs for a fixed width, most significant first.
+ * With them the conversion is a matrix product of independent multiplies rather than a chain of divisions.
+ */
+template<int32 NumBytes>
+struct TBase58Tables
+{
+	static constexpr int32 NumWords = NumBytes / 4;
+	static constexpr int32 NumLimbs = (FBase58::GetMaxEncodedLength(NumBytes) + 4) / 5;
+
+	// Encode[I] holds 2^(32 * (NumWords - 1 - I)) in limbs.
+	uint32 Encode[NumWords][NumLimbs];
+	// Decode[I] holds 58^(5 * (NumLimbs - 1 - I)) in words, preceded by a word that catches overflow.
+	uint32 Decode[NumLimbs][NumWords + 1];
+
+	constexpr TBase58Tables() : Encode(), Decode()
+	{
+		uint64 Limbs[NumLimbs] = {};
+		Limbs[NumLimbs - 1] = 1;
+		for (int32 I = NumWords - 1; I >= 0; I--)
+		{
+			uint64 Carry = 0;
+			for (int32 K = NumLimbs - 1; K >= 0; K--)
+			{
+				Encode[I][K] = static_cast<uint32>(Limbs[K]);
+				const uint64 Value = (Limbs[K] << 32) + Carry;
+				Limbs[K] = Value % Base58Pow5;
+				Carry = Value / Base58Pow5;
+			}
+		}
+
+		uint64 Words[NumWords + 1] = {};
+		Words[NumWords] = 1;
+		for (int32 I = NumLimbs - 1; I >= 0; I--)
+		{
+			uint64 Carry = 0;
+			for (int32 J = NumWords; J >= 0; J--)
+			{
+				Decode[I][J] = static_cast<uint32>(Words[J]);
+				const uint64 Value = Words[J] * Base58Pow5 + Carry;
+				Words[J] = Value & 0xFFFFFFFF;
+				Carry = Value >> 32;
+			}
+		}
+	}
+};
+
+// Products of a word and a limb are below 2^62, so sums are carried after every 4 of them to stay below 2^64.
+static constexpr int32 TermsPerCarry = 4;
+
+template<int32 NumBytes>
+static constexpr TBase58Tables<NumBytes> Base58Tables;
+
+template<int32 NumBytes>
+int32 FBase58::EncodeFixed(const uint8* Data, ANSICHAR* Out)
+{
+	static_assert(NumBytes % 4 == 0, "Fixed-width values must be a whole number of words.");
+	using FTables = TBase58Tables<NumBytes>;
+	constexpr const FTables& Tables = Base58Tables<NumBytes>;
+
+	uint64 Limbs[FTables::NumLimbs] = {};
+	for (int32 I = 0; I < FTables::NumWords; I++)
+	{
+		const uint64 Word = static_cast<uint32>(Data[I * 4]) << 24 | Data[I * 4 + 1] << 16 | Data[I * 4 + 2] << 8 | Data[I * 4 + 3];
+		for (int32 K = 0; K < FTables::NumLimbs; K++)
+		{
+			Limbs[K] += Word * Tables.Encode[I][K];
+		}
+
+		if (I % TermsPerCarry == TermsPerCarry - 1 || I == FTables::NumWords - 1)
+		{
+			for (int32 K = FTables::NumLimbs - 1; K > 0; K--)
+			{
+				Limbs[K - 1] += Limbs[K] / Base58Pow5;
+				Limbs[K] %= Base58Pow5;
+			}
+		}
+	}
+
+	uint8 Digits[FTables::NumLimbs * 5];
+	for (int32 K = 0; K < FTables::NumLimbs; K++)
+	{
+		uint32 Limb = static_cast<uint32>(Limbs[K]);
+		for (int32 D = 4; D >= 0; D--)
+		{
+			Digits[K * 5 + D] = static_cast<uint8>(Limb % 58);
+			Limb /= 58;
+		}
+	}
+
+	const int32 LeadingZeros = CountLeading(Data, NumBytes, 0);
+	const int32 FirstDigit = CountLeading(Digits, FTables::NumLimbs * 5, 0);
+	const int32 NumDigits = FTables::NumLimbs * 5 - FirstDigit;
+
+	for (int32 I = 0; I < LeadingZeros; I++)
+	{
+		Out[I] = '1';
+	}
+	for (int32 I = 0; I < NumDigits; I++)
+	{
+		Out[LeadingZeros + I] = Alphabet[Digits[FirstDigit + I]];
+	}
+	return LeadingZeros + NumDigits;
+}
+
+// Decodes Length digits of a fixed-width value into big-endian bytes, see AccumulateDigits for GetDigit.
+// Doesn't check the leading '1's against the leading zero bytes.
+template<int32 NumBytes, typename GetDigitType>
+FORCEINLINE static bool DecodeFixedDigits(int32 Length, GetDigitType&& GetDigit, uint8* Out)
+{
+	using FTables = TBase58Tables<NumBytes>;
+	constexpr const FTables& Tables = Base58Tables<NumBytes>;
+
+	if (Length > FTables::NumLimbs * 5)
+		return false;
+
+	// Right-align the digits, so the first limb takes the partial group.
+	uint64 Limbs[FTables::NumLimbs] = {};
+	const int32 Offset = FTables::NumLimbs * 5 - Length;
+	for (int32 I = 0; I < Length; I++)
+	{
+		const int8 Digit = GetDigit(I);
+		if (Digit < 0)
+			return false;
+
+		uint64& Limb = Limbs[(Offset + I) / 5];
+		Limb = Limb * 58 + Digit;
+	}
+
+	uint64 Words[FTables::NumWords + 1] = {};
+	for (int32 I = 0; I < FTables::NumLimbs; I++)
+	{
+		for (int32 J = 0; J <= FTables::NumWords; J++)
+		{
+			Words[J] += Limbs[I] * Tables.Decode[I][J];
+		}
+
+		if (I % TermsPerCarry == TermsPerCarry - 1 || I == FTables::NumLimbs - 1)
+		{
+			for (int32 J = FTables::NumWords; J > 0; J--)
+			{
+				Words[J - 1] += Words[J] >> 32;
+				Words[J] &= 0xFFFFFFFF;
+			}
+		}
+	}
+
+	if (Words[0] != 0)
+		return false;
+
+	for (int32 J = 0; J < FTables::NumWords; J++)
+	{
+		Out[J * 4] = static_cast<uint8>(Words[J + 1] >> 24);
+		Out[J * 4 + 1] = static_cast<uint8>(Words[J + 1] >> 16);
+		Out[J * 4 + 2] = static_cast<uint8>(Words[J + 1] >> 8);
+		Out[J * 4 + 3] = static_cast<uint8>(Words[J + 1]);
+	}
+	return true;
+}
+
+template<int32 NumBytes>
+bool FBase58::DecodeFixed(TConstArrayView<ANSICHAR> Encoded, uint8* Out)
+{
+	static_assert(NumBytes % 4 == 0, "Fixed-width values must be a whole number of words.");
+
+	const ANSICHAR* Chars = Encoded.GetData();
+	const bool bDecoded = DecodeFixedDigits<NumBytes>(Encoded.Num(), [Chars](int32 Index)
+	{
+		return DigitTable.Values[static_cast<uint8>(Chars[Index])];
+	}, Out);
+
+	// A value with fewer or more leading '1's than leading zero bytes encodes a different length.
+	return bDecoded && CountLeading(reinterpret_cast<const uint8*>(Chars), Encoded.Num(), '1') == CountLeading(Out, NumBytes, 0);
+}
+
+template int32 FBase58::EncodeFixed<32>(const uint8* Data, ANSICHAR* Out);
+template int32 FBase58::EncodeFixed<64>(const uint8* Data, ANSICHAR* Out);
+template bool FBase58::DecodeFixed<32>(TConstArrayView<ANSICHAR> Encoded, uint8* Out);
+template bool FBase58::DecodeFixed<64>(TConstArrayView<ANSICHAR> Encoded, uint8* Out);
+
+int32 FBase58::Encode(TConstArrayView<uint8> Data, ANSICHAR* Out)
+{
+	// Pad at the front up to a whole number of words, which doesn't change the value.
+	const int32 NumWords = (Data.Num() + 3) / 4;
+	const int32 Padding = NumWords * 4 - Data.Num();
+
+	TArray<uint32, TInlineAllocator<32>> Words;
+	Words.SetNumZeroed(NumWords);
+	for (int32 I = 0; I < Data.Num(); I++)
+	{
+		const int32 Position = Padding + I;
+		Words[Position / 4] |= static_cast<uint32>(Data[I]) << (24 - Position % 4 * 8);
+	}
+
+	TArray<uint8, TInlineAllocator<GetMaxEncodedLength(128) + 5>> Digits;
+	Digits.SetNumUninitialized(GetMaxEncodedLength(Data.Num()) + 5);
+	const int32 NumDigits = WordsToDigits(Words.GetData(), NumWords, Digits.GetData());
+	return WriteDigits(CountLeading(Data.GetData(), Data.Num(), 0), Digits.GetData(), NumDigits, Out);
+}
+
+bool FBase58::Decode(TConstArrayView<ANSICHAR> Encoded, TArray<uint8>& Out)
+{
+	// Each digit carries less than 6 bits.
+	const int32 NumWords = (Encoded.Num() * 6 + 31) / 32;
+
+	TArray<uint32, TInlineAllocator<32>> Words;
+	Words.SetNumUninitialized(NumWords);
+	if (!DigitsToWords(Encoded.GetData(), Encoded.Num(), Words.GetData(), NumWords))
+		return false;
+
+	Out.Reset();
+	Out.AddZeroed(CountLeading(reinterpret_cast<const uint8*>(Encoded.GetData()), Encoded.Num(), '1'));
+
+	bool bSignificant = false;
+	for (const uint32 Word : Words)
+	{
+		for (int32 Shift = 24; Shift >= 0; Shift -= 8)
+		{
+			const uint8 Byte = static_cast<uint8>(Word >> Shift);
+			bSignificant |= Byte != 0;
+			if (bSignificant)
+			{
+				Out.Add(Byte);
+			}
+		}
+	}
+	return true;
+}
+
+TArray<uint8> FBase58::EncodeBase58(const TArray<uint8>& Data)
+{
+	TArray<uint8> Result;
+	Result.SetNumUninitialized(GetMaxEncodedLength(Data.Num()));
+
+	ANSICHAR* Out = reinterpret_cast<ANSICHAR*>(Result.GetData());
+	const int32 Length =
+		Data.Num() == 32 ? EncodeFixed<32>(Data.GetData(), Out) :
+		Data.Num() == 64 ? EncodeFixed<64>(Data.GetData(), Out) :
+		Encode(Data, Out);
+
+	Result.SetNum(Length, false);
+	return Result;
 }
 
 TArray<uint8> FBase58::DecodeBase58(const TArray<uint8>& Encoded)
 {
 	TArray<uint8> Result;
-	
-	FString Alphabet = ALPHABET;
-	
-	TBigInt<1024> IntData;
-	for (int i = 0; i < Encoded.Num(); i++)
+	if (!Decode(MakeArrayView(reinterpret_cast<const ANSICHAR*>(Encoded.GetData()), Encoded.Num()), Result))
+	{
+		Result.Reset();
+	}
+	return Result;
+}
+
+// Per-key classification of a batch slot: translates the characters into digit values, checks them against
+// the alphabet and finds the length of the key. The rest of the slot has to be zero padding.
+using FClassifyKeyFunction = bool(*)(const ANSICHAR* Slot, uint8* Digits, int32& OutLength);
+
+static bool ClassifyKeyScalar(const ANSICHAR* Slot, uint8* Digits, int32& OutLength)
+{
+	int32 Length = 0;
+	while (Length < FBase58::EncodedKeyStride && Slot[Length] != '\0')
+	{
+		const int8 Digit = DigitTable.Values[static_cast<uint8>(Slot[Length])];
+		if (Digit < 0)
+			return false;
+
+		Digits[Length++] = Digit;
+	}
+
+	for (int32 I = Length; I < FBase58::EncodedKeyStride; I++)
+	{
+		if (Slot[I] != '\0')
+			return false;
+	}
+
+	OutLength = Length;
+	return true;
+}
+
+// The alphabet as ranges of consecutive characters, with the value to subtract to get the digit.
+struct FAlphabetRange
+{
+	ANSICHAR First;
+	ANSICHAR Last;
+	uint8 Offset;
+};
+
+static constexpr FAlphabetRange AlphabetRanges[] = {
+	{ '1', '9', '1' },
+	{ 'A', 'H', 'A' - 9 },
+	{ 'J', 'N', 'J' - 17 },
+	{ 'P', 'Z', 'P' - 22 },
+	{ 'a', 'k', 'a' - 33 },
+	{ 'm', 'z', 'm' - 44 }
+};
+
+#if PLATFORM_CPU_X86_FAMILY
+
+CRYPTO_TARGET_AVX2 static inline __m256i ClassifyAVX2(__m256i Chars, __m256i& OutValid)
+{
+	// Characters from 0x80 up compare as negative and fall outside every range.
+	__m256i Digits = _mm256_setzero_si256();
+	OutValid = _mm256_setzero_si256();
+	for (const FAlphabetRange& Range : AlphabetRanges)
+	{
+		const __m256i InRange = _mm256_and_si256(
+			_mm256_cmpgt_epi8(Chars, _mm256_set1_epi8(Range.First - 1)),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8(Range.Last + 1), Chars));
+		OutValid = _mm256_or_si256(OutValid, InRange);
+		Digits = _mm256_or_si256(Digits, _mm256_and_si256(InRange, _mm256_sub_epi8(Chars, _mm256_set1_epi8(Range.Offset))));
+	}
+	return Digits;
+}
+
+CRYPTO_TARGET_AVX2 static bool ClassifyKeyAVX2(const ANSICHAR* Slot, uint8* Digits, int32& OutLength)
+{
+	static_assert(FBase58::EncodedKeyStride == 44, "The slot is covered by two overlapping 32 byte loads.");
+
+	// Bytes 0-31 and 12-43, the second vector contributes positions 32-43 from its lanes 20-31.
+	const __m256i Low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Slot));
+	const __m256i High = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Slot + 12));
+
+	__m256i LowValid, HighValid;
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Digits), ClassifyAVX2(Low, LowValid));
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Digits + 12), ClassifyAVX2(High, HighValid));
+
+	const __m256i Zero = _mm256_setzero_si256();
+	const uint64 ZeroMask = static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(Low, Zero)))
+		| static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(High, Zero))) >> 20) << 32;
+	const uint64 ValidMask = static_cast<uint32>(_mm256_movemask_epi8(LowValid))
+		| static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(HighValid)) >> 20) << 32;
+
+	constexpr uint64 SlotMask = (1ull << 44) - 1;
+	const int32 Length = FMath::CountTrailingZeros64(ZeroMask | (1ull << 44));
+	const uint64 KeyMask = (1ull << Length) - 1;
+
+	OutLength = Length;
+	return (ValidMask & KeyMask) == KeyMask && (ZeroMask & SlotMask & ~KeyMask) == (SlotMask & ~KeyMask);
+}
+
+#endif
+
+#if CRYPTO_HAS_NEON
+
+static inline bool ClassifyNEON(uint8x16_t Chars, int32 Position, int32 Length, uint8* Digits)
+{
+	uint8x16_t Values = vdupq_n_u8(0);
+	uint8x16_t Valid = vdupq_n_u8(0);
+	for (const FAlphabetRange& Range : AlphabetRanges)
+	{
+		const uint8x16_t InRange = vandq_u8(
+			vcgeq_u8(Chars, vdupq_n_u8(Range.First)),
+			vcleq_u8(Chars, vdupq_n_u8(Range.Last)));
+		Valid = vorrq_u8(Valid, InRange);
+		Values = vorrq_u8(Values, vandq_u8(InRange, vsubq_u8(Chars, vdupq_n_u8(Range.Offset))));
+	}
+	vst1q_u8(Digits + Position, Values);
+
+	// Lanes before the end of the key must be digits, the ones after it padding.
+	static constexpr uint8 LaneIndices[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+	const uint8x16_t InKey = vcltq_u8(vaddq_u8(vld1q_u8(LaneIndices), vdupq_n_u8(Position)), vdupq_n_u8(Length));
+	const uint8x16_t IsZero = vceqq_u8(Chars, vdupq_n_u8(0));
+	return vminvq_u8(vbslq_u8(InKey, Valid, IsZero)) == 0xFF;
+}
+
+static bool ClassifyKeyNEON(const ANSICHAR* Slot, uint8* Digits, int32& OutLength)
+{
+	static_assert(FBase58::EncodedKeyStride == 44, "The slot is covered by three overlapping 16 byte loads.");
+
+	const int32 Length = FCStringAnsi::Strnlen(Slot, FBase58::EncodedKeyStride);
+	const uint8* Bytes = reinterpret_cast<const uint8*>(Slot);
+
+	OutLength = Length;
+	return ClassifyNEON(vld1q_u8(Bytes), 0, Length, Digits)
+		& ClassifyNEON(vld1q_u8(Bytes + 16), 16, Length, Digits)
+		& ClassifyNEON(vld1q_u8(Bytes + 28), 28, Length, Digits);
+}
+
+#endif
+
+// Set once by FCryptoDispatch at startup, before any other thread decodes, and read once per call.
+static std::atomic<FClassifyKeyFunction> ClassifyKey{ &ClassifyKeyScalar };
+
+bool FBase58::SetKeyBackend(ECryptoBackend Backend)
+{
+	switch (Backend)
+	{
+	case ECryptoBackend::Portable:
+		ClassifyKey = &ClassifyKeyScalar;
+		return true;
+#if PLATFORM_CPU_X86_FAMILY
+	case ECryptoBackend::AVX2:
+		ClassifyKey = &ClassifyKeyAVX2;
+		return true;
+#endif
+#if CRYPTO_HAS_NEON
+	case ECryptoBackend::NEON:
+		ClassifyKey = &ClassifyKeyNEON;
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+void FBase58::EncodeKeys(const uint8* Keys, int32 Num, ANSICHAR* Out)
+{
+	for (int32 I = 0; I < Num; I++)
+	{
+		ANSICHAR* Slot = Out + I * EncodedKeyStride;
+		const int32 Length = EncodeFixed<32>(Keys + I * 32, Slot);
+		FMemory::Memzero(Slot + Length, EncodedKeyStride - Length);
+	}
+}
+
+bool FBase58::DecodeKeys(const ANSICHAR* Encoded, int32 Num, uint8* Out)
+{
+	const FClassifyKeyFunction Classify = ClassifyKey.load(std::memory_order_relaxed);
+
+	bool bAllValid = true;
+	for (int32 I = 0; I < Num; I++)
+	{
+		uint8* Key = Out + I * 32;
+
+		uint8 Digits[EncodedKeyStride];
+		int32 Length;
+		const bool bValid = Classify(Encoded + I * EncodedKeyStride, Digits, Length)
+			&& DecodeFixedDigits<32>(Length, [&Digits](int32 Index) { return static_cast<int8>(Digits[Index]); }, Key);
+
+		// A value with fewer or more leading '1's than leading zero bytes encodes a different length.
+		if (!bValid || CountLeading(Digits, Length, 0) != CountLeading(Key, 32, 0))
+		{
+			FMemory::Memzero(Key, 32);
+			bAllValid = false;
+		}
+	}
+	return bAllValid;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static constexpr int32 Stride = FBase58::EncodedKeyStride;
+
+template<int32 NumBytes>
+static void TestFixedWidth(FAutomationTestBase& Test, const uint8* Data)
+{
+	ANSICHAR Fixed[FBase58::GetMaxEncodedLength(NumBytes)];
+	ANSICHAR Generic[FBase58::GetMaxEncodedLength(NumBytes)];
+	const int32 Length = FBase58::EncodeFixed<NumBytes>(Data, Fixed);
+	const int32 GenericLength = FBase58::Encode(MakeArrayView(Data, NumBytes), Generic);
+	Test.TestTrue(FString::Printf(TEXT("EncodeFixed<%d> matches Encode"), NumBytes),
+		Length == GenericLength && FMemory::Memcmp(Fixed, Generic, Length) == 0);
+
+	uint8 Decoded[NumBytes];
+	Test.TestTrue(FString::Printf(TEXT("DecodeFixed<%d> round trip"), NumBytes),
+		FBase58::DecodeFixed<NumBytes>(MakeArrayView(Fixed, Length), Decoded) && FMemory::Memcmp(Decoded, Data, NumBytes) == 0);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBase58Test, "Solana.Crypto.Base58", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBase58Test::RunTest(const FString& Parameters)
+{
+	// Known answers through the generic coder, leading zero bytes included.
+	struct FVector
+	{
+		const TCHAR* Hex;
+		const ANSICHAR* Encoded;
+	};
+
+	static const FVector Vectors[] = {
+		{ TEXT("0000000000000000000000000000000000000000000000000000000000000000"), "11111111111111111111111111111111" },
+		// The SPL token program.
+		{ TEXT("06ddf6e1d765a193d9cbe146ceeb79ac1cb485ed5f5b37913a8cf5857eff00a9"), "TokenkegQfeZyiNwAJbNbGKPFXCWuBvf9Ss623VQ5DA" },
+		{ TEXT("000001"), "112" },
+	};
+
+	for (const FVector& Vector : Vectors)
+	{
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(FCString::Strlen(Vector.Hex) / 2);
+		HexToBytes(Vector.Hex, Data.GetData());
+		const int32 ExpectedLength = FCStringAnsi::Strlen(Vector.Encoded);
+
+		ANSICHAR Encoded[FBase58::GetMaxEncodedLength(32)];
+		const int32 Length = FBase58::Encode(Data, Encoded);
+		TestTrue(FString::Printf(TEXT("Encode gives %hs"), Vector.Encoded), Length == ExpectedLength && FMemory::Memcmp(Encoded, Vector.Encoded, Length) == 0);
+
+		TArray<uint8> Decoded;
+		TestTrue(FString::Printf(TEXT("Decode %hs"), Vector.Encoded), FBase58::Decode(MakeArrayView(Vector.Encoded, ExpectedLength), Decoded) && Decoded == Data);
+	}
+
+	// The characters left out of the alphabet as look-alikes.
+	for (const ANSICHAR Excluded : { '0', 'O', 'I', 'l' })
+	{
+		const ANSICHAR Encoded[] = { '2', Excluded, '3' };
+		TArray<uint8> Decoded;
+		TestFalse(FString::Printf(TEXT("Decode accepts '%c'"), Excluded), FBase58::Decode(MakeArrayView(Encoded, UE_ARRAY_COUNT(Encoded)), Decoded));
+	}
+
+	FRandomStream Random(58);
+
+	// All zero, all 0xFF, leading zero bytes before random ones, and random values.
+	for (int32 Case = 0; Case < 40; Case++)
 	{
-		int Digit = -1;
-		unsigned char temp = Encoded[i];
-		if (!Alphabet.FindChar(temp, Digit) || Digit < 0 )
+		uint8 Data[64];
+		for (uint8& Byte : Data)
+		{
+			Byte = Case == 0 ? 0x00 : Case == 1 ? 0xFF : static_cast<uint8>(Random.RandHelper(256));
+		}
+		if (Case >= 2 && Case < 10)
 		{
-			//Error
+			FMemory::Memzero(Data, Case - 1);
 		}
-		IntData = IntData * 58 + Digit;
+
+		TestFixedWidth<32>(*this, Data);
+		TestFixedWidth<64>(*this, Data);
 	}
-	
-	uint32* Bits = IntData.GetBits();
-	constexpr int32 BitEndIndex = (1024 / 32) - 1;
-	for (int k = BitEndIndex; k >= 0 ; k--)
+
+	// A batch of keys, with a zero key and a leading zero byte among them.
+	constexpr int32 NumKeys = 16;
+	uint8 Keys[NumKeys * 32];
+	for (uint8& Byte : Keys)
 	{
-		if (Bits[k] != 0)
+		Byte = static_cast<uint8>(Random.RandHelper(256));
+	}
+	FMemory::Memzero(Keys, 32);
+	Keys[32] = 0;
+
+	TArray<ANSICHAR> Encoded;
+	Encoded.SetNumUninitialized(NumKeys * Stride);
+	FBase58::EncodeKeys(Keys, NumKeys, Encoded.GetData());
+
+	uint8 Decoded[NumKeys * 32];
+	TestTrue(TEXT("DecodeKeys round trip"), FBase58::DecodeKeys(Encoded.GetData(), NumKeys, Decoded) && FMemory::Memcmp(Decoded, Keys, sizeof(Keys)) == 0);
+
+	// A character off the alphabet zeroes only its own key.
+	TArray<ANSICHAR> Invalid = Encoded;
+	Invalid[3 * Stride + 5] = '0';
+	TestFalse(TEXT("DecodeKeys with an invalid key"), FBase58::DecodeKeys(Invalid.GetData(), NumKeys, Decoded));
+
+	uint8 Expected[NumKeys * 32];
+	FMemory::Memcpy(Expected, Keys, sizeof(Keys));
+	FMemory::Memzero(Expected + 3 * 32, 32);
+	TestTrue(TEXT("DecodeKeys zeroes the invalid key only"), FMemory::Memcmp(Decoded, Expected, sizeof(Keys)) == 0);
+
+	// The vector classifiers against the scalar one, on valid keys and on slots each one rejects for another reason.
+	TArray<ANSICHAR> Slots = Encoded;
+	Slots.Append(Invalid.GetData() + 3 * Stride, Stride);
+	for (const int32 Position : { 0, 15, 16, 31, 43 })
+	{
+		const int32 First = Slots.AddZeroed(3 * Stride);
+		FMemory::Memset(&Slots[First], 'z', Position);
+		Slots[First + Position] = static_cast<ANSICHAR>(0x80);
+		FMemory::Memset(&Slots[First + Stride], 'z', Position);
+		Slots[First + Stride + Position] = 'l';
+		FMemory::Memset(&Slots[First + 2 * Stride], 'z', Position);
+		Slots[First + 2 * Stride + 43] = 'z';
+	}
+
+	const auto MatchesScalar = [this, &Slots](const TCHAR* Name, FClassifyKeyFunction Classify)
+	{
+		for (int32 Slot = 0; Slot < Slots.Num() / Stride; Slot++)
 		{
-			uint8 Bytes[4];
-			Bytes[0] = (Bits[k] >> 24) & 0xff;
-			Bytes[1] = (Bits[k] >> 16) & 0xff;
-			Bytes[2] = (Bits[k] >> 8) & 0xff;
-			Bytes[3] = (Bits[k] & 0xff);
-			Result.Append(Bytes, 4);
+			uint8 ScalarDigits[Stride];
+			uint8 Digits[Stride];
+			int32 ScalarLength = -1;
+			int32 Length = -1;
+			const bool bScalarValid = ClassifyKeyScalar(&Slots[Slot * Stride], ScalarDigits, ScalarLength);
+			const bool bValid = Classify(&Slots[Slot * Stride], Digits, Length);
+			TestTrue(FString::Printf(TEXT("%s classifies slot %d like the scalar code"), Name, Slot),
+				bValid == bScalarValid && (!bValid || (Length == ScalarLength && FMemory::Memcmp(Digits, ScalarDigits, Length) == 0)));
 		}
+	};
+
+#if PLATFORM_CPU_X86_FAMILY
+	if (FCpuFeatures::Get().bAVX2)
+	{
+		MatchesScalar(TEXT("ClassifyKeyAVX2"), &ClassifyKeyAVX2);
 	}
+#endif
+#if CRYPTO_HAS_NEON
+	if (FCpuFeatures::Get().bNEON)
+	{
+		MatchesScalar(TEXT("ClassifyKeyNEON"), &ClassifyKeyNEON);
+	}
+#endif
+	return true;
+}
 
-	return Result;
-}
\ No newline at end of file
+#endif
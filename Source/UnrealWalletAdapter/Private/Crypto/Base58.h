@@ -20,9 +20,56 @@ Author: Jon Sawler
 
 #include "CoreMinimal.h"
 
+enum class ECryptoBackend : uint8;
+
 class FBase58
 {
 public:
+	/** Upper bound of the encoded length of NumBytes, log(256) / log(58) = 1.3657... */
+	static constexpr int32 GetMaxEncodedLength(int32 NumBytes) { return NumBytes * 1366 / 1000 + 1; }
+
 	static TArray<uint8> EncodeBase58(const TArray<uint8>& Data);
+	/** Returns an empty array if Encoded isn't valid base58. */
 	static TArray<uint8> DecodeBase58(const TArray<uint8>& Encoded);
+
+	/**
+	 * Encodes a value of any length into Out, which must hold GetMaxEncodedLength(Data.Num()) characters.
+	 * Returns the number of characters written.
+	 */
+	static int32 Encode(TConstArrayView<uint8> Data, ANSICHAR* Out);
+	/** Decodes into Out, returns false if Encoded contains a character outside the alphabet. */
+	static bool Decode(TConstArrayView<ANSICHAR> Encoded, TArray<uint8>& Out);
+
+	/**
+	 * Fixed-width variants for 32 byte public keys and hashes and 64 byte signatures. The value is converted
+	 * between stack arrays of 32-bit words and base 58^5 limbs through precomputed tables, so nothing is
+	 * allocated and the loops have constant bounds.
+	 */
+	template<int32 NumBytes>
+	static int32 EncodeFixed(const uint8* Data, ANSICHAR* Out);
+	/** Returns false if Encoded is invalid or doesn't encode exactly NumBytes. */
+	template<int32 NumBytes>
+	static bool DecodeFixed(TConstArrayView<ANSICHAR> Encoded, uint8* Out);
+
+	/** Distance between the keys of a batch buffer. Keys shorter than that are padded with '\0'. */
+	static constexpr int32 EncodedKeyStride = 44;
+
+	/** Encodes Num 32 byte keys stored back to back into Out, which holds Num * EncodedKeyStride characters. */
+	static void EncodeKeys(const uint8* Keys, int32 Num, ANSICHAR* Out);
+	/**
+	 * Decodes Num keys laid out at EncodedKeyStride into Out, which holds Num * 32 bytes. Invalid keys are
+	 * zeroed and make the call return false, the other keys are still decoded.
+	 */
+	static bool DecodeKeys(const ANSICHAR* Encoded, int32 Num, uint8* Out);
+
+	/**
+	 * Picks the character classification of DecodeKeys, set by FCryptoDispatch. Returns false, keeping the
+	 * current one, for a backend this build has no code for.
+	 */
+	static bool SetKeyBackend(ECryptoBackend Backend);
 };
+
+extern template int32 FBase58::EncodeFixed<32>(const uint8* Data, ANSICHAR* Out);
+extern template int32 FBase58::EncodeFixed<64>(const uint8* Data, ANSICHAR* Out);
+extern template bool FBase58::DecodeFixed<32>(TConstArrayView<ANSICHAR> Encoded, uint8* Out);
+extern template bool FBase58::DecodeFixed<64>(TConstArrayView<ANSICHAR> Encoded, uint8* Out);
@@ -0,0 +1,42 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/FEd25519Bip39.h"
+
+static void BenchmarkAccountDerivation(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 1000);
+
+	TArray<uint8> Seed;
+	Seed.SetNumUninitialized(64);
+	for (uint8& Byte : Seed)
+	{
+		Byte = static_cast<uint8>(FMath::RandHelper(256));
+	}
+	FEd25519Bip39 Bip39(Seed);
+
+	RunBenchmark(TEXT("DeriveAccountPath"), Iterations, [&](int32 Sample)
+	{
+		return Bip39.DeriveAccountPath(static_cast<uint32>(Sample))[0];
+	});
+
+	// A wallet recovery scan, the keypairs included.
+	TArray<uint8> PublicKeys;
+	TArray<uint8> PrivateKeys;
+	RunBatchBenchmark(TEXT("DeriveAccounts"), Iterations, Iterations, [&]
+	{
+		Bip39.DeriveAccounts(0, Iterations, PublicKeys, PrivateKeys);
+	});
+}
+
+static FAutoConsoleCommand AccountDerivationBenchmarkCommand(
+	TEXT("Solana.Benchmark.AccountDerivation"),
+	TEXT("Times deriving m/44'/501'/index'/0' accounts, one by one and as a parallel range. Optional argument: accounts."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkAccountDerivation));
+
+#endif
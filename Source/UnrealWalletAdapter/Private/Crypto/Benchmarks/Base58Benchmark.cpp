@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/Base58.h"
+
+static void BenchmarkBase58(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 100000);
+
+	TArray<uint8> Values;
+	Values.SetNumUninitialized(NumBenchmarkSamples * 64);
+	for (uint8& Byte : Values)
+	{
+		Byte = static_cast<uint8>(FMath::RandHelper(256));
+	}
+
+	TArray<TArray<uint8>> Encoded32;
+	TArray<TArray<uint8>> Encoded64;
+	TArray<TArray<uint8>> Values32;
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		Values32.Emplace(&Values[I * 32], 32);
+		Encoded32.Add(FBase58::EncodeBase58(Values32.Last()));
+		Encoded64.Add(FBase58::EncodeBase58(TArray<uint8>(&Values[I * 64], 64)));
+	}
+
+	ANSICHAR Text[FBase58::GetMaxEncodedLength(64)];
+	uint8 Bytes[64];
+
+	RunBenchmark(TEXT("EncodeFixed<32>"), Iterations, [&](int32 Sample)
+	{
+		return FBase58::EncodeFixed<32>(&Values[Sample * 32], Text);
+	});
+	RunBenchmark(TEXT("DecodeFixed<32>"), Iterations, [&](int32 Sample)
+	{
+		const TArray<uint8>& Encoded = Encoded32[Sample];
+		return FBase58::DecodeFixed<32>(MakeArrayView(reinterpret_cast<const ANSICHAR*>(Encoded.GetData()), Encoded.Num()), Bytes);
+	});
+	RunBenchmark(TEXT("EncodeFixed<64>"), Iterations, [&](int32 Sample)
+	{
+		return FBase58::EncodeFixed<64>(&Values[Sample * 64], Text);
+	});
+	RunBenchmark(TEXT("DecodeFixed<64>"), Iterations, [&](int32 Sample)
+	{
+		const TArray<uint8>& Encoded = Encoded64[Sample];
+		return FBase58::DecodeFixed<64>(MakeArrayView(reinterpret_cast<const ANSICHAR*>(Encoded.GetData()), Encoded.Num()), Bytes);
+	});
+	TArray<ANSICHAR> KeyText;
+	KeyText.SetNumUninitialized(NumBenchmarkSamples * FBase58::EncodedKeyStride);
+	TArray<uint8> Keys;
+	Keys.SetNumUninitialized(NumBenchmarkSamples * 32);
+
+	RunBatchBenchmark(TEXT("EncodeKeys"), Iterations, NumBenchmarkSamples, [&]
+	{
+		FBase58::EncodeKeys(Values.GetData(), NumBenchmarkSamples, KeyText.GetData());
+	});
+	RunBatchBenchmark(TEXT("DecodeKeys"), Iterations, NumBenchmarkSamples, [&]
+	{
+		FBase58::DecodeKeys(KeyText.GetData(), NumBenchmarkSamples, Keys.GetData());
+	});
+	RunBenchmark(TEXT("EncodeBase58 (32)"), Iterations, [&](int32 Sample)
+	{
+		return FBase58::EncodeBase58(Values32[Sample]).Num();
+	});
+	RunBenchmark(TEXT("DecodeBase58 (32)"), Iterations, [&](int32 Sample)
+	{
+		return FBase58::DecodeBase58(Encoded32[Sample]).Num();
+	});
+}
+
+static FAutoConsoleCommand Base58BenchmarkCommand(
+	TEXT("Solana.Benchmark.Base58"),
+	TEXT("Times base58 encoding and decoding of public keys and signatures. Optional argument: iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkBase58));
+
+#endif
@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+
+// Shared by the Solana.Benchmark.* console commands, one file per feature next to this one.
+
+DECLARE_LOG_CATEGORY_CLASS(LogCryptoBenchmarks, Log, All);
+
+// Number of distinct inputs cycled through, so the numbers aren't those of a single hot value.
+static constexpr int32 NumBenchmarkSamples = 256;
+
+/** Times Iterations calls of Body(Sample) and logs the time per call. Body returns a value summed into a checksum, so it isn't optimized away. */
+template<typename BodyType>
+static void RunBenchmark(const TCHAR* Name, int32 Iterations, BodyType&& Body)
+{
+	int64 Checksum = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 I = 0; I < Iterations; I++)
+	{
+		Checksum += Body(I % NumBenchmarkSamples);
+	}
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f ns/op (checksum %lld)"), Name, Elapsed * 1e9 / Iterations, Checksum);
+}
+
+/** Times Body, which processes BatchSize items, often enough to cover about Iterations items and logs the time per item. */
+template<typename BodyType>
+static void RunBatchBenchmark(const TCHAR* Name, int32 Iterations, int32 BatchSize, BodyType&& Body)
+{
+	const int32 NumBatches = FMath::Max(Iterations / BatchSize, 1);
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 I = 0; I < NumBatches; I++)
+	{
+		Body();
+	}
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f ns/item"), Name, Elapsed * 1e9 / (NumBatches * BatchSize));
+}
+
+/** The first argument of a benchmark command as a count, at least 1, or Default without one. */
+inline int32 GetBenchmarkCount(const TArray<FString>& Args, int32 Default)
+{
+	return Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : Default;
+}
+
+#endif
@@ -0,0 +1,257 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Async/ParallelFor.h"
+#include "Crypto/CpuFeatures.h"
+#include "Crypto/CryptoDispatch.h"
+#include "Crypto/ed25519/ed25519.h"
+#include "Crypto/ed25519/sc.h"
+
+static void BenchmarkEd25519(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 10000);
+
+	// Transaction sized messages, each signed with its own key.
+	static constexpr int32 MessageSize = 256;
+	TArray<uint8> Messages;
+	Messages.SetNumUninitialized(NumBenchmarkSamples * MessageSize);
+	for (uint8& Byte : Messages)
+	{
+		Byte = static_cast<uint8>(FMath::RandHelper(256));
+	}
+
+	TArray<uint8> PublicKeys;
+	TArray<uint8> PrivateKeys;
+	TArray<uint8> Signatures;
+	PublicKeys.SetNumUninitialized(NumBenchmarkSamples * 32);
+	PrivateKeys.SetNumUninitialized(NumBenchmarkSamples * 64);
+	Signatures.SetNumUninitialized(NumBenchmarkSamples * 64);
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		ed25519_create_keypair(&PublicKeys[I * 32], &PrivateKeys[I * 64], &Messages[I * MessageSize]);
+		ed25519_sign(&Signatures[I * 64], &Messages[I * MessageSize], MessageSize, &PrivateKeys[I * 64]);
+	}
+
+	uint8 Signature[64];
+	uint8 PublicKey[32];
+	uint8 PrivateKey[64];
+
+	// On the backend picked at startup, then the scalar multiplications underneath on each backend the CPU has,
+	// called directly as the one in use must not be switched while other threads may be running it.
+	const TCHAR* Bound = FCryptoDispatch::GetBackendName(FCryptoDispatch::GetBackend(ECryptoKernel::Ed25519));
+	RunBenchmark(*FString::Printf(TEXT("ed25519_create_keypair (%s)"), Bound), Iterations, [&](int32 Sample)
+	{
+		ed25519_create_keypair(PublicKey, PrivateKey, &Messages[Sample * MessageSize]);
+		return PublicKey[0];
+	});
+	RunBenchmark(*FString::Printf(TEXT("ed25519_sign (%s)"), Bound), Iterations, [&](int32 Sample)
+	{
+		ed25519_sign(Signature, &Messages[Sample * MessageSize], MessageSize, &PrivateKeys[Sample * 64]);
+		return Signature[0];
+	});
+	RunBenchmark(*FString::Printf(TEXT("ed25519_verify (%s)"), Bound), Iterations, [&](int32 Sample)
+	{
+		return ed25519_verify(&Signatures[Sample * 64], &Messages[Sample * MessageSize], MessageSize, &PublicKeys[Sample * 32]);
+	});
+
+	// Scalars below 2^255, as the entry points require.
+	TArray<uint8> Scalars = Messages;
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		Scalars[I * MessageSize + 31] &= 127;
+		Scalars[I * MessageSize + 63] &= 127;
+	}
+
+	uint8 Point[32];
+	for (const bool bAVX2 : { false, true })
+	{
+		if (bAVX2 && !FCpuFeatures::Get().bAVX2)
+			continue;
+
+		const TCHAR* Backend = bAVX2 ? TEXT("avx2") : TEXT("portable");
+		RunBenchmark(*FString::Printf(TEXT("ed25519_scalarmult_base_on (%s)"), Backend), Iterations, [&](int32 Sample)
+		{
+			ed25519_scalarmult_base_on(Point, &Scalars[Sample * MessageSize], bAVX2);
+			return Point[0];
+		});
+		RunBenchmark(*FString::Printf(TEXT("ed25519_double_scalarmult_on (%s)"), Backend), Iterations, [&](int32 Sample)
+		{
+			ed25519_double_scalarmult_on(Point, &Scalars[Sample * MessageSize], &PublicKeys[Sample * 32], &Scalars[Sample * MessageSize + 32], bAVX2);
+			return Point[0];
+		});
+	}
+
+	uint8 Expanded[64];
+	ed25519_expand_private_key(Expanded, &PrivateKeys[0]);
+	RunBenchmark(TEXT("ed25519_sign_expanded"), Iterations, [&](int32 Sample)
+	{
+		ed25519_sign_expanded(Signature, &Messages[Sample * MessageSize], MessageSize, &PublicKeys[0], Expanded);
+		return Signature[0];
+	});
+
+	TArray<const uint8*> SignatureData;
+	TArray<const uint8*> MessageData;
+	TArray<size_t> MessageLens;
+	TArray<const uint8*> PublicKeyData;
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		SignatureData.Add(&Signatures[I * 64]);
+		MessageData.Add(&Messages[I * MessageSize]);
+		MessageLens.Add(MessageSize);
+		PublicKeyData.Add(&PublicKeys[I * 32]);
+	}
+
+	TArray<uint8> ManySignatures;
+	ManySignatures.SetNumUninitialized(NumBenchmarkSamples * 64);
+	RunBatchBenchmark(TEXT("ed25519_sign_expanded_many"), Iterations, NumBenchmarkSamples, [&]
+	{
+		ed25519_sign_expanded_many(ManySignatures.GetData(), MessageData.GetData(), MessageLens.GetData(), NumBenchmarkSamples, &PublicKeys[0], Expanded);
+	});
+
+	TArray<ed25519_prepared_key> PreparedKeys;
+	PreparedKeys.SetNumUninitialized(NumBenchmarkSamples);
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		ed25519_prepare_key(&PreparedKeys[I], &PublicKeys[I * 32]);
+	}
+
+	RunBenchmark(TEXT("ed25519_prepare_key"), Iterations, [&](int32 Sample)
+	{
+		return ed25519_prepare_key(&PreparedKeys[Sample], &PublicKeys[Sample * 32]);
+	});
+	RunBenchmark(TEXT("ed25519_verify_prepared"), Iterations, [&](int32 Sample)
+	{
+		return ed25519_verify_prepared(&Signatures[Sample * 64], &Messages[Sample * MessageSize], MessageSize, &PreparedKeys[Sample]);
+	});
+
+	TArray<uint8> Weights;
+	Weights.SetNumUninitialized(NumBenchmarkSamples * 16);
+	for (uint8& Byte : Weights)
+	{
+		Byte = static_cast<uint8>(FMath::RandHelper(256));
+	}
+
+	RunBatchBenchmark(TEXT("ed25519_verify_batch"), Iterations, NumBenchmarkSamples, [&]
+	{
+		ed25519_verify_batch(SignatureData.GetData(), MessageData.GetData(), MessageLens.GetData(), PublicKeyData.GetData(), NumBenchmarkSamples, Weights.GetData(), nullptr);
+	});
+}
+
+static FAutoConsoleCommand Ed25519BenchmarkCommand(
+	TEXT("Solana.Benchmark.Ed25519"),
+	TEXT("Times ed25519 key derivation, signing and verification, and the scalar multiplications underneath on each backend. Optional argument: iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkEd25519));
+
+static void BenchmarkKeyGeneration(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 10000);
+
+	static constexpr int32 BatchSize = 4096;
+	TArray<uint8> Seeds;
+	Seeds.SetNumUninitialized(BatchSize * 32);
+	for (uint8& Byte : Seeds)
+	{
+		Byte = static_cast<uint8>(FMath::RandHelper(256));
+	}
+
+	TArray<uint8> PublicKey;
+	PublicKey.SetNumUninitialized(32);
+	TArray<uint8> PrivateKey;
+	PrivateKey.SetNumUninitialized(64);
+	TArray<uint8> PublicKeys;
+	TArray<uint8> PrivateKeys;
+
+	// Each table width in turn, over a table of the benchmark's own, as the installed one is never swapped.
+	static constexpr int32 ChunkSize = 64;
+	const int32 NumChunks = FMath::DivideAndRoundUp(BatchSize, ChunkSize);
+	PublicKeys.SetNumUninitialized(BatchSize * 32);
+	PrivateKeys.SetNumUninitialized(BatchSize * 64);
+	for (const int32 Window : { 0, 4, 5, 6, 8 })
+	{
+		ed25519_base_table* Table = Window != 0 ? ed25519_base_table_create(Window) : nullptr;
+		if (Window != 0 && !Table)
+			continue;
+
+		UE_LOG(LogCryptoBenchmarks, Display, TEXT("Base table window %d%s%s"), Window, Window == 0 ? TEXT(" (built-in)") : TEXT(""),
+			Window == ed25519_get_base_window() ? TEXT(" (installed)") : TEXT(""));
+		RunBenchmark(TEXT("Create one keypair"), Iterations, [&](int32 Sample)
+		{
+			ed25519_create_keypairs_with_table(PublicKey.GetData(), PrivateKey.GetData(), Seeds.GetData() + Sample * 32, 1, Table);
+			return PublicKey[0];
+		});
+		RunBatchBenchmark(TEXT("Create keypairs (1)"), Iterations, BatchSize, [&]
+		{
+			ed25519_create_keypairs_with_table(PublicKeys.GetData(), PrivateKeys.GetData(), Seeds.GetData(), BatchSize, Table);
+		});
+		RunBatchBenchmark(TEXT("Create keypairs (all)"), Iterations, BatchSize, [&]
+		{
+			// The chunking of FCryptoUtils::GenerateKeyPairs.
+			ParallelFor(NumChunks, [&](int32 Chunk)
+			{
+				const int32 First = Chunk * ChunkSize;
+				ed25519_create_keypairs_with_table(PublicKeys.GetData() + First * 32, PrivateKeys.GetData() + First * 64, Seeds.GetData() + First * 32,
+					FMath::Min(ChunkSize, BatchSize - First), Table);
+			});
+		});
+		ed25519_base_table_free(Table);
+	}
+}
+
+static FAutoConsoleCommand KeyGenerationBenchmarkCommand(
+	TEXT("Solana.Benchmark.KeyGeneration"),
+	TEXT("Times keypair generation one at a time and batched on one and on all workers, for each base table window. Optional argument: iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkKeyGeneration));
+
+static void BenchmarkScalar(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 1000000);
+
+	// Hash sized inputs for the reduction, and the scalar, nonce and hash of a signature for the multiply-add.
+	TArray<uint8> Values;
+	Values.SetNumUninitialized(NumBenchmarkSamples * 64);
+	for (uint8& Byte : Values)
+	{
+		Byte = static_cast<uint8>(FMath::RandHelper(256));
+	}
+	uint8 Scalar[64];
+	uint8 Sum[32];
+
+	RunBenchmark(TEXT("sc_reduce"), Iterations, [&](int32 Sample)
+	{
+		FMemory::Memcpy(Scalar, &Values[Sample * 64], 64);
+		sc_reduce(Scalar);
+		return Scalar[0];
+	});
+	RunBenchmark(TEXT("sc_muladd"), Iterations, [&](int32 Sample)
+	{
+		sc_muladd(Sum, &Values[Sample * 64], &Values[Sample * 64 + 32], &Values[((Sample + 1) % NumBenchmarkSamples) * 64]);
+		return Sum[0];
+	});
+
+#if ED25519_SC64
+	// The 21 bit limb code the 64 bit one replaces.
+	RunBenchmark(TEXT("sc_reduce (sc.c)"), Iterations, [&](int32 Sample)
+	{
+		FMemory::Memcpy(Scalar, &Values[Sample * 64], 64);
+		sc_reduce_ref(Scalar);
+		return Scalar[0];
+	});
+	RunBenchmark(TEXT("sc_muladd (sc.c)"), Iterations, [&](int32 Sample)
+	{
+		sc_muladd_ref(Sum, &Values[Sample * 64], &Values[Sample * 64 + 32], &Values[((Sample + 1) % NumBenchmarkSamples) * 64]);
+		return Sum[0];
+	});
+#endif
+}
+
+static FAutoConsoleCommand ScalarBenchmarkCommand(
+	TEXT("Solana.Benchmark.Scalar"),
+	TEXT("Times the scalar reduction and multiply-add modulo l, against the 21 bit limb code where the 64 bit one is built. Optional argument: iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkScalar));
+
+#endif
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/HmacSha512.h"
+
+static void BenchmarkHmacSha512(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 100000);
+
+	// SLIP-10 child derivation sized messages.
+	TArray<TArray<uint8>> Messages;
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		TArray<uint8>& Message = Messages.AddDefaulted_GetRef();
+		Message.SetNumUninitialized(37);
+		for (uint8& Byte : Message)
+		{
+			Byte = static_cast<uint8>(FMath::RandHelper(256));
+		}
+	}
+	const TArray<uint8> Key(Messages[0].GetData(), 32);
+	const FHmacSha512 Hmac(Key);
+
+	uint8 Digest[FHmacSha512::DigestSize];
+	RunBenchmark(TEXT("FCryptoUtils::HMAC_SHA512"), Iterations, [&](int32 Sample)
+	{
+		return FCryptoUtils::HMAC_SHA512(Messages[Sample], Key)[0];
+	});
+	RunBenchmark(TEXT("FHmacSha512::Compute"), Iterations, [&](int32 Sample)
+	{
+		Hmac.Compute(Messages[Sample].GetData(), Messages[Sample].Num(), Digest);
+		return Digest[0];
+	});
+
+	TArray<uint8> Digests;
+	Digests.SetNumUninitialized(NumBenchmarkSamples * FHmacSha512::DigestSize);
+	RunBatchBenchmark(TEXT("FHmacSha512::Compute (bulk)"), Iterations, NumBenchmarkSamples, [&]
+	{
+		Hmac.Compute(Messages, Digests.GetData());
+	});
+}
+
+static FAutoConsoleCommand HmacSha512BenchmarkCommand(
+	TEXT("Solana.Benchmark.HmacSha512"),
+	TEXT("Times HMAC-SHA512 with a new key each time, with precomputed key states and in bulk. Optional argument: iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkHmacSha512));
+
+#endif
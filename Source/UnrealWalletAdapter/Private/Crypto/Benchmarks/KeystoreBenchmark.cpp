@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/Keystore.h"
+
+static void BenchmarkKeystore(const TArray<FString>& Args)
+{
+	const int32 SizeMB = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 1024) : 256;
+	const FString Password = TEXT("correct horse battery staple");
+
+	// The key derivation dominates small blobs like keys, each step up in N doubling it.
+	TArray<uint8> Key;
+	Key.SetNumZeroed(64);
+	TArray<uint8> Sealed;
+	for (const int32 LogN : { 14, 15, 16 })
+	{
+		FKeystoreParams Params;
+		Params.ScryptLogN = static_cast<uint8>(LogN);
+		Sealed.SetNumUninitialized(FKeystore::GetEncryptedSize(Key.Num(), Params));
+		const double StartTime = FPlatformTime::Seconds();
+		FKeystore::Encrypt(Key, Password, Sealed, Params);
+		UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f ms"), *FString::Printf(TEXT("scrypt 2^%d"), LogN), (FPlatformTime::Seconds() - StartTime) * 1e3);
+	}
+
+	// The chunk encryption itself, on a large blob and the cheapest key derivation.
+	TArray<uint8> Data;
+	Data.SetNumUninitialized(SizeMB * 1024 * 1024);
+	for (int32 I = 0; I < Data.Num(); I++)
+	{
+		Data[I] = static_cast<uint8>(I * 131);
+	}
+	FKeystoreParams Params;
+	Params.ScryptLogN = 1;
+	TArray<uint8> Encrypted;
+	Encrypted.SetNumUninitialized(FKeystore::GetEncryptedSize(Data.Num(), Params));
+	TArray<uint8> Decrypted;
+	Decrypted.SetNumUninitialized(Data.Num());
+
+	double StartTime = FPlatformTime::Seconds();
+	const bool bEncrypted = FKeystore::Encrypt(Data, Password, Encrypted, Params);
+	const double EncryptSeconds = FPlatformTime::Seconds() - StartTime;
+	StartTime = FPlatformTime::Seconds();
+	const bool bDecrypted = bEncrypted && FKeystore::Decrypt(Encrypted, Password, Decrypted) && Decrypted == Data;
+	const double DecryptSeconds = FPlatformTime::Seconds() - StartTime;
+	StartTime = FPlatformTime::Seconds();
+	const int32 LegacySize = FCryptoUtils::EncryptAES128GCM(Data, Password).Num();
+	const double LegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f MB/s (%s)"), TEXT("FKeystore::Encrypt"), SizeMB / EncryptSeconds, bEncrypted ? TEXT("encrypted") : TEXT("FAILED"));
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f MB/s (%s)"), TEXT("FKeystore::Decrypt"), SizeMB / DecryptSeconds, bDecrypted ? TEXT("matches") : TEXT("FAILED"));
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f MB/s (%d bytes)"), TEXT("EncryptAES128GCM"), SizeMB / LegacySeconds, LegacySize);
+}
+
+static FAutoConsoleCommand KeystoreBenchmarkCommand(
+	TEXT("Solana.Benchmark.Keystore"),
+	TEXT("Times the FKeystore key derivation at a few costs, and its encryption against EncryptAES128GCM. Optional argument: data size in MB, up to 1024."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkKeystore));
+
+#endif
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/Mnemonic.h"
+
+static void BenchmarkMnemonic(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 100000);
+
+	TArray<FString> Mnemonics;
+	FMnemonic::Generate(NumBenchmarkSamples, FMnemonic::MaxWords, Mnemonics);
+	TArray<TArray<uint8>> Entropies;
+	for (const FString& Mnemonic : Mnemonics)
+	{
+		FMnemonic::ToEntropy(Mnemonic, Entropies.AddDefaulted_GetRef());
+	}
+
+	RunBenchmark(TEXT("SplitBytesByBits"), Iterations, [&](int32 Sample)
+	{
+		return FCryptoUtils::SplitBytesByBits(Entropies[Sample], 11)[0];
+	});
+	FString Mnemonic;
+	RunBenchmark(TEXT("FromEntropy"), Iterations, [&](int32 Sample)
+	{
+		FMnemonic::FromEntropy(Entropies[Sample], Mnemonic);
+		return Mnemonic.Len();
+	});
+	RunBenchmark(TEXT("IsValid"), Iterations, [&](int32 Sample)
+	{
+		return FMnemonic::IsValid(Mnemonics[Sample]) ? 1 : 0;
+	});
+
+	TArray<bool> Valid;
+	RunBatchBenchmark(TEXT("Validate"), Iterations, NumBenchmarkSamples, [&]
+	{
+		FMnemonic::Validate(Mnemonics, Valid);
+	});
+	TArray<FString> Generated;
+	RunBatchBenchmark(TEXT("Generate"), Iterations, NumBenchmarkSamples, [&]
+	{
+		FMnemonic::Generate(NumBenchmarkSamples, FMnemonic::MaxWords, Generated);
+	});
+}
+
+static FAutoConsoleCommand MnemonicBenchmarkCommand(
+	TEXT("Solana.Benchmark.Mnemonic"),
+	TEXT("Times 24 word BIP39 sentence encoding, checking and generation, one by one and batched. Optional argument: iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkMnemonic));
+
+#endif
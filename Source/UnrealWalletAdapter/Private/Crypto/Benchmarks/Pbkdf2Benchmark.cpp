@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/Pbkdf2Sha512.h"
+
+static void BenchmarkPbkdf2(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 256);
+
+	// Passphrases tried against one mnemonic, the shape of a passphrase recovery.
+	const FString Mnemonic = TEXT("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about");
+	const FTCHARToUTF8 MnemonicUtf8(*Mnemonic);
+	TArray<TArray<uint8>> Passwords;
+	Passwords.Emplace(reinterpret_cast<const uint8*>(MnemonicUtf8.Get()), MnemonicUtf8.Length());
+	TArray<TArray<uint8>> Salts;
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		const FTCHARToUTF8 Salt(*FString::Printf(TEXT("mnemonicpassphrase%d"), I));
+		Salts.Emplace(reinterpret_cast<const uint8*>(Salt.Get()), Salt.Length());
+	}
+
+	RunBenchmark(TEXT("FCryptoUtils::GenerateSeed"), Iterations, [&](int32 Sample)
+	{
+		return FCryptoUtils::GenerateSeed(MnemonicUtf8.Get(), MnemonicUtf8.Length(), Salts[Sample].GetData(), Salts[Sample].Num())[0];
+	});
+
+	TArray<uint8> Seeds;
+	Seeds.SetNumUninitialized(NumBenchmarkSamples * FPbkdf2Sha512::Bip39SeedSize);
+	RunBatchBenchmark(TEXT("DeriveKeys (one thread)"), Iterations, NumBenchmarkSamples, [&]
+	{
+		FPbkdf2Sha512::DeriveKeys(Passwords, Salts, FPbkdf2Sha512::Bip39Iterations, Seeds.GetData(), MAX_int32);
+	});
+	RunBatchBenchmark(TEXT("DeriveKeys"), Iterations, NumBenchmarkSamples, [&]
+	{
+		FPbkdf2Sha512::DeriveKeys(Passwords, Salts, FPbkdf2Sha512::Bip39Iterations, Seeds.GetData());
+	});
+}
+
+static FAutoConsoleCommand Pbkdf2BenchmarkCommand(
+	TEXT("Solana.Benchmark.Pbkdf2"),
+	TEXT("Times BIP39 mnemonic to seed derivation, one seed at a time and batched on one and all threads. Optional argument: seeds."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkPbkdf2));
+
+#endif
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/ProgramAddress.h"
+
+static void BenchmarkProgramAddress(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 10000);
+
+	// Associated token account shaped requests: wallet, token program, mint.
+	TArray<FProgramAddress::FRequest> Requests;
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		FProgramAddress::FRequest& Request = Requests.AddDefaulted_GetRef();
+		for (int32 Seed = 0; Seed < 3; Seed++)
+		{
+			TArray<uint8>& Bytes = Request.Seeds.AddDefaulted_GetRef();
+			Bytes.SetNumUninitialized(32);
+			for (uint8& Byte : Bytes)
+			{
+				Byte = static_cast<uint8>(FMath::RandHelper(256));
+			}
+		}
+		Request.ProgramId = Request.Seeds[1];
+	}
+
+	TArray<uint8> Address;
+	uint8 Bump = 0;
+	RunBenchmark(TEXT("Find (uncached)"), Iterations, [&](int32 Sample)
+	{
+		if (Sample == 0)
+		{
+			FProgramAddress::EmptyCache();
+		}
+		FProgramAddress::Find(Requests[Sample].Seeds, Requests[Sample].ProgramId, Address, Bump);
+		return Bump;
+	});
+	RunBenchmark(TEXT("Find (cached)"), Iterations, [&](int32 Sample)
+	{
+		FProgramAddress::Find(Requests[Sample].Seeds, Requests[Sample].ProgramId, Address, Bump);
+		return Bump;
+	});
+
+	TArray<FProgramAddress::FResult> Results;
+	RunBatchBenchmark(TEXT("Find (batch, uncached)"), Iterations, NumBenchmarkSamples, [&]
+	{
+		FProgramAddress::EmptyCache();
+		FProgramAddress::Find(Requests, Results);
+	});
+}
+
+static FAutoConsoleCommand ProgramAddressBenchmarkCommand(
+	TEXT("Solana.Benchmark.ProgramAddress"),
+	TEXT("Times program derived address searches, cold, cached and batched. Optional argument: iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkProgramAddress));
+
+#endif
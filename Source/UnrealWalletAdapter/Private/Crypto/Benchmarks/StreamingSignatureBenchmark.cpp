@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/StreamingSignature.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+static void BenchmarkStreamingSignature(const TArray<FString>& Args)
+{
+	const int32 SizeMB = GetBenchmarkCount(Args, 256);
+
+	// A file of random megabytes, written a megabyte at a time so it is never whole in memory either.
+	const FString Filename = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("StreamingSignature"), TEXT(".bin"));
+	{
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+		if (!Writer.IsValid())
+		{
+			UE_LOG(LogCryptoBenchmarks, Error, TEXT("Could not create %s"), *Filename);
+			return;
+		}
+		TArray<uint8> Block;
+		Block.SetNumUninitialized(1024 * 1024);
+		for (int32 I = 0; I < SizeMB; I++)
+		{
+			for (uint8& Byte : Block)
+			{
+				Byte = static_cast<uint8>(FMath::RandHelper(256));
+			}
+			Writer->Serialize(Block.GetData(), Block.Num());
+		}
+	}
+
+	TArray<uint8> Seed;
+	Seed.SetNumUninitialized(32);
+	for (uint8& Byte : Seed)
+	{
+		Byte = static_cast<uint8>(FMath::RandHelper(256));
+	}
+	TArray<uint8> PublicKey;
+	PublicKey.SetNumUninitialized(32);
+	TArray<uint8> PrivateKey;
+	PrivateKey.SetNumUninitialized(64);
+	FCryptoUtils::GenerateKeyPair(Seed, PublicKey, PrivateKey);
+
+	const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+	TArray<uint8> Signature;
+	double StartTime = FPlatformTime::Seconds();
+	const bool bSigned = FStreamingSignature::SignFile(Filename, PrivateKey, Signature);
+	const double SignSeconds = FPlatformTime::Seconds() - StartTime;
+	StartTime = FPlatformTime::Seconds();
+	const bool bVerified = bSigned && FStreamingSignature::VerifyFile(Filename, Signature, PublicKey);
+	const double VerifySeconds = FPlatformTime::Seconds() - StartTime;
+	const int64 UsedGrowth = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(UsedBefore);
+
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f MB/s (%s)"), TEXT("SignFile"), SizeMB / SignSeconds, bSigned ? TEXT("signed") : TEXT("FAILED"));
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f MB/s (%s)"), TEXT("VerifyFile"), SizeMB / VerifySeconds, bVerified ? TEXT("valid") : TEXT("FAILED"));
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%d MB file, resident memory %+.1f MB after both"), SizeMB, UsedGrowth / (1024.0 * 1024.0));
+
+	IFileManager::Get().Delete(*Filename);
+}
+
+static FAutoConsoleCommand StreamingSignatureBenchmarkCommand(
+	TEXT("Solana.Benchmark.StreamingSignature"),
+	TEXT("Times signing and verifying a file through FStreamingSignature and reports the memory it kept. Optional argument: file size in MB."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkStreamingSignature));
+
+#endif
@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Crypto/Base58.h"
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/VanityGrinder.h"
+
+static void BenchmarkVanityGrinder(const TArray<FString>& Args)
+{
+	const double Seconds = Args.Num() > 0 ? FMath::Max(FCString::Atod(*Args[0]), 0.1) : 5.0;
+
+	// What a search built on keypair generation pays per key.
+	TArray<uint8> Seed;
+	Seed.SetNumUninitialized(32);
+	TArray<uint8> PublicKey;
+	PublicKey.SetNumUninitialized(32);
+	TArray<uint8> PrivateKey;
+	PrivateKey.SetNumUninitialized(64);
+	RunBenchmark(TEXT("GenerateKeyPair + base58"), 10000, [&](int32 Sample)
+	{
+		Seed[0] = static_cast<uint8>(Sample);
+		FCryptoUtils::GenerateKeyPair(Seed, PublicKey, PrivateKey);
+		ANSICHAR Encoded[FBase58::GetMaxEncodedLength(32)];
+		return FBase58::EncodeFixed<32>(PublicKey.GetData(), Encoded);
+	});
+
+	// A prefix long enough not to be found, so the searches run for the whole time.
+	FVanityGrinder::FSettings Settings;
+	Settings.Prefix = TEXT("zzzzzzzz");
+	Settings.MaxSeconds = Seconds;
+	TArray<FVanityGrinder::FResult> Results;
+	FVanityGrinder::FStats OneWorker;
+	Settings.NumWorkers = 1;
+	FVanityGrinder::Grind(Settings, Results, &OneWorker);
+	FVanityGrinder::FStats AllWorkers;
+	Settings.NumWorkers = 0;
+	FVanityGrinder::Grind(Settings, Results, &AllWorkers);
+
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f ns/key (%.0f keys/s)"), TEXT("Grind (one worker)"), 1e9 / OneWorker.GetKeysPerSecond(), OneWorker.GetKeysPerSecond());
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%-24s %10.1f ns/key (%.0f keys/s)"), TEXT("Grind (all workers)"), 1e9 / AllWorkers.GetKeysPerSecond(), AllWorkers.GetKeysPerSecond());
+}
+
+static FAutoConsoleCommand VanityGrinderBenchmarkCommand(
+	TEXT("Solana.Benchmark.VanityGrinder"),
+	TEXT("Times a vanity address search on one and on all workers against keypair generation. Optional argument: seconds per search."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkVanityGrinder));
+
+#endif
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Benchmarks/CryptoBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Async/ParallelFor.h"
+#include "Crypto/VerificationCache.h"
+#include "Crypto/ed25519/ed25519.h"
+
+static void BenchmarkVerificationCache(const TArray<FString>& Args)
+{
+	const int32 Iterations = GetBenchmarkCount(Args, 100000);
+
+	// Transaction sized payloads, each signed with its own key.
+	static constexpr int32 MessageSize = 256;
+	TArray<uint8> Messages;
+	Messages.SetNumUninitialized(NumBenchmarkSamples * MessageSize);
+	for (uint8& Byte : Messages)
+	{
+		Byte = static_cast<uint8>(FMath::RandHelper(256));
+	}
+	TArray<uint8> PublicKeys;
+	TArray<uint8> Signatures;
+	PublicKeys.SetNumUninitialized(NumBenchmarkSamples * 32);
+	Signatures.SetNumUninitialized(NumBenchmarkSamples * 64);
+	for (int32 I = 0; I < NumBenchmarkSamples; I++)
+	{
+		uint8 PrivateKey[64];
+		ed25519_create_keypair(&PublicKeys[I * 32], PrivateKey, &Messages[I * MessageSize]);
+		ed25519_sign(&Signatures[I * 64], &Messages[I * MessageSize], MessageSize, PrivateKey);
+	}
+
+	RunBenchmark(TEXT("ed25519_verify"), FMath::Max(Iterations / 100, NumBenchmarkSamples), [&](int32 Sample)
+	{
+		return ed25519_verify(&Signatures[Sample * 64], &Messages[Sample * MessageSize], MessageSize, &PublicKeys[Sample * 32]);
+	});
+
+	FVerificationCache::Empty();
+	FVerificationCache::ResetStats();
+	RunBatchBenchmark(TEXT("Verify (miss)"), NumBenchmarkSamples, NumBenchmarkSamples, [&]
+	{
+		for (int32 I = 0; I < NumBenchmarkSamples; I++)
+		{
+			FVerificationCache::Verify(&Signatures[I * 64], &Messages[I * MessageSize], MessageSize, &PublicKeys[I * 32]);
+		}
+	});
+	RunBenchmark(TEXT("Verify (hit)"), Iterations, [&](int32 Sample)
+	{
+		return FVerificationCache::Verify(&Signatures[Sample * 64], &Messages[Sample * MessageSize], MessageSize, &PublicKeys[Sample * 32]);
+	});
+	RunBatchBenchmark(TEXT("Verify (hit, all)"), Iterations, Iterations, [&]
+	{
+		ParallelFor(Iterations, [&](int32 Index)
+		{
+			const int32 Sample = Index % NumBenchmarkSamples;
+			FVerificationCache::Verify(&Signatures[Sample * 64], &Messages[Sample * MessageSize], MessageSize, &PublicKeys[Sample * 32]);
+		});
+	});
+
+	const FVerificationCache::FStats Stats = FVerificationCache::GetStats();
+	UE_LOG(LogCryptoBenchmarks, Display, TEXT("%lld hits, %lld misses, %.1f%% hit rate"), Stats.Hits, Stats.Misses, Stats.GetHitRate() * 100.0);
+}
+
+static FAutoConsoleCommand VerificationCacheBenchmarkCommand(
+	TEXT("Solana.Benchmark.VerificationCache"),
+	TEXT("Times verification against cache misses and hits, on one and on all workers. Optional argument: iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkVerificationCache));
+
+#endif
@@ -0,0 +1,562 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+// The BIP39 English wordlist, SHA-256 2f5eed53a4727b4bf8880d8f3f199efc90e58503646d9ff8eff3a2ed3b24dbda as a
+// newline terminated file, and the perfect hash of it that FMnemonic looks words up with. Generated, the
+// displacements were searched for greedily, largest bucket first, for the hash in Mnemonic.cpp.
+
+static constexpr uint32 Bip39WordHashMultiplier = 0x9E3779B1;
+
+static const ANSICHAR* const Bip39Words[2048] = {
+	"abandon", "ability", "able", "about", "above", "absent", "absorb", "abstract",
+	"absurd", "abuse", "access", "accident", "account", "accuse", "achieve", "acid",
+	"acoustic", "acquire", "across", "act", "action", "actor", "actress", "actual",
+	"adapt", "add", "addict", "address", "adjust", "admit", "adult", "advance",
+	"advice", "aerobic", "affair", "afford", "afraid", "again", "age", "agent",
+	"agree", "ahead", "aim", "air", "airport", "aisle", "alarm", "album",
+	"alcohol", "alert", "alien", "all", "alley", "allow", "almost", "alone",
+	"alpha", "already", "also", "alter", "always", "amateur", "amazing", "among",
+	"amount", "amused", "analyst", "anchor", "ancient", "anger", "angle", "angry",
+	"animal", "ankle", "announce", "annual", "another", "answer", "antenna", "antique",
+	"anxiety", "any", "apart", "apology", "appear", "apple", "approve", "april",
+	"arch", "arctic", "area", "arena", "argue", "arm", "armed", "armor",
+	"army", "around", "arrange", "arrest", "arrive", "arrow", "art", "artefact",
+	"artist", "artwork", "ask", "aspect", "assault", "asset", "assist", "assume",
+	"asthma", "athlete", "atom", "attack", "attend", "attitude", "attract", "auction",
+	"audit", "august", "aunt", "author", "auto", "autumn", "average", "avocado",
+	"avoid", "awake", "aware", "away", "awesome", "awful", "awkward", "axis",
+	"baby", "bachelor", "bacon", "badge", "bag", "balance", "balcony", "ball",
+	"bamboo", "banana", "banner", "bar", "barely", "bargain", "barrel", "base",
+	"basic", "basket", "battle", "beach", "bean", "beauty", "because", "become",
+	"beef", "before", "begin", "behave", "behind", "believe", "below", "belt",
+	"bench", "benefit", "best", "betray", "better", "between", "beyond", "bicycle",
+	"bid", "bike", "bind", "biology", "bird", "birth", "bitter", "black",
+	"blade", "blame", "blanket", "blast", "bleak", "bless", "blind", "blood",
+	"blossom", "blouse", "blue", "blur", "blush", "board", "boat", "body",
+	"boil", "bomb", "bone", "bonus", "book", "boost", "border", "boring",
+	"borrow", "boss", "bottom", "bounce", "box", "boy", "bracket", "brain",
+	"brand", "brass", "brave", "bread", "breeze", "brick", "bridge", "brief",
+	"bright", "bring", "brisk", "broccoli", "broken", "bronze", "broom", "brother",
+	"brown", "brush", "bubble", "buddy", "budget", "buffalo", "build", "bulb",
+	"bulk", "bullet", "bundle", "bunker", "burden", "burger", "burst", "bus",
+	"business", "busy", "butter", "buyer", "buzz", "cabbage", "cabin", "cable",
+	"cactus", "cage", "cake", "call", "calm", "camera", "camp", "can",
+	"canal", "cancel", "candy", "cannon", "canoe", "canvas", "canyon", "capable",
+	"capital", "captain", "car", "carbon", "card", "cargo", "carpet", "carry",
+	"cart", "case", "cash", "casino", "castle", "casual", "cat", "catalog",
+	"catch", "category", "cattle", "caught", "cause", "caution", "cave", "ceiling",
+	"celery", "cement", "census", "century", "cereal", "certain", "chair", "chalk",
+	"champion", "change", "chaos", "chapter", "charge", "chase", "chat", "cheap",
+	"check", "cheese", "chef", "cherry", "chest", "chicken", "chief", "child",
+	"chimney", "choice", "choose", "chronic", "chuckle", "chunk", "churn", "cigar",
+	"cinnamon", "circle", "citizen", "city", "civil", "claim", "clap", "clarify",
+	"claw", "clay", "clean", "clerk", "clever", "click", "client", "cliff",
+	"climb", "clinic", "clip", "clock", "clog", "close", "cloth", "cloud",
+	"clown", "club", "clump", "cluster", "clutch", "coach", "coast", "coconut",
+	"code", "coffee", "coil", "coin", "collect", "color", "column", "combine",
+	"come", "comfort", "comic", "common", "company", "concert", "conduct", "confirm",
+	"congress", "connect", "consider", "control", "convince", "cook", "cool", "copper",
+	"copy", "coral", "core", "corn", "correct", "cost", "cotton", "couch",
+	"country", "couple", "course", "cousin", "cover", "coyote", "crack", "cradle",
+	"craft", "cram", "crane", "crash", "crater", "crawl", "crazy", "cream",
+	"credit", "creek", "crew", "cricket", "crime", "crisp", "critic", "crop",
+	"cross", "crouch", "crowd", "crucial", "cruel", "cruise", "crumble", "crunch",
+	"crush", "cry", "crystal", "cube", "culture", "cup", "cupboard", "curious",
+	"current", "curtain", "curve", "cushion", "custom", "cute", "cycle", "dad",
+	"damage", "damp", "dance", "danger", "daring", "dash", "daughter", "dawn",
+	"day", "deal", "debate", "debris", "decade", "december", "decide", "decline",
+	"decorate", "decrease", "deer", "defense", "define", "defy", "degree", "delay",
+	"deliver", "demand", "demise", "denial", "dentist", "deny", "depart", "depend",
+	"deposit", "depth", "deputy", "derive", "describe", "desert", "design", "desk",
+	"despair", "destroy", "detail", "detect", "develop", "device", "devote", "diagram",
+	"dial", "diamond", "diary", "dice", "diesel", "diet", "differ", "digital",
+	"dignity", "dilemma", "dinner", "dinosaur", "direct", "dirt", "disagree", "discover",
+	"disease", "dish", "dismiss", "disorder", "display", "distance", "divert", "divide",
+	"divorce", "dizzy", "doctor", "document", "dog", "doll", "dolphin", "domain",
+	"donate", "donkey", "donor", "door", "dose", "double", "dove", "draft",
+	"dragon", "drama", "drastic", "draw", "dream", "dress", "drift", "drill",
+	"drink", "drip", "drive", "drop", "drum", "dry", "duck", "dumb",
+	"dune", "during", "dust", "dutch", "duty", "dwarf", "dynamic", "eager",
+	"eagle", "early", "earn", "earth", "easily", "east", "easy", "echo",
+	"ecology", "economy", "edge", "edit", "educate", "effort", "egg", "eight",
+	"either", "elbow", "elder", "electric", "elegant", "element", "elephant", "elevator",
+	"elite", "else", "embark", "embody", "embrace", "emerge", "emotion", "employ",
+	"empower", "empty", "enable", "enact", "end", "endless", "endorse", "enemy",
+	"energy", "enforce", "engage", "engine", "enhance", "enjoy", "enlist", "enough",
+	"enrich", "enroll", "ensure", "enter", "entire", "entry", "envelope", "episode",
+	"equal", "equip", "era", "erase", "erode", "erosion", "error", "erupt",
+	"escape", "essay", "essence", "estate", "eternal", "ethics", "evidence", "evil",
+	"evoke", "evolve", "exact", "example", "excess", "exchange", "excite", "exclude",
+	"excuse", "execute", "exercise", "exhaust", "exhibit", "exile", "exist", "exit",
+	"exotic", "expand", "expect", "expire", "explain", "expose", "express", "extend",
+	"extra", "eye", "eyebrow", "fabric", "face", "faculty", "fade", "faint",
+	"faith", "fall", "false", "fame", "family", "famous", "fan", "fancy",
+	"fantasy", "farm", "fashion", "fat", "fatal", "father", "fatigue", "fault",
+	"favorite", "feature", "february", "federal", "fee", "feed", "feel", "female",
+	"fence", "festival", "fetch", "fever", "few", "fiber", "fiction", "field",
+	"figure", "file", "film", "filter", "final", "find", "fine", "finger",
+	"finish", "fire", "firm", "first", "fiscal", "fish", "fit", "fitness",
+	"fix", "flag", "flame", "flash", "flat", "flavor", "flee", "flight",
+	"flip", "float", "flock", "floor", "flower", "fluid", "flush", "fly",
+	"foam", "focus", "fog", "foil", "fold", "follow", "food", "foot",
+	"force", "forest", "forget", "fork", "fortune", "forum", "forward", "fossil",
+	"foster", "found", "fox", "fragile", "frame", "frequent", "fresh", "friend",
+	"fringe", "frog", "front", "frost", "frown", "frozen", "fruit", "fuel",
+	"fun", "funny", "furnace", "fury", "future", "gadget", "gain", "galaxy",
+	"gallery", "game", "gap", "garage", "garbage", "garden", "garlic", "garment",
+	"gas", "gasp", "gate", "gather", "gauge", "gaze", "general", "genius",
+	"genre", "gentle", "genuine", "gesture", "ghost", "giant", "gift", "giggle",
+	"ginger", "giraffe", "girl", "give", "glad", "glance", "glare", "glass",
+	"glide", "glimpse", "globe", "gloom", "glory", "glove", "glow", "glue",
+	"goat", "goddess", "gold", "good", "goose", "gorilla", "gospel", "gossip",
+	"govern", "gown", "grab", "grace", "grain", "grant", "grape", "grass",
+	"gravity", "great", "green", "grid", "grief", "grit", "grocery", "group",
+	"grow", "grunt", "guard", "guess", "guide", "guilt", "guitar", "gun",
+	"gym", "habit", "hair", "half", "hammer", "hamster", "hand", "happy",
+	"harbor", "hard", "harsh", "harvest", "hat", "have", "hawk", "hazard",
+	"head", "health", "heart", "heavy", "hedgehog", "height", "hello", "helmet",
+	"help", "hen", "hero", "hidden", "high", "hill", "hint", "hip",
+	"hire", "history", "hobby", "hockey", "hold", "hole", "holiday", "hollow",
+	"home", "honey", "hood", "hope", "horn", "horror", "horse", "hospital",
+	"host", "hotel", "hour", "hover", "hub", "huge", "human", "humble",
+	"humor", "hundred", "hungry", "hunt", "hurdle", "hurry", "hurt", "husband",
+	"hybrid", "ice", "icon", "idea", "identify", "idle", "ignore", "ill",
+	"illegal", "illness", "image", "imitate", "immense", "immune", "impact", "impose",
+	"improve", "impulse", "inch", "include", "income", "increase", "index", "indicate",
+	"indoor", "industry", "infant", "inflict", "inform", "inhale", "inherit", "initial",
+	"inject", "injury", "inmate", "inner", "innocent", "input", "inquiry", "insane",
+	"insect", "inside", "inspire", "install", "intact", "interest", "into", "invest",
+	"invite", "involve", "iron", "island", "isolate", "issue", "item", "ivory",
+	"jacket", "jaguar", "jar", "jazz", "jealous", "jeans", "jelly", "jewel",
+	"job", "join", "joke", "journey", "joy", "judge", "juice", "jump",
+	"jungle", "junior", "junk", "just", "kangaroo", "keen", "keep", "ketchup",
+	"key", "kick", "kid", "kidney", "kind", "kingdom", "kiss", "kit",
+	"kitchen", "kite", "kitten", "kiwi", "knee", "knife", "knock", "know",
+	"lab", "label", "labor", "ladder", "lady", "lake", "lamp", "language",
+	"laptop", "large", "later", "latin", "laugh", "laundry", "lava", "law",
+	"lawn", "lawsuit", "layer", "lazy", "leader", "leaf", "learn", "leave",
+	"lecture", "left", "leg", "legal", "legend", "leisure", "lemon", "lend",
+	"length", "lens", "leopard", "lesson", "letter", "level", "liar", "liberty",
+	"library", "license", "life", "lift", "light", "like", "limb", "limit",
+	"link", "lion", "liquid", "list", "little", "live", "lizard", "load",
+	"loan", "lobster", "local", "lock", "logic", "lonely", "long", "loop",
+	"lottery", "loud", "lounge", "love", "loyal", "lucky", "luggage", "lumber",
+	"lunar", "lunch", "luxury", "lyrics", "machine", "mad", "magic", "magnet",
+	"maid", "mail", "main", "major", "make", "mammal", "man", "manage",
+	"mandate", "mango", "mansion", "manual", "maple", "marble", "march", "margin",
+	"marine", "market", "marriage", "mask", "mass", "master", "match", "material",
+	"math", "matrix", "matter", "maximum", "maze", "meadow", "mean", "measure",
+	"meat", "mechanic", "medal", "media", "melody", "melt", "member", "memory",
+	"mention", "menu", "mercy", "merge", "merit", "merry", "mesh", "message",
+	"metal", "method", "middle", "midnight", "milk", "million", "mimic", "mind",
+	"minimum", "minor", "minute", "miracle", "mirror", "misery", "miss", "mistake",
+	"mix", "mixed", "mixture", "mobile", "model", "modify", "mom", "moment",
+	"monitor", "monkey", "monster", "month", "moon", "moral", "more", "morning",
+	"mosquito", "mother", "motion", "motor", "mountain", "mouse", "move", "movie",
+	"much", "muffin", "mule", "multiply", "muscle", "museum", "mushroom", "music",
+	"must", "mutual", "myself", "mystery", "myth", "naive", "name", "napkin",
+	"narrow", "nasty", "nation", "nature", "near", "neck", "need", "negative",
+	"neglect", "neither", "nephew", "nerve", "nest", "net", "network", "neutral",
+	"never", "news", "next", "nice", "night", "noble", "noise", "nominee",
+	"noodle", "normal", "north", "nose", "notable", "note", "nothing", "notice",
+	"novel", "now", "nuclear", "number", "nurse", "nut", "oak", "obey",
+	"object", "oblige", "obscure", "observe", "obtain", "obvious", "occur", "ocean",
+	"october", "odor", "off", "offer", "office", "often", "oil", "okay",
+	"old", "olive", "olympic", "omit", "once", "one", "onion", "online",
+	"only", "open", "opera", "opinion", "oppose", "option", "orange", "orbit",
+	"orchard", "order", "ordinary", "organ", "orient", "original", "orphan", "ostrich",
+	"other", "outdoor", "outer", "output", "outside", "oval", "oven", "over",
+	"own", "owner", "oxygen", "oyster", "ozone", "pact", "paddle", "page",
+	"pair", "palace", "palm", "panda", "panel", "panic", "panther", "paper",
+	"parade", "parent", "park", "parrot", "party", "pass", "patch", "path",
+	"patient", "patrol", "pattern", "pause", "pave", "payment", "peace", "peanut",
+	"pear", "peasant", "pelican", "pen", "penalty", "pencil", "people", "pepper",
+	"perfect", "permit", "person", "pet", "phone", "photo", "phrase", "physical",
+	"piano", "picnic", "picture", "piece", "pig", "pigeon", "pill", "pilot",
+	"pink", "pioneer", "pipe", "pistol", "pitch", "pizza", "place", "planet",
+	"plastic", "plate", "play", "please", "pledge", "pluck", "plug", "plunge",
+	"poem", "poet", "point", "polar", "pole", "police", "pond", "pony",
+	"pool", "popular", "portion", "position", "possible", "post", "potato", "pottery",
+	"poverty", "powder", "power", "practice", "praise", "predict", "prefer", "prepare",
+	"present", "pretty", "prevent", "price", "pride", "primary", "print", "priority",
+	"prison", "private", "prize", "problem", "process", "produce", "profit", "program",
+	"project", "promote", "proof", "property", "prosper", "protect", "proud", "provide",
+	"public", "pudding", "pull", "pulp", "pulse", "pumpkin", "punch", "pupil",
+	"puppy", "purchase", "purity", "purpose", "purse", "push", "put", "puzzle",
+	"pyramid", "quality", "quantum", "quarter", "question", "quick", "quit", "quiz",
+	"quote", "rabbit", "raccoon", "race", "rack", "radar", "radio", "rail",
+	"rain", "raise", "rally", "ramp", "ranch", "random", "range", "rapid",
+	"rare", "rate", "rather", "raven", "raw", "razor", "ready", "real",
+	"reason", "rebel", "rebuild", "recall", "receive", "recipe", "record", "recycle",
+	"reduce", "reflect", "reform", "refuse", "region", "regret", "regular", "reject",
+	"relax", "release", "relief", "rely", "remain", "remember", "remind", "remove",
+	"render", "renew", "rent", "reopen", "repair", "repeat", "replace", "report",
+	"require", "rescue", "resemble", "resist", "resource", "response", "result", "retire",
+	"retreat", "return", "reunion", "reveal", "review", "reward", "rhythm", "rib",
+	"ribbon", "rice", "rich", "ride", "ridge", "rifle", "right", "rigid",
+	"ring", "riot", "ripple", "risk", "ritual", "rival", "river", "road",
+	"roast", "robot", "robust", "rocket", "romance", "roof", "rookie", "room",
+	"rose", "rotate", "rough", "round", "route", "royal", "rubber", "rude",
+	"rug", "rule", "run", "runway", "rural", "sad", "saddle", "sadness",
+	"safe", "sail", "salad", "salmon", "salon", "salt", "salute", "same",
+	"sample", "sand", "satisfy", "satoshi", "sauce", "sausage", "save", "say",
+	"scale", "scan", "scare", "scatter", "scene", "scheme", "school", "science",
+	"scissors", "scorpion", "scout", "scrap", "screen", "script", "scrub", "sea",
+	"search", "season", "seat", "second", "secret", "section", "security", "seed",
+	"seek", "segment", "select", "sell", "seminar", "senior", "sense", "sentence",
+	"series", "service", "session", "settle", "setup", "seven", "shadow", "shaft",
+	"shallow", "share", "shed", "shell", "sheriff", "shield", "shift", "shine",
+	"ship", "shiver", "shock", "shoe", "shoot", "shop", "short", "shoulder",
+	"shove", "shrimp", "shrug", "shuffle", "shy", "sibling", "sick", "side",
+	"siege", "sight", "sign", "silent", "silk", "silly", "silver", "similar",
+	"simple", "since", "sing", "siren", "sister", "situate", "six", "size",
+	"skate", "sketch", "ski", "skill", "skin", "skirt", "skull", "slab",
+	"slam", "sleep", "slender", "slice", "slide", "slight", "slim", "slogan",
+	"slot", "slow", "slush", "small", "smart", "smile", "smoke", "smooth",
+	"snack", "snake", "snap", "sniff", "snow", "soap", "soccer", "social",
+	"sock", "soda", "soft", "solar", "soldier", "solid", "solution", "solve",
+	"someone", "song", "soon", "sorry", "sort", "soul", "sound", "soup",
+	"source", "south", "space", "spare", "spatial", "spawn", "speak", "special",
+	"speed", "spell", "spend", "sphere", "spice", "spider", "spike", "spin",
+	"spirit", "split", "spoil", "sponsor", "spoon", "sport", "spot", "spray",
+	"spread", "spring", "spy", "square", "squeeze", "squirrel", "stable", "stadium",
+	"staff", "stage", "stairs", "stamp", "stand", "start", "state", "stay",
+	"steak", "steel", "stem", "step", "stereo", "stick", "still", "sting",
+	"stock", "stomach", "stone", "stool", "story", "stove", "strategy", "street",
+	"strike", "strong", "struggle", "student", "stuff", "stumble", "style", "subject",
+	"submit", "subway", "success", "such", "sudden", "suffer", "sugar", "suggest",
+	"suit", "summer", "sun", "sunny", "sunset", "super", "supply", "supreme",
+	"sure", "surface", "surge", "surprise", "surround", "survey", "suspect", "sustain",
+	"swallow", "swamp", "swap", "swarm", "swear", "sweet", "swift", "swim",
+	"swing", "switch", "sword", "symbol", "symptom", "syrup", "system", "table",
+	"tackle", "tag", "tail", "talent", "talk", "tank", "tape", "target",
+	"task", "taste", "tattoo", "taxi", "teach", "team", "tell", "ten",
+	"tenant", "tennis", "tent", "term", "test", "text", "thank", "that",
+	"theme", "then", "theory", "there", "they", "thing", "this", "thought",
+	"three", "thrive", "throw", "thumb", "thunder", "ticket", "tide", "tiger",
+	"tilt", "timber", "time", "tiny", "tip", "tired", "tissue", "title",
+	"toast", "tobacco", "today", "toddler", "toe", "together", "toilet", "token",
+	"tomato", "tomorrow", "tone", "tongue", "tonight", "tool", "tooth", "top",
+	"topic", "topple", "torch", "tornado", "tortoise", "toss", "total", "tourist",
+	"toward", "tower", "town", "toy", "track", "trade", "traffic", "tragic",
+	"train", "transfer", "trap", "trash", "travel", "tray", "treat", "tree",
+	"trend", "trial", "tribe", "trick", "trigger", "trim", "trip", "trophy",
+	"trouble", "truck", "true", "truly", "trumpet", "trust", "truth", "try",
+	"tube", "tuition", "tumble", "tuna", "tunnel", "turkey", "turn", "turtle",
+	"twelve", "twenty", "twice", "twin", "twist", "two", "type", "typical",
+	"ugly", "umbrella", "unable", "unaware", "uncle", "uncover", "under", "undo",
+	"unfair", "unfold", "unhappy", "uniform", "unique", "unit", "universe", "unknown",
+	"unlock", "until", "unusual", "unveil", "update", "upgrade", "uphold", "upon",
+	"upper", "upset", "urban", "urge", "usage", "use", "used", "useful",
+	"useless", "usual", "utility", "vacant", "vacuum", "vague", "valid", "valley",
+	"valve", "van", "vanish", "vapor", "various", "vast", "vault", "vehicle",
+	"velvet", "vendor", "venture", "venue", "verb", "verify", "version", "very",
+	"vessel", "veteran", "viable", "vibrant", "vicious", "victory", "video", "view",
+	"village", "vintage", "violin", "virtual", "virus", "visa", "visit", "visual",
+	"vital", "vivid", "vocal", "voice", "void", "volcano", "volume", "vote",
+	"voyage", "wage", "wagon", "wait", "walk", "wall", "walnut", "want",
+	"warfare", "warm", "warrior", "wash", "wasp", "waste", "water", "wave",
+	"way", "wealth", "weapon", "wear", "weasel", "weather", "web", "wedding",
+	"weekend", "weird", "welcome", "west", "wet", "whale", "what", "wheat",
+	"wheel", "when", "where", "whip", "whisper", "wide", "width", "wife",
+	"wild", "will", "win", "window", "wine", "wing", "wink", "winner",
+	"winter", "wire", "wisdom", "wise", "wish", "witness", "wolf", "woman",
+	"wonder", "wood", "wool", "word", "work", "world", "worry", "worth",
+	"wrap", "wreck", "wrestle", "wrist", "write", "wrong", "yard", "year",
+	"yellow", "you", "young", "youth", "zebra", "zero", "zone", "zoo",
+};
+
+static const uint16 Bip39WordDisplacements[512] = {
+	0x0001, 0x0000, 0x0001, 0x0000, 0x0001, 0x0000, 0x0001, 0x0000, 0x0004, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+	0x0000, 0x0000, 0x0003, 0x0000, 0x0003, 0x0002, 0x000B, 0x0000, 0x0000, 0x0005, 0x0001, 0x0003, 0x0000, 0x0001, 0x0007, 0x0002,
+	0x0000, 0x0006, 0x0000, 0x0001, 0x0003, 0x0000, 0x0002, 0x0000, 0x0001, 0x0006, 0x0000, 0x0002, 0x0000, 0x0001, 0x0000, 0x0000,
+	0x0004, 0x0000, 0x0000, 0x0005, 0x0000, 0x0005, 0x0003, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0005,
+	0x0000, 0x0000, 0x0009, 0x0001, 0x000D, 0x0000, 0x0009, 0x0003, 0x0009, 0x0002, 0x0001, 0x0005, 0x0005, 0x0001, 0x0007, 0x0010,
+	0x0000, 0x0013, 0x0005, 0x0000, 0x000D, 0x0000, 0x0001, 0x0002, 0x0000, 0x0003, 0x0000, 0x000A, 0x0009, 0x0005, 0x0002, 0x0001,
+	0x0003, 0x0000, 0x0002, 0x0002, 0x0000, 0x000B, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 0x0000, 0x0000, 0x0001, 0x0004, 0x000D,
+	0x0003, 0x0004, 0x0000, 0x0008, 0x0002, 0x0001, 0x0000, 0x0004, 0x0000, 0x0007, 0x0000, 0x0002, 0x0000, 0x0000, 0x0001, 0x0004,
+	0x0002, 0x0001, 0x0007, 0x0003, 0x0001, 0x0008, 0x0000, 0x0000, 0x0001, 0x0005, 0x0002, 0x0002, 0x000F, 0x0000, 0x0000, 0x0002,
+	0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0007, 0x0000, 0x0002, 0x0001, 0x0003,
+	0x0000, 0x0002, 0x0000, 0x0002, 0x0001, 0x0002, 0x0002, 0x0002, 0x0007, 0x0000, 0x0005, 0x0000, 0x0000, 0x0004, 0x0004, 0x0001,
+	0x0004, 0x0000, 0x0005, 0x0001, 0x0003, 0x0000, 0x0001, 0x0003, 0x0001, 0x0005, 0x0006, 0x0008, 0x0002, 0x0000, 0x0004, 0x0001,
+	0x0002, 0x0004, 0x0001, 0x0000, 0x0001, 0x0006, 0x0005, 0x0000, 0x0004, 0x0006, 0x0005, 0x0001, 0x0009, 0x0004, 0x0002, 0x0000,
+	0x0001, 0x000B, 0x0000, 0x0000, 0x0003, 0x0002, 0x0001, 0x0001, 0x0007, 0x0003, 0x0001, 0x0001, 0x0005, 0x0000, 0x0001, 0x0002,
+	0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0002, 0x0001, 0x0000, 0x0012, 0x0000, 0x0000, 0x0012, 0x0000, 0x0000, 0x000D, 0x0000,
+	0x0000, 0x0004, 0x0004, 0x0001, 0x0002, 0x0005, 0x0003, 0x0000, 0x000C, 0x0002, 0x0004, 0x0005, 0x0009, 0x0004, 0x0004, 0x0001,
+	0x0000, 0x0001, 0x0003, 0x0003, 0x0001, 0x0001, 0x0002, 0x000B, 0x0000, 0x000B, 0x0004, 0x0004, 0x0000, 0x0005, 0x0006, 0x0004,
+	0x0005, 0x0001, 0x0004, 0x0003, 0x0001, 0x0010, 0x0000, 0x0009, 0x0001, 0x0009, 0x0001, 0x0005, 0x0000, 0x0001, 0x0003, 0x0000,
+	0x0002, 0x000C, 0x0005, 0x0002, 0x0001, 0x0000, 0x0007, 0x0007, 0x0000, 0x0000, 0x0000, 0x0017, 0x0002, 0x0000, 0x0011, 0x0006,
+	0x0009, 0x0002, 0x0000, 0x0007, 0x0002, 0x0000, 0x0003, 0x0005, 0x0003, 0x0003, 0x0004, 0x0002, 0x0003, 0x0000, 0x000B, 0x0003,
+	0x0002, 0x0004, 0x0000, 0x0000, 0x0000, 0x001A, 0x0008, 0x0005, 0x0003, 0x0011, 0x0001, 0x0000, 0x0001, 0x0002, 0x0000, 0x0000,
+	0x0010, 0x0000, 0x0001, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0004, 0x0004, 0x0001, 0x0005, 0x0000,
+	0x0000, 0x0000, 0x0002, 0x0001, 0x0000, 0x0001, 0x0005, 0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0000, 0x0003, 0x0000,
+	0x0000, 0x0002, 0x001A, 0x0001, 0x0000, 0x000A, 0x0001, 0x0013, 0x0003, 0x0000, 0x0008, 0x0003, 0x0001, 0x0001, 0x0007, 0x0000,
+	0x0001, 0x0006, 0x0007, 0x0005, 0x000B, 0x000E, 0x0002, 0x0003, 0x0006, 0x0001, 0x000A, 0x0002, 0x0001, 0x0000, 0x0000, 0x0002,
+	0x0004, 0x0002, 0x0001, 0x0004, 0x0005, 0x0001, 0x0001, 0x0008, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0001, 0x0001, 0x0000,
+	0x0002, 0x0002, 0x000E, 0x0002, 0x0007, 0x0007, 0x0004, 0x000D, 0x0009, 0x0002, 0x0000, 0x0000, 0x0000, 0x0014, 0x0005, 0x0001,
+	0x0008, 0x0002, 0x0008, 0x0009, 0x0000, 0x0000, 0x0004, 0x0001, 0x0002, 0x0002, 0x0002, 0x0004, 0x0004, 0x0000, 0x0000, 0x0002,
+	0x0000, 0x0000, 0x0001, 0x0000, 0x0003, 0x0002, 0x0001, 0x0000, 0x0000, 0x0009, 0x0000, 0x0010, 0x0003, 0x0000, 0x0010, 0x0000,
+	0x0001, 0x0003, 0x0000, 0x0001, 0x0000, 0x0000, 0x0002, 0x0001, 0x0000, 0x0001, 0x0000, 0x000B, 0x0003, 0x0007, 0x0000, 0x0005,
+	0x0003, 0x0009, 0x0000, 0x0001, 0x0000, 0x000E, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0001, 0x0004, 0x0001, 0x0000, 0x0006,
+	0x0000, 0x0001, 0x0006, 0x0007, 0x000A, 0x0005, 0x0001, 0x0005, 0x0001, 0x0000, 0x0007, 0x0004, 0x0000, 0x0002, 0x0006, 0x0010,
+};
+
+static const uint16 Bip39WordSlots[4096] = {
+	0x074F, 0x0130, 0x04F0, 0xFFFF, 0x0042, 0x01FB, 0xFFFF, 0xFFFF, 0x03C3, 0xFFFF, 0xFFFF, 0x053E, 0x03C7, 0x030D, 0xFFFF, 0x00D6,
+	0x04B8, 0x0043, 0xFFFF, 0x016B, 0x03E1, 0x06E8, 0x031B, 0x063F, 0x01A8, 0xFFFF, 0x01FF, 0x03AD, 0xFFFF, 0xFFFF, 0x01ED, 0x06F7,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0139, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0537, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06F4, 0xFFFF,
+	0x0263, 0xFFFF, 0x0171, 0x050F, 0x019E, 0x0669, 0xFFFF, 0xFFFF, 0x006B, 0x0087, 0x02FD, 0xFFFF, 0xFFFF, 0xFFFF, 0x0176, 0x036D,
+	0xFFFF, 0xFFFF, 0x036F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x060F, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C4, 0xFFFF, 0x0731, 0xFFFF, 0xFFFF, 0xFFFF, 0x06DE, 0xFFFF, 0x0583, 0xFFFF, 0x04CE,
+	0x0075, 0x0490, 0x0256, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07DB, 0xFFFF, 0x0385, 0x032A, 0xFFFF, 0xFFFF, 0x0318,
+	0xFFFF, 0x0191, 0x07C8, 0x01AC, 0x0627, 0x03D5, 0xFFFF, 0xFFFF, 0x030B, 0x007D, 0xFFFF, 0xFFFF, 0x06B4, 0x04B2, 0xFFFF, 0x0142,
+	0xFFFF, 0x03CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x01BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0746, 0x0136, 0x05F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x05A0, 0xFFFF, 0xFFFF, 0x0368, 0xFFFF, 0xFFFF, 0x0771, 0x0199, 0xFFFF, 0xFFFF, 0xFFFF, 0x0673, 0xFFFF, 0xFFFF, 0x04A6, 0xFFFF,
+	0x0779, 0xFFFF, 0x06BC, 0x0399, 0x0245, 0x0773, 0x0107, 0x0719, 0x031D, 0x015B, 0xFFFF, 0xFFFF, 0x0322, 0xFFFF, 0x0144, 0xFFFF,
+	0x02E2, 0x0509, 0x0516, 0x01B7, 0x016D, 0xFFFF, 0xFFFF, 0xFFFF, 0x008D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07A7, 0x0173, 0x0487,
+	0x07FF, 0xFFFF, 0xFFFF, 0xFFFF, 0x058F, 0xFFFF, 0xFFFF, 0x0562, 0x0738, 0xFFFF, 0x00AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0266,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0213, 0x0713, 0xFFFF, 0x05A9, 0xFFFF, 0xFFFF, 0xFFFF, 0x011C, 0x0783, 0x0403, 0x0590, 0xFFFF,
+	0x0354, 0xFFFF, 0x038D, 0x00ED, 0x043B, 0x0697, 0xFFFF, 0x06DF, 0x073E, 0x0792, 0x01DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0708,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07DE, 0x0281, 0x0194, 0x01E8, 0x0672, 0x032C, 0x0596, 0x038F, 0x0408, 0x01E4,
+	0xFFFF, 0xFFFF, 0x0242, 0x04A2, 0x00C3, 0xFFFF, 0x07A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CD, 0x0470, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x0554, 0xFFFF, 0x0443, 0xFFFF, 0xFFFF, 0x049D, 0x0331, 0xFFFF, 0xFFFF, 0x05BE, 0x0723, 0x023D, 0xFFFF, 0x06BF,
+	0x04A5, 0xFFFF, 0xFFFF, 0x01A3, 0x06C3, 0x040C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06BD, 0xFFFF, 0x06F9, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x04F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x013C, 0xFFFF, 0x078F, 0x0451, 0x0057, 0x0314, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x03BF, 0xFFFF, 0x079E, 0x078A, 0xFFFF, 0xFFFF, 0x07D3, 0x071B, 0x05CD, 0x03B1, 0x0025, 0xFFFF, 0x0254, 0x0567, 0xFFFF, 0xFFFF,
+	0x0693, 0x00B0, 0x03EF, 0x073A, 0xFFFF, 0x0202, 0x0538, 0x0603, 0xFFFF, 0x0301, 0xFFFF, 0x06AF, 0x060D, 0xFFFF, 0xFFFF, 0x034E,
+	0x066E, 0x03B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0671, 0xFFFF, 0xFFFF, 0x0267, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0321, 0xFFFF, 0x06E1, 0x020E, 0xFFFF, 0x03B8, 0xFFFF, 0x05D7, 0xFFFF, 0x0592, 0x07CB, 0x0550, 0x0681, 0x0634, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0702, 0x0755, 0x032E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0478, 0x0455, 0x00C5, 0xFFFF, 0x06A1, 0xFFFF, 0x021C, 0xFFFF, 0xFFFF,
+	0x0230, 0xFFFF, 0x001D, 0xFFFF, 0xFFFF, 0x0796, 0x0639, 0xFFFF, 0x068B, 0x0229, 0xFFFF, 0xFFFF, 0xFFFF, 0x00FC, 0xFFFF, 0x057E,
+	0x02E4, 0xFFFF, 0x0725, 0x047D, 0x07E4, 0x07CF, 0xFFFF, 0xFFFF, 0x0396, 0x04DB, 0x053F, 0x0218, 0x02F9, 0x062B, 0xFFFF, 0x04ED,
+	0x0106, 0x068C, 0x044F, 0x06D9, 0x01D0, 0x03FE, 0x0541, 0xFFFF, 0x0667, 0x01BC, 0xFFFF, 0x01B2, 0xFFFF, 0x0127, 0x039A, 0x010B,
+	0xFFFF, 0x042A, 0xFFFF, 0x027B, 0xFFFF, 0xFFFF, 0x00A1, 0xFFFF, 0xFFFF, 0x0467, 0xFFFF, 0xFFFF, 0xFFFF, 0x06C7, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x04F7, 0x01B4, 0xFFFF, 0x01D6, 0x00F6, 0x0296, 0x06FB, 0x06BE, 0x06DD, 0xFFFF, 0xFFFF, 0x02CA, 0xFFFF, 0x076E,
+	0x0539, 0x077D, 0x0028, 0xFFFF, 0xFFFF, 0xFFFF, 0x0371, 0xFFFF, 0x064F, 0x030A, 0x071D, 0xFFFF, 0x00BB, 0x0376, 0xFFFF, 0xFFFF,
+	0x0036, 0x05DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0791, 0x038C, 0xFFFF, 0xFFFF, 0x0210, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0101, 0xFFFF, 0x07C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03A4, 0x0638, 0x018F, 0xFFFF, 0x0285, 0xFFFF, 0x0157, 0xFFFF,
+	0x0374, 0x06A4, 0xFFFF, 0xFFFF, 0x02D8, 0x070B, 0x0039, 0x00FB, 0x0569, 0x047C, 0x07FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0744, 0xFFFF, 0xFFFF, 0x01FA, 0x0243, 0xFFFF, 0xFFFF, 0x05BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0588, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x016A, 0xFFFF, 0xFFFF, 0x03A8, 0x0311, 0x0705, 0x0677, 0xFFFF, 0x04F5, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F2, 0xFFFF, 0xFFFF, 0x026F,
+	0xFFFF, 0x0380, 0x0138, 0xFFFF, 0x077A, 0xFFFF, 0xFFFF, 0xFFFF, 0x01F0, 0x0508, 0xFFFF, 0xFFFF, 0x076A, 0xFFFF, 0x0316, 0xFFFF,
+	0x058D, 0xFFFF, 0x0350, 0x055E, 0x07BA, 0xFFFF, 0x02AC, 0x052D, 0x00D5, 0x0294, 0xFFFF, 0x038B, 0xFFFF, 0x050C, 0x07BC, 0x0710,
+	0x05EE, 0x0300, 0xFFFF, 0x02F5, 0x05D4, 0xFFFF, 0x0547, 0x02FC, 0x00C1, 0x03F0, 0x0324, 0x056D, 0x0682, 0x0497, 0xFFFF, 0x0100,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0022, 0x0582, 0x05DF, 0xFFFF, 0xFFFF, 0x0233, 0x04BF,
+	0x0123, 0xFFFF, 0x0585, 0x07F0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0126, 0x0158, 0x0236, 0xFFFF, 0xFFFF, 0xFFFF, 0x074C, 0x01CB,
+	0xFFFF, 0x06CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0626, 0x0186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E0, 0xFFFF, 0xFFFF, 0x018A,
+	0x0456, 0xFFFF, 0x002F, 0x0328, 0xFFFF, 0x0221, 0xFFFF, 0xFFFF, 0xFFFF, 0x0134, 0xFFFF, 0xFFFF, 0x00E3, 0x01FD, 0x0365, 0x04F1,
+	0x00D1, 0x05F8, 0x064B, 0xFFFF, 0x0206, 0xFFFF, 0xFFFF, 0xFFFF, 0x0347, 0xFFFF, 0x06D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x02F0, 0xFFFF, 0x0504, 0x06AA, 0xFFFF, 0x024C, 0x06BB, 0x06D7, 0x0356, 0x00F3, 0x079A, 0x02E6, 0x0751, 0xFFFF, 0x05A2, 0x0265,
+	0x0789, 0xFFFF, 0x039C, 0x07A4, 0x03DE, 0xFFFF, 0xFFFF, 0xFFFF, 0x076B, 0x07EA, 0x0362, 0xFFFF, 0x072C, 0xFFFF, 0x001B, 0x04EF,
+	0x0045, 0xFFFF, 0x02B9, 0x04A1, 0x0561, 0x075B, 0xFFFF, 0x030F, 0x02BC, 0x05CC, 0xFFFF, 0xFFFF, 0x065A, 0x01D8, 0xFFFF, 0x066A,
+	0xFFFF, 0x021B, 0x0511, 0x0118, 0xFFFF, 0x0306, 0x0790, 0xFFFF, 0x0737, 0x0302, 0x02C5, 0x00B7, 0x0378, 0x033E, 0x051D, 0x06FE,
+	0x01DE, 0xFFFF, 0xFFFF, 0x01C9, 0x05AC, 0x0163, 0xFFFF, 0xFFFF, 0xFFFF, 0x043A, 0x03A2, 0xFFFF, 0xFFFF, 0x078D, 0x04E6, 0x0181,
+	0xFFFF, 0x057C, 0xFFFF, 0x03F9, 0x074E, 0x0406, 0x07B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0623, 0x004B, 0xFFFF, 0x04FC, 0xFFFF, 0x04E2, 0x0441, 0xFFFF, 0xFFFF, 0x0785, 0xFFFF, 0x07B6, 0x069C,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0367, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0722, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03D1, 0x0340, 0x06C4, 0xFFFF, 0x0578, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0052, 0x034A, 0x03D7, 0xFFFF, 0x03FF, 0xFFFF, 0xFFFF, 0x000C, 0x049F, 0xFFFF, 0xFFFF, 0xFFFF, 0x004F, 0xFFFF, 0xFFFF,
+	0x0383, 0xFFFF, 0x010F, 0xFFFF, 0xFFFF, 0x0252, 0x0046, 0x002A, 0xFFFF, 0x0565, 0x0234, 0x027F, 0xFFFF, 0x04AA, 0x064E, 0x06AE,
+	0x0527, 0x0062, 0x071C, 0x061D, 0x0058, 0x0739, 0x02D3, 0x05DC, 0x05FA, 0x0602, 0x0352, 0x0711, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0528, 0x05D5, 0xFFFF, 0xFFFF, 0x0166, 0x05CE, 0x050D, 0x077B, 0x05FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01E0, 0xFFFF, 0x0023,
+	0x01F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x037B, 0x06EB, 0xFFFF, 0x0520, 0x0167, 0x0299, 0x00CC, 0x065E, 0xFFFF, 0x02C0, 0x0680,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x032D, 0xFFFF, 0xFFFF, 0x06CB, 0x0617, 0x029E, 0x003F, 0xFFFF, 0x0629, 0xFFFF, 0x0700, 0x0273,
+	0x009A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0594, 0x0346, 0x0442, 0x0237, 0x0010, 0xFFFF, 0x059C, 0x0471, 0x0000, 0x0531, 0xFFFF, 0x0276,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0493, 0xFFFF, 0xFFFF, 0xFFFF, 0x06D1, 0x0258, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0217, 0x00DA, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x02F1, 0xFFFF, 0x0012, 0x0772, 0x0149, 0x07FB, 0x02A5, 0x025B, 0x0056, 0xFFFF, 0x0513, 0xFFFF, 0x01B1,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0535, 0x0664, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x050E,
+	0x040D, 0x0747, 0x01A9, 0x07A8, 0xFFFF, 0x076D, 0x07BE, 0x02BB, 0x0775, 0x00A4, 0x02C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0114, 0xFFFF,
+	0x0662, 0xFFFF, 0xFFFF, 0xFFFF, 0x011E, 0xFFFF, 0xFFFF, 0x0261, 0x0035, 0x07EF, 0x03A1, 0xFFFF, 0x033C, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x0611, 0xFFFF, 0xFFFF, 0xFFFF, 0x054A, 0x05AF, 0xFFFF, 0xFFFF, 0x048F, 0xFFFF, 0x05C6, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x03B6, 0x0613, 0xFFFF, 0xFFFF, 0x0089, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0040, 0xFFFF, 0xFFFF, 0x0618, 0x00EE, 0x02CE, 0x0344, 0x0310, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03DD,
+	0x003E, 0x012E, 0x06B6, 0x008C, 0xFFFF, 0xFFFF, 0x04B5, 0xFFFF, 0x05B9, 0x07A1, 0x0287, 0x0587, 0x0459, 0xFFFF, 0xFFFF, 0x042D,
+	0x07D6, 0xFFFF, 0x02F8, 0xFFFF, 0x0060, 0x0393, 0xFFFF, 0xFFFF, 0x02B5, 0x0502, 0x02D2, 0x0426, 0x06DB, 0x03AC, 0x01FE, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x0774, 0x0658, 0xFFFF, 0xFFFF, 0xFFFF, 0x0137, 0x05C8, 0xFFFF, 0x0061, 0x0418, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x016F, 0x00D4, 0x0402, 0x0016, 0x0468, 0x001A, 0x02AD, 0x033B, 0x0334, 0x063C, 0x055D, 0x067A, 0xFFFF, 0xFFFF, 0x036C, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x0753, 0x0545, 0x056B, 0x0659, 0x0065, 0xFFFF, 0x03C5, 0x054C, 0x057B, 0xFFFF, 0x00C0, 0xFFFF, 0xFFFF, 0x0387,
+	0x011B, 0x0165, 0x060E, 0x046B, 0xFFFF, 0xFFFF, 0x07D8, 0x02C2, 0xFFFF, 0x0080, 0x00FA, 0x0730, 0x07B2, 0x01C6, 0x0379, 0x05DE,
+	0xFFFF, 0x01C0, 0xFFFF, 0xFFFF, 0x0338, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05B2, 0xFFFF, 0x07DA, 0x0074, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x07CC, 0x008A, 0xFFFF, 0x02C6, 0x0185, 0x06B2, 0xFFFF, 0x03CF, 0xFFFF, 0xFFFF, 0x07AA, 0x04D3, 0x01B8, 0xFFFF, 0x0409, 0x0248,
+	0x03E7, 0xFFFF, 0x05E1, 0x01F5, 0x043D, 0xFFFF, 0x059A, 0x0189, 0x0576, 0xFFFF, 0xFFFF, 0xFFFF, 0x0133, 0x063A, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x04CC, 0xFFFF, 0xFFFF, 0x063D, 0x070F, 0x0589, 0xFFFF, 0x0197, 0xFFFF, 0xFFFF, 0x04C1, 0x06EF, 0xFFFF, 0x0223, 0xFFFF,
+	0x0503, 0x041F, 0x0706, 0x025A, 0xFFFF, 0x035C, 0x0006, 0x03D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x031C, 0xFFFF, 0x0482,
+	0x0691, 0xFFFF, 0xFFFF, 0xFFFF, 0x03E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02E5, 0xFFFF, 0x0032, 0x0419,
+	0x0486, 0x0172, 0xFFFF, 0x05CB, 0x0630, 0x06AD, 0x0580, 0x05F0, 0x02CB, 0x0178, 0x014C, 0x00E9, 0x03A0, 0xFFFF, 0x05A7, 0x0518,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x022F, 0x0001, 0x03F1, 0x0117, 0x07EB, 0x01C3, 0x0780, 0x05A8, 0x0421, 0x02C4, 0x01DB, 0x0427, 0xFFFF,
+	0x0212, 0xFFFF, 0xFFFF, 0x041C, 0x0646, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x065C, 0x01E3, 0xFFFF, 0x00A6,
+	0xFFFF, 0x0326, 0x0621, 0x07DD, 0xFFFF, 0xFFFF, 0x0476, 0xFFFF, 0x075D, 0x0491, 0xFFFF, 0xFFFF, 0x005C, 0xFFFF, 0x05DA, 0x029B,
+	0xFFFF, 0x03E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0239, 0xFFFF, 0xFFFF, 0xFFFF, 0x0440, 0xFFFF, 0x05B8, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x00B1, 0xFFFF, 0x06B9, 0xFFFF, 0x009C, 0x07B5, 0x03A6, 0x003A, 0x0447, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x03B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04E3, 0xFFFF, 0x06AC, 0x02A9, 0x03E2, 0x0540, 0x0595, 0x018D, 0x0105, 0x0674,
+	0x03AE, 0x036A, 0xFFFF, 0x03D0, 0x04E9, 0x00A0, 0x0109, 0x0786, 0xFFFF, 0xFFFF, 0xFFFF, 0x05A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0484, 0xFFFF, 0x0430, 0xFFFF, 0x06F5, 0x00DC, 0x050B, 0x04F4, 0x0174, 0x0519, 0x0090, 0x061C, 0x0313, 0x04BA, 0xFFFF, 0xFFFF,
+	0x075C, 0xFFFF, 0xFFFF, 0x02BD, 0x0179, 0x02D4, 0xFFFF, 0x01D9, 0xFFFF, 0x017E, 0xFFFF, 0x07FE, 0x0389, 0xFFFF, 0x060C, 0x001E,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0271, 0x034F, 0x07EC, 0xFFFF, 0xFFFF, 0xFFFF, 0x006E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x03BA, 0x0404, 0x052A, 0x025F, 0xFFFF, 0x05B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03DC, 0xFFFF, 0x0124, 0xFFFF,
+	0x04D1, 0x0390, 0xFFFF, 0xFFFF, 0x07DF, 0x0343, 0xFFFF, 0xFFFF, 0x067F, 0xFFFF, 0x04DA, 0xFFFF, 0x0195, 0x06FD, 0xFFFF, 0x04D2,
+	0xFFFF, 0x049C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0599, 0x03FD, 0x026D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0524, 0xFFFF, 0xFFFF, 0x00E6, 0x06C0, 0x02E0, 0xFFFF, 0xFFFF, 0x07E2, 0x023E, 0x06E3, 0x0279, 0x009D, 0xFFFF, 0x033A, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x05D1, 0x0666, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01B0, 0x031A, 0xFFFF, 0x07AB, 0x03D3, 0x024D, 0x03D9, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0453, 0x0679, 0x0014, 0x066C, 0x05EC, 0x07A5, 0x0019, 0x014F, 0x03EB,
+	0xFFFF, 0x0609, 0x00A2, 0x041A, 0x06DC, 0xFFFF, 0xFFFF, 0x03EC, 0xFFFF, 0x07D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x073B, 0xFFFF, 0x0420, 0x06F3, 0x035D, 0x06E6, 0x056E, 0x0113, 0x007A, 0x0048, 0x0707, 0x076F, 0x04D4, 0x07EE, 0xFFFF, 0x026A,
+	0x05E8, 0x0437, 0x00DE, 0xFFFF, 0x0548, 0xFFFF, 0xFFFF, 0x0529, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x046F, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x070A, 0xFFFF, 0xFFFF, 0x04F2, 0xFFFF, 0xFFFF, 0xFFFF, 0x0552, 0x068A, 0x0636, 0x03FA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0412,
+	0x032F, 0x01E6, 0x007B, 0x0756, 0x012D, 0x07CD, 0x0703, 0x06CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x029F, 0x04B3, 0xFFFF,
+	0x04CA, 0x0355, 0x0743, 0xFFFF, 0x018C, 0xFFFF, 0x0305, 0xFFFF, 0x0760, 0x0532, 0x0766, 0x0556, 0x05E4, 0xFFFF, 0x05F7, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0512, 0x040B, 0x03A7, 0x063B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0208, 0x01A6, 0x06DA, 0x0768,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0475, 0xFFFF, 0x004D, 0x07F3, 0x07B0, 0xFFFF, 0xFFFF, 0x05C7, 0x015E, 0xFFFF, 0x0466, 0x0464, 0x03E4,
+	0x0293, 0xFFFF, 0xFFFF, 0x0315, 0xFFFF, 0x04BC, 0x0251, 0xFFFF, 0x0151, 0x0748, 0xFFFF, 0x03ED, 0x055B, 0x075A, 0x0542, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x0656, 0xFFFF, 0x0297, 0xFFFF, 0x0072, 0x05ED, 0x078B, 0x04C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0059, 0x0092, 0xFFFF,
+	0xFFFF, 0x0320, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05FD, 0xFFFF, 0x0121, 0x0068, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0325, 0xFFFF, 0xFFFF, 0xFFFF, 0x0462, 0xFFFF, 0xFFFF, 0xFFFF, 0x0337, 0xFFFF, 0xFFFF, 0xFFFF, 0x0615, 0xFFFF, 0xFFFF,
+	0x0280, 0xFFFF, 0x0037, 0x05B3, 0xFFFF, 0xFFFF, 0x0407, 0xFFFF, 0xFFFF, 0x07C0, 0xFFFF, 0x007C, 0xFFFF, 0x070D, 0x047A, 0x0286,
+	0x00C2, 0xFFFF, 0x0704, 0x0188, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0x0131, 0x06E2, 0x0141, 0x053D, 0x024A, 0x0030, 0x0278, 0x0625,
+	0x01FC, 0x02B2, 0x0226, 0x0778, 0xFFFF, 0x009E, 0x0205, 0x0244, 0x05EB, 0xFFFF, 0x00F0, 0xFFFF, 0xFFFF, 0x022D, 0x06D4, 0x06E4,
+	0x005D, 0x0398, 0x0044, 0xFFFF, 0x02B8, 0x0290, 0x06D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x048A, 0x051F,
+	0xFFFF, 0x00AC, 0x013A, 0xFFFF, 0xFFFF, 0x045D, 0x05A4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02AB, 0x05C9, 0xFFFF, 0xFFFF, 0x06F8,
+	0x058E, 0x04EE, 0xFFFF, 0x00C8, 0xFFFF, 0xFFFF, 0x0111, 0x062F, 0xFFFF, 0xFFFF, 0x036E, 0xFFFF, 0xFFFF, 0x0734, 0x0781, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0388, 0x001F, 0x0116, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07A9, 0x00EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x07C5, 0x0410, 0x07F5, 0x01DD, 0x051B, 0x054E, 0x04AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x032B, 0x04DF, 0x07F6, 0x078E,
+	0x0099, 0xFFFF, 0x015A, 0xFFFF, 0x0192, 0x0572, 0x043F, 0x052B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0249, 0xFFFF, 0x069B, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x0777, 0x03A5, 0x04E1, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x02B3, 0x0446, 0xFFFF, 0x05BC,
+	0x05EA, 0xFFFF, 0x023C, 0xFFFF, 0xFFFF, 0xFFFF, 0x00D2, 0x07D2, 0xFFFF, 0x0085, 0x0660, 0x06F6, 0x0031, 0xFFFF, 0xFFFF, 0x06AB,
+	0x0769, 0x0108, 0x020A, 0x0007, 0xFFFF, 0x01AF, 0x0533, 0xFFFF, 0xFFFF, 0x004E, 0x05C4, 0x031E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0013, 0x014D, 0x058B, 0x03B0, 0x01B5, 0xFFFF, 0xFFFF, 0xFFFF, 0x05EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x046A, 0xFFFF,
+	0xFFFF, 0x0563, 0x01AA, 0xFFFF, 0x00FD, 0x0601, 0x04D0, 0xFFFF, 0x02F3, 0x02FE, 0xFFFF, 0xFFFF, 0x013E, 0x020C, 0xFFFF, 0x06C8,
+	0xFFFF, 0x067C, 0xFFFF, 0x04F8, 0x05FC, 0xFFFF, 0xFFFF, 0x0152, 0x02E8, 0x0303, 0x04C6, 0x012A, 0x02F4, 0xFFFF, 0x0069, 0x011D,
+	0xFFFF, 0x04B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x06E0, 0x028B, 0xFFFF, 0xFFFF, 0x0793, 0x002C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00A7,
+	0x019F, 0x0477, 0xFFFF, 0xFFFF, 0x0424, 0x067E, 0xFFFF, 0x0688, 0x04DD, 0x0762, 0xFFFF, 0x01E9, 0xFFFF, 0x0761, 0xFFFF, 0x0573,
+	0x007E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00C4, 0xFFFF, 0xFFFF, 0x02DC, 0xFFFF, 0xFFFF, 0xFFFF, 0x0274, 0x059B, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02CF, 0xFFFF, 0xFFFF, 0x02E3, 0x006A, 0xFFFF, 0x02F7, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x009F, 0xFFFF, 0x0650, 0xFFFF, 0xFFFF, 0x0103, 0x05D2, 0x0675, 0x0386, 0x02E1, 0x00B2, 0x02A4, 0x0657, 0xFFFF,
+	0x01D1, 0x0227, 0x03D8, 0x034B, 0xFFFF, 0x07D7, 0xFFFF, 0x0400, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0485, 0xFFFF,
+	0x014B, 0x06C6, 0x014E, 0x0642, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0543, 0x0434, 0xFFFF, 0xFFFF, 0xFFFF, 0x00FE, 0x017A,
+	0xFFFF, 0x0694, 0x0112, 0x0203, 0xFFFF, 0xFFFF, 0x013F, 0x0712, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0684, 0xFFFF,
+	0x0066, 0xFFFF, 0x00B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x026B, 0xFFFF, 0xFFFF, 0x0699, 0xFFFF, 0xFFFF, 0xFFFF, 0x048D,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03F3, 0xFFFF, 0xFFFF, 0x0635, 0x0551, 0x0238, 0xFFFF, 0x01A2, 0xFFFF, 0xFFFF, 0x06B0,
+	0xFFFF, 0x0689, 0x05B5, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0597, 0xFFFF, 0x0593, 0x02F6, 0x07FC, 0x0425, 0xFFFF, 0x030C, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x04B4, 0x0741, 0xFFFF, 0xFFFF, 0x0277, 0x0607, 0xFFFF, 0x0148, 0x00E7, 0x0444, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x068D, 0x0392, 0x00EF, 0xFFFF, 0x02C8, 0xFFFF, 0x0207, 0x07B7, 0x07C9, 0xFFFF, 0x0525, 0xFFFF, 0xFFFF, 0x064C, 0xFFFF, 0x041E,
+	0xFFFF, 0xFFFF, 0x0146, 0x0450, 0xFFFF, 0xFFFF, 0x0515, 0xFFFF, 0xFFFF, 0x045C, 0x010C, 0x0506, 0x04EB, 0xFFFF, 0x0228, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x044B, 0x02FA, 0xFFFF, 0xFFFF, 0x01BD, 0xFFFF, 0x0150, 0x0416, 0xFFFF, 0x062D, 0x04E8, 0xFFFF, 0x0668,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x044C, 0x0129, 0xFFFF, 0xFFFF, 0xFFFF, 0x0115, 0x061E, 0xFFFF, 0x056A, 0x057A, 0x00BF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0119, 0xFFFF, 0xFFFF, 0x0377, 0x02EF, 0x078C, 0x01C5, 0x0120, 0xFFFF, 0x0670, 0x005B,
+	0xFFFF, 0x006F, 0x03BE, 0x002B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0184, 0x02B0, 0x04C7, 0x0644, 0x051E, 0x0647, 0xFFFF,
+	0x0614, 0xFFFF, 0xFFFF, 0xFFFF, 0x0073, 0x064A, 0x03FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05B6, 0x06ED, 0x038A,
+	0x0360, 0x0522, 0x022B, 0x0598, 0xFFFF, 0xFFFF, 0xFFFF, 0x070C, 0xFFFF, 0xFFFF, 0x009B, 0xFFFF, 0xFFFF, 0x06E7, 0xFFFF, 0xFFFF,
+	0x0764, 0x02A0, 0x04B6, 0x059E, 0x0414, 0x012F, 0xFFFF, 0x04CB, 0xFFFF, 0xFFFF, 0xFFFF, 0x06D3, 0x068E, 0x0394, 0x01EC, 0x0558,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02B7, 0x021A, 0x0726, 0xFFFF, 0x03D6, 0xFFFF, 0x00AA, 0x07E5, 0xFFFF, 0xFFFF, 0x07F9,
+	0xFFFF, 0xFFFF, 0x00AB, 0x03BB, 0xFFFF, 0x010D, 0xFFFF, 0xFFFF, 0xFFFF, 0x027C, 0xFFFF, 0x072B, 0x014A, 0xFFFF, 0xFFFF, 0x0317,
+	0x0291, 0x0017, 0x0170, 0x0240, 0xFFFF, 0x0175, 0xFFFF, 0x019D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0024, 0xFFFF, 0x055F, 0xFFFF, 0x039E,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x056C, 0xFFFF, 0x00F9, 0xFFFF, 0xFFFF, 0x01F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x051C, 0x03F8,
+	0xFFFF, 0x02E7, 0x07C3, 0xFFFF, 0xFFFF, 0x01C7, 0x0154, 0x00C9, 0xFFFF, 0xFFFF, 0x037A, 0x035E, 0x0655, 0xFFFF, 0xFFFF, 0x0162,
+	0xFFFF, 0x01E2, 0xFFFF, 0xFFFF, 0xFFFF, 0x054D, 0x0648, 0x05D8, 0x01DC, 0xFFFF, 0x028E, 0x0750, 0xFFFF, 0x0733, 0xFFFF, 0x0405,
+	0x0665, 0x0098, 0x0246, 0x071F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0763, 0x004A, 0x0782, 0x00BD, 0xFFFF, 0xFFFF, 0x018B, 0x0159,
+	0xFFFF, 0x02DB, 0xFFFF, 0xFFFF, 0x0608, 0xFFFF, 0xFFFF, 0x0720, 0xFFFF, 0xFFFF, 0xFFFF, 0x0135, 0xFFFF, 0xFFFF, 0x0102, 0x02EC,
+	0xFFFF, 0x055A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0690, 0x0198, 0x005E, 0xFFFF, 0x00D7, 0xFFFF, 0x0339, 0xFFFF, 0x044D, 0x022E,
+	0x03CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0200, 0x000B, 0xFFFF, 0x0357, 0x0054, 0x0505, 0xFFFF, 0x04A7, 0x0041, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01D4, 0x00DB, 0x0292, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x00F4, 0x072D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0351, 0x0600, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x013D, 0xFFFF, 0x034D, 0xFFFF,
+	0x04DC, 0xFFFF, 0x067B, 0xFFFF, 0x00AE, 0xFFFF, 0x060B, 0x04F3, 0x01BF, 0x00B8, 0x0429, 0xFFFF, 0x006D, 0xFFFF, 0xFFFF, 0x0372,
+	0xFFFF, 0xFFFF, 0x0411, 0x0423, 0x0164, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0584, 0x0336, 0x065D, 0x0586, 0xFFFF,
+	0xFFFF, 0x0327, 0x067D, 0x002D, 0x0687, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02A8,
+	0x0193, 0x0624, 0xFFFF, 0x0628, 0xFFFF, 0xFFFF, 0x0096, 0xFFFF, 0x0717, 0xFFFF, 0xFFFF, 0xFFFF, 0x004C, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x00E4, 0x052F, 0x0553, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02C7, 0x0448, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x062A, 0x0143, 0xFFFF, 0x05C0, 0x03AB, 0xFFFF, 0x0216, 0xFFFF, 0x01CF, 0xFFFF, 0x0055, 0xFFFF, 0xFFFF, 0x0375, 0xFFFF, 0xFFFF,
+	0x0787, 0x07FA, 0xFFFF, 0x0678, 0xFFFF, 0x05E5, 0x036B, 0x013B, 0xFFFF, 0x0663, 0x03EA, 0x05A6, 0x07CA, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x019B, 0xFFFF, 0xFFFF, 0xFFFF, 0x020B, 0xFFFF, 0xFFFF, 0x02BA, 0xFFFF, 0xFFFF, 0x016E, 0x03EE, 0xFFFF, 0x0566, 0xFFFF,
+	0xFFFF, 0x0323, 0xFFFF, 0x02AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06EA, 0x00F8, 0xFFFF, 0xFFFF, 0x04C3, 0xFFFF, 0xFFFF,
+	0x0269, 0x0683, 0x05CF, 0x000F, 0x0051, 0xFFFF, 0x0422, 0xFFFF, 0x07C6, 0x046C, 0xFFFF, 0x05AE, 0xFFFF, 0x0026, 0x00B6, 0x01F3,
+	0x048C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04C8, 0xFFFF, 0x035F, 0xFFFF, 0xFFFF, 0x0499, 0x01A1, 0x026C, 0x028D, 0xFFFF,
+	0x05FF, 0xFFFF, 0x0701, 0x01CE, 0xFFFF, 0x01EA, 0x0489, 0x04AD, 0x0391, 0xFFFF, 0x0196, 0x0605, 0x06A0, 0xFFFF, 0x0187, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x003D, 0x02E9, 0xFFFF, 0x01F8, 0x0721, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x022C, 0xFFFF, 0x06D2, 0x0473, 0xFFFF, 0x03E8, 0xFFFF, 0x07A2, 0x0501, 0xFFFF, 0xFFFF, 0xFFFF, 0x041D, 0xFFFF, 0x01A5,
+	0xFFFF, 0x06D8, 0xFFFF, 0x0474, 0x026E, 0x0728, 0x07E7, 0x024E, 0x0514, 0x045B, 0x0264, 0x06FA, 0xFFFF, 0xFFFF, 0xFFFF, 0x024F,
+	0x04E5, 0xFFFF, 0x077C, 0xFFFF, 0x06F2, 0x04AB, 0xFFFF, 0xFFFF, 0x03C4, 0xFFFF, 0x0432, 0x0253, 0x060A, 0xFFFF, 0xFFFF, 0x0110,
+	0xFFFF, 0x03C2, 0xFFFF, 0x0128, 0x073C, 0xFFFF, 0x072E, 0xFFFF, 0xFFFF, 0x0086, 0x0579, 0x0064, 0xFFFF, 0x0696, 0x054B, 0xFFFF,
+	0x0050, 0x035A, 0x07BB, 0xFFFF, 0x02C1, 0xFFFF, 0x040E, 0xFFFF, 0x0770, 0x0309, 0xFFFF, 0x020F, 0x066F, 0x0067, 0x007F, 0x011F,
+	0xFFFF, 0x00E0, 0xFFFF, 0x0612, 0xFFFF, 0x0438, 0x0740, 0x0049, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00CB, 0x0620, 0x0637,
+	0x074A, 0xFFFF, 0x001C, 0xFFFF, 0xFFFF, 0xFFFF, 0x00CD, 0xFFFF, 0xFFFF, 0x018E, 0x03C0, 0x0038, 0x02D0, 0x0330, 0x008B, 0x0156,
+	0xFFFF, 0x02A1, 0xFFFF, 0xFFFF, 0x04FE, 0x070E, 0x06A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x037E, 0x0413, 0xFFFF, 0x053C,
+	0x06CF, 0x0797, 0x06EE, 0x02EA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x075F, 0x02A2, 0x057F, 0xFFFF, 0x04BB, 0x06C1, 0xFFFF, 0x01AE,
+	0xFFFF, 0xFFFF, 0x069A, 0xFFFF, 0xFFFF, 0x06A9, 0x062C, 0x02B6, 0x0759, 0x0507, 0x04B9, 0x03CA, 0x0018, 0x0349, 0xFFFF, 0x0729,
+	0x02A6, 0x0676, 0xFFFF, 0xFFFF, 0x03B4, 0x0160, 0xFFFF, 0xFFFF, 0xFFFF, 0x0359, 0xFFFF, 0x0401, 0xFFFF, 0xFFFF, 0x034C, 0xFFFF,
+	0x06E9, 0x07E9, 0xFFFF, 0x079D, 0x058C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02FB, 0x03F7, 0xFFFF, 0x041B, 0xFFFF,
+	0x03DB, 0xFFFF, 0xFFFF, 0xFFFF, 0x02F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x077F, 0xFFFF, 0x040F, 0xFFFF, 0xFFFF,
+	0x0435, 0xFFFF, 0x05AB, 0x0211, 0x07C2, 0x033D, 0x03B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0784, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x00E1, 0xFFFF, 0xFFFF, 0x0027, 0x00A5, 0xFFFF, 0x056F, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0x04F9, 0xFFFF, 0x074B, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x06B3, 0x05D9, 0x00A9, 0x04CD, 0xFFFF, 0xFFFF, 0x03D4, 0xFFFF, 0xFFFF, 0x057D, 0xFFFF, 0xFFFF, 0x043E,
+	0xFFFF, 0xFFFF, 0x0382, 0x0794, 0x06A6, 0xFFFF, 0xFFFF, 0x04BE, 0x0364, 0xFFFF, 0x0745, 0x0472, 0x06B8, 0xFFFF, 0xFFFF, 0x023A,
+	0xFFFF, 0x0492, 0x0079, 0xFFFF, 0xFFFF, 0x00C7, 0x0084, 0x0767, 0x063E, 0x05BF, 0x07D1, 0xFFFF, 0x023B, 0xFFFF, 0x047F, 0xFFFF,
+	0x00D3, 0x028A, 0xFFFF, 0x00AD, 0xFFFF, 0x0209, 0xFFFF, 0xFFFF, 0x0640, 0xFFFF, 0xFFFF, 0x05C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x003C, 0xFFFF, 0x07A3, 0xFFFF, 0x061A, 0xFFFF, 0x03AF, 0x016C, 0xFFFF, 0x045F, 0x05CA, 0xFFFF, 0x02EE, 0xFFFF, 0xFFFF, 0x027D,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0510, 0x0295, 0x079F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0736, 0xFFFF,
+	0x0370, 0xFFFF, 0x02BE, 0x00F7, 0xFFFF, 0xFFFF, 0x0268, 0x0033, 0x00EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0428, 0xFFFF, 0xFFFF, 0xFFFF, 0x07D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0463, 0x00CA, 0xFFFF,
+	0x0570, 0xFFFF, 0x0088, 0xFFFF, 0x04DE, 0x0633, 0x0168, 0xFFFF, 0x049A, 0xFFFF, 0x074D, 0xFFFF, 0x0686, 0xFFFF, 0x06B5, 0x029C,
+	0x04FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x037C, 0x01EB, 0x0795, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x01BB, 0xFFFF, 0x0241, 0x037F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0799,
+	0x0053, 0xFFFF, 0xFFFF, 0x07D5, 0xFFFF, 0xFFFF, 0xFFFF, 0x00D8, 0x0727, 0x049E, 0xFFFF, 0x0661, 0x03E9, 0x05C2, 0xFFFF, 0xFFFF,
+	0x042E, 0x010A, 0xFFFF, 0x05A3, 0x0534, 0xFFFF, 0x04EA, 0x015C, 0xFFFF, 0xFFFF, 0x03B2, 0x04AE, 0xFFFF, 0xFFFF, 0x00A3, 0x0262,
+	0xFFFF, 0x01D5, 0x061B, 0xFFFF, 0xFFFF, 0x0009, 0xFFFF, 0x0335, 0xFFFF, 0xFFFF, 0x071A, 0x027E, 0x03F5, 0x0577, 0xFFFF, 0x0564,
+	0xFFFF, 0x07AE, 0x0298, 0xFFFF, 0xFFFF, 0xFFFF, 0x01DA, 0xFFFF, 0x02CC, 0xFFFF, 0xFFFF, 0x07ED, 0x0260, 0x04C2, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0x0091, 0xFFFF, 0xFFFF, 0x05AA, 0xFFFF, 0x04C4, 0xFFFF, 0x0698, 0x0652, 0xFFFF, 0xFFFF, 0x021F, 0x06FF, 0xFFFF,
+	0x0070, 0x0709, 0xFFFF, 0xFFFF, 0x054F, 0x05B1, 0x073F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0591, 0xFFFF, 0x0125, 0x01A0, 0xFFFF,
+	0x03A3, 0xFFFF, 0x0215, 0xFFFF, 0x0282, 0x0081, 0x00BC, 0x05B4, 0x01E5, 0x029D, 0x069F, 0xFFFF, 0x0716, 0xFFFF, 0x0574, 0x066B,
+	0x07AF, 0xFFFF, 0x01B9, 0x00CE, 0xFFFF, 0xFFFF, 0x0457, 0x02DE, 0xFFFF, 0x0415, 0x01F7, 0x01F4, 0x05F2, 0xFFFF, 0xFFFF, 0x0275,
+	0x05E3, 0xFFFF, 0x07E3, 0x0222, 0xFFFF, 0x0332, 0xFFFF, 0x0530, 0x06D0, 0xFFFF, 0xFFFF, 0x04E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x01EE, 0x02A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06F1, 0x07AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x000D, 0xFFFF, 0xFFFF,
+	0x04E4, 0xFFFF, 0xFFFF, 0xFFFF, 0x072A, 0xFFFF, 0x06C5, 0x0145, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0431,
+	0x008F, 0x0460, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0147, 0x00FF, 0x0047, 0xFFFF, 0x017C, 0xFFFF, 0xFFFF, 0x0695,
+	0x0776, 0xFFFF, 0x05FB, 0xFFFF, 0xFFFF, 0xFFFF, 0x02D5, 0xFFFF, 0xFFFF, 0x02BF, 0x01C4, 0x0308, 0x0685, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0610, 0x0549, 0x0161, 0x00DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x048E, 0xFFFF, 0x0183, 0x03E5,
+	0x06EC, 0x0649, 0x0749, 0xFFFF, 0xFFFF, 0x0093, 0xFFFF, 0x0077, 0xFFFF, 0x03FB, 0x0284, 0x0082, 0xFFFF, 0xFFFF, 0x01CD, 0xFFFF,
+	0x0155, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x037D, 0x0257, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x04C0, 0xFFFF, 0x00E8, 0x06CE, 0xFFFF, 0xFFFF, 0x01AD, 0xFFFF, 0xFFFF, 0x0458, 0x0557, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x05F9, 0x07D0, 0x0259, 0x044A, 0x03E0, 0x047E, 0x0495, 0x0224, 0x019A, 0x028F, 0x0397, 0x01AB, 0x065F, 0x01A7, 0x03C9, 0x0758,
+	0xFFFF, 0xFFFF, 0xFFFF, 0x064D, 0x0348, 0x0465, 0x07F4, 0xFFFF, 0xFFFF, 0x07E8, 0x0250, 0x04EC, 0xFFFF, 0x00B3, 0x015F, 0x02AA,
+	0x0461, 0x03C1, 0x0333, 0x01D3, 0x07A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x039D, 0xFFFF, 0x03DF, 0x055C, 0xFFFF, 0x00EA, 0x0021,
+	0xFFFF, 0x01BE, 0x0544, 0x01D7, 0xFFFF, 0x01C1, 0xFFFF, 0x0201, 0x0752, 0x0384, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x077E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0581, 0xFFFF, 0x011A, 0xFFFF, 0x0180, 0xFFFF, 0x0153, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0654,
+	0xFFFF, 0x0373, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0095, 0xFFFF, 0x0616, 0xFFFF,
+	0x05DB, 0x0568, 0x0715, 0xFFFF, 0xFFFF, 0x0097, 0x0083, 0x06B1, 0x05B7, 0x024B, 0x07CE, 0x0571, 0x047B, 0xFFFF, 0xFFFF, 0x0004,
+	0x02DA, 0x033F, 0x0345, 0x06A5, 0xFFFF, 0x03BD, 0x00A8, 0x042C, 0x0619, 0xFFFF, 0x052E, 0x00D0, 0x0132, 0x0765, 0x02EB, 0x05F4,
+	0x05BB, 0xFFFF, 0x04A3, 0x003B, 0xFFFF, 0x05D0, 0x0559, 0xFFFF, 0xFFFF, 0xFFFF, 0x04A4, 0x00F1, 0x0395, 0x068F, 0xFFFF, 0x027A,
+	0xFFFF, 0xFFFF, 0x000A, 0x04D8, 0xFFFF, 0x03A9, 0x0289, 0xFFFF, 0xFFFF, 0x05A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x0481, 0xFFFF, 0x058A, 0xFFFF, 0x025D, 0x05C5, 0x039B, 0xFFFF, 0x010E, 0xFFFF, 0x03DA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0469, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0560, 0xFFFF, 0xFFFF, 0xFFFF, 0x0177, 0x07BD, 0xFFFF, 0xFFFF, 0x0735, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0255, 0x02C3, 0xFFFF, 0xFFFF,
+	0x01C8, 0x006C, 0xFFFF, 0xFFFF, 0x00E2, 0xFFFF, 0x031F, 0xFFFF, 0xFFFF, 0x046D, 0x0204, 0xFFFF, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF,
+	0x065B, 0xFFFF, 0xFFFF, 0xFFFF, 0x02A7, 0x02D7, 0x0029, 0xFFFF, 0x0622, 0xFFFF, 0x01CC, 0x043C, 0x03C6, 0x01E7, 0xFFFF, 0x071E,
+	0x0272, 0xFFFF, 0xFFFF, 0x012C, 0xFFFF, 0x0632, 0x04E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03CE, 0x0575, 0x06A7, 0xFFFF, 0x05E9,
+	0xFFFF, 0x07B4, 0xFFFF, 0x02D1, 0xFFFF, 0xFFFF, 0x03B9, 0x0071, 0x0225, 0xFFFF, 0xFFFF, 0xFFFF, 0x0366, 0x059F, 0x05BD, 0x02ED,
+	0xFFFF, 0x040A, 0xFFFF, 0x00BE, 0x0494, 0x0288, 0x06C2, 0xFFFF, 0xFFFF, 0xFFFF, 0x0369, 0x03AA, 0xFFFF, 0x0358, 0x0312, 0xFFFF,
+	0x0480, 0x0008, 0xFFFF, 0xFFFF, 0x042B, 0x06F0, 0xFFFF, 0xFFFF, 0x0483, 0x01B3, 0xFFFF, 0xFFFF, 0x05E6, 0x04CF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x050A, 0xFFFF, 0x008E, 0x0641, 0x0452, 0xFFFF, 0x04A9, 0xFFFF, 0xFFFF, 0x0517, 0xFFFF, 0xFFFF, 0xFFFF, 0x0631, 0x03F4,
+	0x0526, 0xFFFF, 0x00F5, 0xFFFF, 0x072F, 0x00B5, 0x0692, 0x0546, 0x0232, 0x02FF, 0x04BD, 0xFFFF, 0x017D, 0x0020, 0xFFFF, 0xFFFF,
+	0x04AF, 0x0307, 0x02AF, 0xFFFF, 0x0754, 0xFFFF, 0x0034, 0x0270, 0x012B, 0xFFFF, 0xFFFF, 0x005A, 0xFFFF, 0xFFFF, 0x05AD, 0x020D,
+	0x0488, 0x0122, 0x0732, 0x0304, 0x0498, 0xFFFF, 0xFFFF, 0x0182, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01CA, 0x04FA,
+	0x06C9, 0xFFFF, 0x07F8, 0x029A, 0x0454, 0x0078, 0xFFFF, 0xFFFF, 0xFFFF, 0x069E, 0xFFFF, 0x0076, 0xFFFF, 0x02CD, 0x0319, 0xFFFF,
+	0x0361, 0x01F6, 0x04FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x069D, 0x04D6, 0xFFFF, 0x0523, 0x07F2, 0xFFFF, 0xFFFF, 0x02DD, 0xFFFF,
+	0x0329, 0x02DF, 0x04FF, 0x06BA, 0x0169, 0x00E5, 0xFFFF, 0x0724, 0xFFFF, 0xFFFF, 0x07E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0104,
+	0x05C1, 0x04D7, 0x00D9, 0x01A4, 0xFFFF, 0x044E, 0x005F, 0x021D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x042F, 0x0500, 0xFFFF,
+	0xFFFF, 0x048B, 0x045A, 0x0417, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x079C, 0x0496, 0x07B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x030E, 0x076C, 0x05D3, 0xFFFF, 0xFFFF, 0x0353, 0x0363, 0x0063, 0x05E7, 0xFFFF, 0x06E5,
+	0xFFFF, 0x051A, 0xFFFF, 0x03CB, 0x039F, 0x0140, 0xFFFF, 0x01C2, 0x000E, 0xFFFF, 0xFFFF, 0x017F, 0x017B, 0x05D6, 0xFFFF, 0x01B6,
+	0x01E1, 0x00BA, 0x00DD, 0xFFFF, 0xFFFF, 0x0342, 0x07B1, 0x0436, 0x0714, 0x0643, 0x04D5, 0xFFFF, 0xFFFF, 0x0220, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x02D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0604, 0xFFFF, 0x05F1, 0xFFFF, 0x07E0, 0xFFFF, 0xFFFF, 0x046E, 0x049B,
+	0x0479, 0x052C, 0x00C6, 0x0742, 0x01F9, 0xFFFF, 0xFFFF, 0x0521, 0x053B, 0x06A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0231, 0x00CF, 0xFFFF, 0x059D, 0x022A, 0x035B, 0xFFFF, 0xFFFF, 0x0445, 0x02B1, 0x0555, 0x075E, 0x0798, 0xFFFF, 0xFFFF,
+	0xFFFF, 0x0449, 0xFFFF, 0x07F7, 0xFFFF, 0xFFFF, 0xFFFF, 0x023F, 0x0219, 0x03C8, 0x07E6, 0x06A8, 0xFFFF, 0x0341, 0x0011, 0x0005,
+	0x02B4, 0xFFFF, 0x01EF, 0xFFFF, 0xFFFF, 0x01D2, 0x0536, 0x025C, 0x0718, 0x04A8, 0x079B, 0xFFFF, 0x0788, 0x015D, 0x0381, 0xFFFF,
+	0x04A0, 0x0015, 0xFFFF, 0xFFFF, 0x045E, 0x07AD, 0x025E, 0x0651, 0x07B9, 0xFFFF, 0x019C, 0xFFFF, 0xFFFF, 0xFFFF, 0x062E, 0xFFFF,
+	0x00B4, 0xFFFF, 0xFFFF, 0x03F6, 0x0433, 0xFFFF, 0xFFFF, 0xFFFF, 0x066D, 0x061F, 0xFFFF, 0xFFFF, 0x073D, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0235, 0x07BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03F2, 0x07C1, 0xFFFF,
+	0x0439, 0x0653, 0xFFFF, 0xFFFF, 0xFFFF, 0x0645, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04C5, 0x0094,
+	0x053A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03BC, 0xFFFF, 0x038E, 0x0214, 0x0757, 0xFFFF, 0x002E, 0x04B1, 0x0190,
+	0xFFFF, 0x0247, 0xFFFF, 0x0606, 0xFFFF, 0xFFFF, 0x02D9, 0xFFFF, 0xFFFF, 0xFFFF, 0x07F1, 0xFFFF, 0x021E, 0x05F3, 0x06B7, 0x04B7,
+};
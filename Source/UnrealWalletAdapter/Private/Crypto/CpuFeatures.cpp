@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/CpuFeatures.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+
+static void CpuId(int32 Leaf, int32 SubLeaf, int32 Registers[4])
+{
+	__cpuidex(Registers, Leaf, SubLeaf);
+}
+
+static uint64 ReadXcr0()
+{
+	return _xgetbv(0);
+}
+#else
+#include <cpuid.h>
+
+static void CpuId(int32 Leaf, int32 SubLeaf, int32 Registers[4])
+{
+	uint32 Eax, Ebx, Ecx, Edx;
+	__cpuid_count(Leaf, SubLeaf, Eax, Ebx, Ecx, Edx);
+	Registers[0] = Eax;
+	Registers[1] = Ebx;
+	Registers[2] = Ecx;
+	Registers[3] = Edx;
+}
+
+static uint64 ReadXcr0()
+{
+	uint32 Eax, Edx;
+	__asm__ volatile("xgetbv" : "=a"(Eax), "=d"(Edx) : "c"(0));
+	return static_cast<uint64>(Edx) << 32 | Eax;
+}
+#endif
+
+static FCpuFeatures DetectCpuFeatures()
+{
+	FCpuFeatures Features;
+
+	int32 Registers[4];
+	CpuId(0, 0, Registers);
+	const int32 MaxLeaf = Registers[0];
+
+	CpuId(1, 0, Registers);
+	const bool bOSXSAVE = (Registers[2] & (1 << 27)) != 0;
+	const bool bAVX = (Registers[2] & (1 << 28)) != 0;
+	Features.bAES = (Registers[2] & (1 << 25)) != 0;
+
+	// The OS has to save the upper halves of the YMM registers, or AVX code corrupts other threads.
+	const bool bYmmState = bOSXSAVE && (ReadXcr0() & 0x6) == 0x6;
+
+	if (MaxLeaf >= 7)
+	{
+		CpuId(7, 0, Registers);
+		Features.bAVX2 = bAVX && bYmmState && (Registers[1] & (1 << 5)) != 0;
+		Features.bSHA256 = (Registers[1] & (1 << 29)) != 0;
+	}
+
+	return Features;
+}
+
+#else
+
+#if (PLATFORM_ANDROID || PLATFORM_LINUX) && defined(__aarch64__)
+#include <sys/auxv.h>
+#elif PLATFORM_APPLE
+#include <sys/sysctl.h>
+#endif
+
+static FCpuFeatures DetectCpuFeatures()
+{
+	FCpuFeatures Features;
+	// Advanced SIMD is part of the base AArch64 architecture.
+	Features.bNEON = CRYPTO_HAS_NEON;
+
+	// Optional extensions, only the kernel can tell.
+#if (PLATFORM_ANDROID || PLATFORM_LINUX) && defined(__aarch64__)
+	const unsigned long HwCaps = getauxval(AT_HWCAP);
+	Features.bAES = (HwCaps & (1 << 3)) != 0; // HWCAP_AES
+	Features.bSHA256 = (HwCaps & (1 << 6)) != 0; // HWCAP_SHA2
+	Features.bSHA512 = (HwCaps & (1 << 21)) != 0; // HWCAP_SHA512
+#elif PLATFORM_APPLE && defined(__aarch64__)
+	// Every Apple arm64 CPU has the ARMv8 crypto extensions.
+	Features.bAES = true;
+	Features.bSHA256 = true;
+	int32 Value = 0;
+	size_t Size = sizeof(Value);
+	Features.bSHA512 = sysctlbyname("hw.optional.armv8_2_sha512", &Value, &Size, nullptr, 0) == 0 && Value != 0;
+#endif
+
+	return Features;
+}
+
+#endif
+
+const FCpuFeatures& FCpuFeatures::Get()
+{
+	static const FCpuFeatures Features = DetectCpuFeatures();
+	return Features;
+}
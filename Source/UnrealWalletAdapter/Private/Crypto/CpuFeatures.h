@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+	#include <immintrin.h>
+#elif PLATFORM_CPU_ARM_FAMILY && (defined(__aarch64__) || defined(_M_ARM64))
+	#include <arm_neon.h>
+	#define CRYPTO_HAS_NEON 1
+#endif
+
+#ifndef CRYPTO_HAS_NEON
+	#define CRYPTO_HAS_NEON 0
+#endif
+
+// Lets a single function use AVX2 without building the whole module for it. MSVC accepts the intrinsics as is.
+#if PLATFORM_CPU_X86_FAMILY && (defined(__clang__) || defined(__GNUC__))
+	#define CRYPTO_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define CRYPTO_TARGET_AVX2
+#endif
+
+/** Instruction set extensions the crypto code has faster paths for, detected once per process. */
+struct FCpuFeatures
+{
+	bool bAVX2 = false;
+	bool bNEON = false;
+	/** The ARMv8.2 SHA512 instructions. */
+	bool bSHA512 = false;
+	/** SHA-256 instructions, the SHA extensions on x86 and the ARMv8 SHA2 ones. */
+	bool bSHA256 = false;
+	/** AES instructions, AES-NI on x86 and the ARMv8 AES ones. */
+	bool bAES = false;
+
+	static const FCpuFeatures& Get();
+};
@@ -0,0 +1,218 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/CryptoDispatch.h"
+
+#include "Crypto/Base58.h"
+#include "Crypto/CpuFeatures.h"
+#include "Crypto/ed25519/ed25519.h"
+#include "Crypto/ed25519/sc.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ConfigCacheIni.h"
+
+DECLARE_LOG_CATEGORY_CLASS(LogCryptoDispatch, Log, All);
+
+static const TCHAR* ConfigSection = TEXT("/Script/UnrealWalletAdapter.Crypto");
+
+static TAutoConsoleVariable<FString> CVarEd25519Backend(
+	TEXT("Solana.Crypto.Ed25519Backend"),
+	TEXT("auto"),
+	TEXT("Backend of ed25519 scalar multiplication and batched SHA-512: auto, portable or avx2."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<FString> CVarSha512Backend(
+	TEXT("Solana.Crypto.Sha512Backend"),
+	TEXT("auto"),
+	TEXT("Backend of SHA-512: auto, portable or sha512."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<FString> CVarBase58Backend(
+	TEXT("Solana.Crypto.Base58Backend"),
+	TEXT("auto"),
+	TEXT("Backend of batched base58 key decoding: auto, portable, avx2 or neon."),
+	ECVF_ReadOnly);
+
+struct FKernelInfo
+{
+	const TCHAR* Name;
+	const TCHAR* ConfigKey;
+	TAutoConsoleVariable<FString>& Variable;
+	/** Fastest first, ending with the portable one. */
+	TArray<ECryptoBackend> Backends;
+};
+
+static FKernelInfo Kernels[] = {
+	{ TEXT("Ed25519"), TEXT("Ed25519Backend"), CVarEd25519Backend, { ECryptoBackend::AVX2, ECryptoBackend::Portable } },
+	{ TEXT("SHA-512"), TEXT("Sha512Backend"), CVarSha512Backend, { ECryptoBackend::SHA512, ECryptoBackend::Portable } },
+	{ TEXT("Base58"), TEXT("Base58Backend"), CVarBase58Backend, { ECryptoBackend::AVX2, ECryptoBackend::NEON, ECryptoBackend::Portable } },
+};
+static_assert(UE_ARRAY_COUNT(Kernels) == static_cast<int32>(ECryptoKernel::Num), "Every kernel needs its info");
+
+static ECryptoBackend SelectedBackends[static_cast<int32>(ECryptoKernel::Num)] = {};
+
+static bool IsSupported(ECryptoBackend Backend)
+{
+	const FCpuFeatures& Cpu = FCpuFeatures::Get();
+	switch (Backend)
+	{
+	case ECryptoBackend::AVX2:
+		return Cpu.bAVX2;
+	case ECryptoBackend::NEON:
+		return Cpu.bNEON;
+	case ECryptoBackend::SHA512:
+		return Cpu.bSHA512;
+	default:
+		return true;
+	}
+}
+
+// Switches the kernel to the backend, false if this build has no code for it or its known answer tests fail.
+static bool Apply(ECryptoKernel Kernel, ECryptoBackend Backend)
+{
+	switch (Kernel)
+	{
+	case ECryptoKernel::Ed25519:
+		if (Backend == ECryptoBackend::Portable)
+		{
+			ed25519_enable_avx2(0);
+			return true;
+		}
+		return Backend == ECryptoBackend::AVX2 && ed25519_enable_avx2(1) != 0;
+	case ECryptoKernel::Sha512:
+		if (Backend == ECryptoBackend::Portable)
+		{
+			ed25519_enable_sha512_ext(0);
+			return true;
+		}
+		return Backend == ECryptoBackend::SHA512 && ed25519_enable_sha512_ext(1) != 0;
+	case ECryptoKernel::Base58:
+		return FBase58::SetKeyBackend(Backend);
+	default:
+		return false;
+	}
+}
+
+static ECryptoBackend Bind(ECryptoKernel Kernel)
+{
+	const FKernelInfo& Info = Kernels[static_cast<int32>(Kernel)];
+	const FString Requested = Info.Variable.GetValueOnGameThread().TrimStartAndEnd();
+
+	if (!Requested.IsEmpty() && Requested != TEXT("auto"))
+	{
+		const ECryptoBackend* Forced = Info.Backends.FindByPredicate([&Requested](ECryptoBackend Backend)
+		{
+			return Requested == FCryptoDispatch::GetBackendName(Backend);
+		});
+		if (Forced && IsSupported(*Forced) && Apply(Kernel, *Forced))
+			return *Forced;
+
+		UE_LOG(LogCryptoDispatch, Warning, TEXT("No %s backend %s on this build and CPU, picking one"), Info.Name, *Requested);
+	}
+
+	for (const ECryptoBackend Backend : Info.Backends)
+	{
+		if (IsSupported(Backend) && Apply(Kernel, Backend))
+			return Backend;
+	}
+	return ECryptoBackend::Portable;
+}
+
+void FCryptoDispatch::Initialize()
+{
+	// The ini sets the console variables, so both ways of forcing a backend go through one path. They are read
+	// only from here on: the kernels are bound once, before any other thread runs crypto code.
+	for (FKernelInfo& Info : Kernels)
+	{
+		FString Value;
+		if (GConfig->GetString(ConfigSection, Info.ConfigKey, Value, GGameIni))
+		{
+			Info.Variable->Set(*Value, ECVF_SetByProjectSetting);
+		}
+	}
+
+	FString Selection;
+	for (int32 Index = 0; Index < static_cast<int32>(ECryptoKernel::Num); Index++)
+	{
+		SelectedBackends[Index] = Bind(static_cast<ECryptoKernel>(Index));
+		Selection += FString::Printf(TEXT("%s %s, "), Kernels[Index].Name, GetBackendName(SelectedBackends[Index]));
+	}
+
+	// Wider windows trade memory for faster key generation and signing, 0 keeps the built-in table.
+	// Built here once, as the table is never swapped while other threads may read it.
+	int32 BaseWindow = 5;
+	GConfig->GetInt(ConfigSection, TEXT("Ed25519BaseWindow"), BaseWindow, GGameIni);
+	if (BaseWindow != 0 && !ed25519_use_base_window(BaseWindow))
+	{
+		UE_LOG(LogCryptoDispatch, Warning, TEXT("No ed25519 base table for Ed25519BaseWindow=%d, using the built-in one"), BaseWindow);
+	}
+
+	// OpenSSL picks its own SHA-256 and AES code from the same CPU features, logged so reports show the whole picture.
+	const FCpuFeatures& Cpu = FCpuFeatures::Get();
+	UE_LOG(LogCryptoDispatch, Log, TEXT("Crypto backends: %sbase table window %d, SHA-256 and AES by OpenSSL (SHA instructions %s, AES instructions %s)"),
+		*Selection,
+		ed25519_get_base_window(),
+		Cpu.bSHA256 ? TEXT("present") : TEXT("absent"),
+		Cpu.bAES ? TEXT("present") : TEXT("absent"));
+}
+
+ECryptoBackend FCryptoDispatch::GetBackend(ECryptoKernel Kernel)
+{
+	return SelectedBackends[static_cast<int32>(Kernel)];
+}
+
+const TCHAR* FCryptoDispatch::GetBackendName(ECryptoBackend Backend)
+{
+	switch (Backend)
+	{
+	case ECryptoBackend::AVX2:
+		return TEXT("avx2");
+	case ECryptoBackend::NEON:
+		return TEXT("neon");
+	case ECryptoBackend::SHA512:
+		return TEXT("sha512");
+	default:
+		return TEXT("portable");
+	}
+}
+
+const TCHAR* FCryptoDispatch::GetKernelName(ECryptoKernel Kernel)
+{
+	return Kernels[static_cast<int32>(Kernel)].Name;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSha512Test, "Solana.Crypto.Sha512", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSha512Test::RunTest(const FString& Parameters)
+{
+	// The FIPS 180-2 known answer tests, on the backends in use.
+	AddInfo(FString::Printf(TEXT("SHA-512 backend %s, Ed25519 backend %s"),
+		FCryptoDispatch::GetBackendName(FCryptoDispatch::GetBackend(ECryptoKernel::Sha512)),
+		FCryptoDispatch::GetBackendName(FCryptoDispatch::GetBackend(ECryptoKernel::Ed25519))));
+	TestTrue(TEXT("SHA-512 known answer tests"), ed25519_sha512_self_test() != 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScalarTest, "Solana.Crypto.Scalar", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FScalarTest::RunTest(const FString& Parameters)
+{
+	// The 64 bit scalar arithmetic against the 21 bit limb code, on edge cases and pseudo-random inputs.
+	AddInfo(FString::Printf(TEXT("%s scalar backend"), ED25519_SC64 ? TEXT("64 bit") : TEXT("21 bit")));
+	TestTrue(TEXT("Scalar arithmetic differential test"), ed25519_sc_self_test() != 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFieldTest, "Solana.Crypto.Field", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFieldTest::RunTest(const FString& Parameters)
+{
+	// The radix 2^51 field arithmetic against the radix 2^25.5 code, on edge encodings and pseudo-random inputs.
+	TestTrue(TEXT("Field arithmetic differential test"), ed25519_fe_self_test() != 0);
+	return true;
+}
+
+#endif
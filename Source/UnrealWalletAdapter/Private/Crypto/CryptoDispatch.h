@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Implementations a crypto kernel can run, each but the portable one needing an instruction set extension. */
+enum class ECryptoBackend : uint8
+{
+	Portable,
+	AVX2,
+	NEON,
+	/** The ARMv8.2 SHA512 instructions. */
+	SHA512,
+};
+
+/** The crypto code with more than one implementation. */
+enum class ECryptoKernel : uint8
+{
+	/** Scalar multiplication, and SHA-512 of four messages at once. */
+	Ed25519,
+	/** SHA-512 of one message at a time. */
+	Sha512,
+	/** Classification of the characters of base58 keys. */
+	Base58,
+	Num
+};
+
+/**
+ * Picks the implementation of each crypto kernel once, at module startup: the fastest one the CPU supports,
+ * unless the Ed25519Backend, Sha512Backend or Base58Backend keys of [/Script/UnrealWalletAdapter.Crypto] in
+ * the game ini force one. The choices are logged.
+ *
+ * The Solana.Crypto.*Backend console variables show the ini values and are read-only: nothing switches a kernel
+ * after startup, as other threads may be running it. Benchmarks compare backends through entry points that take the
+ * backend as an argument instead.
+ * A backend the build or the CPU lacks is refused with a warning and the automatic choice is used instead.
+ */
+class FCryptoDispatch
+{
+public:
+	static void Initialize();
+
+	static ECryptoBackend GetBackend(ECryptoKernel Kernel);
+
+	static const TCHAR* GetBackendName(ECryptoBackend Backend);
+	static const TCHAR* GetKernelName(ECryptoKernel Kernel);
+};
@@ -17,11 +17,17 @@ Author: Jon Sawler
 */
 #include "CryptoUtils.h"
 
+#include "Async/ParallelFor.h"
+#include "Crypto/HmacSha512.h"
+#include "Crypto/Pbkdf2Sha512.h"
+#include "Crypto/VerificationCache.h"
+#include "Crypto/VerifyingKeyCache.h"
 #include "Crypto/ed25519/ed25519.h"
 
 #define UI UI_ST
 THIRD_PARTY_INCLUDES_START
 #include <openssl/aes.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include "openssl/pem.h"
 #include "openssl/rand.h"
@@ -29,12 +35,6 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #undef UI
 
-#include <string>
-#include <vector>
-
-using std::string;
-using std::vector;
-
 TArray<uint8> FCryptoUtils::SHA256_Digest(const uint8* Data, uint32 Size)
 {
 	TArray<uint8> hash;
@@ -53,58 +53,21 @@ TArray<uint8> FCryptoUtils::SHA512_Digest(const uint8* Data, uint32 Size)
 
 TArray<uint8> FCryptoUtils::HMAC_SHA512(const TArray<uint8>& Data, const FString& Key)
 {
-	TArray<uint8> key;
-	
-	for(int i = 0; i < Key.Len(); i++)
-	{
-		FString str = Key.Mid(i,1);
-		key.Add(*TCHAR_TO_UTF8(*str));
-	}
-
-	return HMAC_SHA512(Data, key);
+	const FTCHARToUTF8 Utf8Key(*Key);
+	return FHmacSha512(reinterpret_cast<const uint8*>(Utf8Key.Get()), Utf8Key.Length()).Compute(Data);
 }
 
 TArray<uint8> FCryptoUtils::HMAC_SHA512(const TArray<uint8>& Data, const TArray<uint8>& Key)
 {
-	EVP_MD_CTX* mdctx = NULL;
-	EVP_PKEY* pkey = NULL;
-	
-	TArray<uint8> Hash;
-	Hash.SetNum(EVP_MAX_MD_SIZE);
-
-	size_t md_len = 0; 
-	const EVP_MD* evp = EVP_sha512();
-	mdctx = EVP_MD_CTX_create();
-
-	if (mdctx)
-	{
-		pkey = EVP_PKEY_new_mac_key(EVP_PKEY_HMAC, NULL, Key.GetData(), Key.Num());
-	};
-	
-	if (pkey)
-	{
-		if (1 == EVP_DigestSignInit(mdctx, NULL, evp, NULL, pkey))
-		{
-			if (1 == EVP_DigestSignUpdate(mdctx, Data.GetData(), Data.Num()))
-			{
-				if (1 == EVP_DigestSignFinal(mdctx, Hash.GetData(), &md_len))
-				{
-					Hash.SetNum(md_len);		
-				}
-			};
-		};
-	}
-
-	EVP_PKEY_free(pkey);
-	
-	return Hash;
+	return FHmacSha512(Key).Compute(Data);
 }
 
 TArray<uint8> FCryptoUtils::GenerateSeed(const char* Mnemonic, int MnemonicSize, const unsigned char* Salt, int SaltSize)
 {
 	TArray<uint8> seed;
-	seed.SetNumZeroed(64);
-	PKCS5_PBKDF2_HMAC(Mnemonic, MnemonicSize, Salt, SaltSize, 2048u, EVP_sha512() , 64, seed.GetData());
+	seed.SetNumZeroed(FPbkdf2Sha512::Bip39SeedSize);
+	FPbkdf2Sha512::DeriveKey(MakeArrayView(reinterpret_cast<const uint8*>(Mnemonic), MnemonicSize), MakeArrayView(Salt, SaltSize),
+		FPbkdf2Sha512::Bip39Iterations, seed.GetData(), seed.Num());
 	return seed;
 }
 
@@ -113,8 +76,29 @@ void FCryptoUtils::GenerateKeyPair(const TArray<uint8>& Seed, TArray<uint8>& Out
 	ed25519_create_keypair(OutPublicKey.GetData(), OutPrivateKey.GetData(), Seed.GetData());
 }
 
+void FCryptoUtils::GenerateKeyPairs(const TArray<uint8>& Seeds, TArray<uint8>& OutPublicKeys, TArray<uint8>& OutPrivateKeys, int32 MinParallelNum)
+{
+	check(Seeds.Num() % 32 == 0);
+
+	// Keys per ed25519_create_keypairs call, the size of the batches it inverts together.
+	static constexpr int32 ChunkSize = 64;
+
+	const int32 Count = Seeds.Num() / 32;
+	OutPublicKeys.SetNumUninitialized(Count * 32);
+	OutPrivateKeys.SetNumUninitialized(Count * 64);
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Count, ChunkSize);
+	ParallelFor(NumChunks, [&Seeds, &OutPublicKeys, &OutPrivateKeys, Count](int32 Chunk)
+	{
+		const int32 First = Chunk * ChunkSize;
+		ed25519_create_keypairs(OutPublicKeys.GetData() + First * 32, OutPrivateKeys.GetData() + First * 64, Seeds.GetData() + First * 32,
+			FMath::Min(ChunkSize, Count - First));
+	}, Count < MinParallelNum ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
 void FCryptoUtils::SignMessage(TArray<uint8>& Signature, const TArray<uint8>& Message, const TArray<uint8>& PrivateKey)
 {
+	Signature.SetNumUninitialized(64);
 	ed25519_sign(Signature.GetData(), Message.GetData(), Message.Num(), PrivateKey.GetData());
 }
 
@@ -123,6 +107,80 @@ bool FCryptoUtils::VerifyMessage(const TArray<uint8>& Signature, const TArray<ui
 	return ed25519_verify(Signature.GetData(), Message.GetData(), Message.Num(), PublicKey.GetData()) != 0;
 }
 
+bool FCryptoUtils::VerifyMessageCached(const TArray<uint8>& Signature, const TArray<uint8>& Message, const TArray<uint8>& PublicKey)
+{
+	if (Signature.Num() != 64 || PublicKey.Num() != 32)
+		return false;
+
+	return FVerificationCache::Verify(Signature.GetData(), Message.GetData(), Message.Num(), PublicKey.GetData(), &FVerifyingKeyCache::Verify);
+}
+
+bool FCryptoUtils::VerifyBatch(const TArray<TArray<uint8>>& Signatures, const TArray<TArray<uint8>>& Messages, const TArray<TArray<uint8>>& PublicKeys, TArray<bool>* OutValid)
+{
+	const int32 Count = Signatures.Num();
+	check(Messages.Num() == Count && PublicKeys.Num() == Count);
+
+	if (OutValid)
+	{
+		OutValid->Init(false, Count);
+	}
+
+	// Malformed entries are invalid without being checked.
+	TArray<int32> Indices;
+	TArray<const uint8*> SignatureData;
+	TArray<const uint8*> MessageData;
+	TArray<size_t> MessageLens;
+	TArray<const uint8*> PublicKeyData;
+	Indices.Reserve(Count);
+	SignatureData.Reserve(Count);
+	MessageData.Reserve(Count);
+	MessageLens.Reserve(Count);
+	PublicKeyData.Reserve(Count);
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		if (Signatures[Index].Num() != 64 || PublicKeys[Index].Num() != 32)
+			continue;
+
+		Indices.Add(Index);
+		SignatureData.Add(Signatures[Index].GetData());
+		MessageData.Add(Messages[Index].GetData());
+		MessageLens.Add(Messages[Index].Num());
+		PublicKeyData.Add(PublicKeys[Index].GetData());
+	}
+
+	// The weights have to be unpredictable to whoever made the signatures.
+	TArray<uint8> Weights;
+	if (!RandomBytes(Weights, Indices.Num() * 16))
+	{
+		bool bAllValid = Indices.Num() == Count;
+		for (int32 Index : Indices)
+		{
+			const bool bValid = ed25519_verify_cofactored(Signatures[Index].GetData(), Messages[Index].GetData(), Messages[Index].Num(), PublicKeys[Index].GetData()) != 0;
+			bAllValid &= bValid;
+			if (OutValid)
+			{
+				(*OutValid)[Index] = bValid;
+			}
+		}
+		return bAllValid;
+	}
+
+	TArray<int> Valid;
+	Valid.SetNumZeroed(Indices.Num());
+	const bool bAllValid = ed25519_verify_batch(SignatureData.GetData(), MessageData.GetData(), MessageLens.GetData(), PublicKeyData.GetData(),
+		Indices.Num(), Weights.GetData(), OutValid ? Valid.GetData() : nullptr) != 0;
+
+	if (OutValid)
+	{
+		for (int32 Entry = 0; Entry < Indices.Num(); Entry++)
+		{
+			(*OutValid)[Indices[Entry]] = Valid[Entry] != 0;
+		}
+	}
+
+	return bAllValid && Indices.Num() == Count;
+}
+
 bool FCryptoUtils::RandomBytes(TArray<uint8>& Salt, int32 Length)
 {
 	if (Length > 0)
@@ -171,23 +229,26 @@ TArray<uint8> FCryptoUtils::Int32ToDataArrayBE(int32 Integer)
 
 TArray<uint32> FCryptoUtils::SplitBytesByBits(const TArray<uint8>& Data, int BitIncrements)
 {
+	check(BitIncrements > 0 && BitIncrements <= 32);
+
 	TArray<uint32> Result;
-	const TBitArray<> BitArray = BytesToBitArray(Data);
 	const int ResultNum = (Data.Num() * 8) / BitIncrements;
-	for (size_t Index = 0; Index < ResultNum; Index++)
+	Result.SetNumUninitialized(ResultNum);
+
+	// Shifted straight off the bytes, most significant bit first, through a window of up to 39 bits.
+	const uint64 Mask = (uint64(1) << BitIncrements) - 1;
+	uint64 Window = 0;
+	int32 NumBits = 0;
+	int32 Byte = 0;
+	for (int32 Index = 0; Index < ResultNum; Index++)
 	{
-		uint32 CurrentWord = 0;
-		for (int32 BitIndex = 0; BitIndex < BitIncrements; ++BitIndex)
+		while (NumBits < BitIncrements)
 		{
-			uint32 DataBit = 0;
-			BitArray.GetRange(Index * BitIncrements + BitIndex, 1, &DataBit);
-			const bool Bit = DataBit != 0;
-			if (Bit)
-			{
-				CurrentWord = CurrentWord | (1 << ((BitIncrements - 1) - BitIndex));
-			}
+			Window = (Window << 8) | Data[Byte++];
+			NumBits += 8;
 		}
-		Result.Add(CurrentWord);
+		NumBits -= BitIncrements;
+		Result[Index] = static_cast<uint32>((Window >> NumBits) & Mask);
 	}
 	return Result;
 }
@@ -252,94 +313,72 @@ TArray<uint8> FCryptoUtils::ShortVectorEncodeLength(int32 Len)
 	return bytes;
 }
 
-std::vector<unsigned char> aes_128_gcm_encrypt(const unsigned char* data, uint32 lenght, std::string key)
+// The first 16 bytes of the password, zero padded, the key of the format EncryptAES128GCM keeps writing.
+static void GetLegacyKey(const FString& Password, uint8 Key[16])
 {
-	size_t enc_length = lenght*3;
-	std::vector<unsigned char> output;
-	output.resize(enc_length,'\0');
-
-	unsigned char tag[AES_BLOCK_SIZE];
-	unsigned char iv[AES_BLOCK_SIZE];
-	RAND_bytes(iv, sizeof(iv));
-	std::copy( iv, iv+16, output.begin()+16);
-
-	std::vector<unsigned char> pass(key.begin(), key.end());
-	pass.resize(16, '\0');
-	
-	int actual_size=0, final_size=0;
-	EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-	EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_SET_IVLEN, 16, nullptr);
-	EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), &pass[0], iv);
-	EVP_EncryptUpdate(e_ctx, &output[32], &actual_size, data, lenght);
-	EVP_EncryptFinal(e_ctx, &output[32+actual_size], &final_size);
-	EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, 16, tag);
-	std::copy( tag, tag+16, output.begin() );
-	std::copy( iv, iv+16, output.begin()+16);
-	output.resize(32 + actual_size+final_size);
-	EVP_CIPHER_CTX_free(e_ctx);
-	return output;
-}
-
-std::vector<unsigned char> aes_128_gcm_decrypt(std::vector<unsigned char> ciphertext, std::string key)
-{
-	unsigned char tag[AES_BLOCK_SIZE];
-	unsigned char iv[AES_BLOCK_SIZE];
-	std::copy( ciphertext.begin(),    ciphertext.begin()+16, tag);
-	std::copy( ciphertext.begin()+16, ciphertext.begin()+32, iv);
-	std::vector<unsigned char> plaintext;
-	plaintext.resize(ciphertext.size(), '\0');
-	
-	std::vector<unsigned char> pass(key.begin(), key.end());
-	pass.resize(16, '\0');
-	
-	int actual_size=0, final_size=0;
-	EVP_CIPHER_CTX *d_ctx = EVP_CIPHER_CTX_new();
-	EVP_DecryptInit(d_ctx, EVP_aes_128_gcm(), &pass[0], iv);
-	EVP_DecryptUpdate(d_ctx, &plaintext[0], &actual_size, &ciphertext[32], ciphertext.size()-32 );
-	EVP_CIPHER_CTX_ctrl(d_ctx, EVP_CTRL_GCM_SET_TAG, 16, tag);
-	EVP_DecryptFinal(d_ctx, &plaintext[actual_size], &final_size);
-	EVP_CIPHER_CTX_free(d_ctx);
-	plaintext.resize(actual_size + final_size, '\0');
-
-	return plaintext;
+	FTCHARToUTF8 Utf8(*Password);
+	FMemory::Memzero(Key, 16);
+	FMemory::Memcpy(Key, Utf8.Get(), FMath::Min(Utf8.Length(), 16));
+	OPENSSL_cleanse(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
 }
 
+// Tag, IV and ciphertext, in that order. The IV field is 16 bytes, of which GCM only ever used the first 12.
 TArray<uint8> FCryptoUtils::EncryptAES128GCM(const TArray<uint8>& Data, const FString& Password)
 {
-	const string key = std::string(TCHAR_TO_UTF8(*Password));
-	const vector<unsigned char> ciphertext = aes_128_gcm_encrypt(Data.GetData(), Data.Num(), key);
-	TArray<uint8> EncryptedData(ciphertext.data(), ciphertext.size());
-	
-	FString EncryptedBase16 = "";
-	for (const uint8& Char : EncryptedData)
+	TArray<uint8> EncryptedData;
+	EncryptedData.SetNumUninitialized(32 + Data.Num());
+	uint8* Tag = EncryptedData.GetData();
+	uint8* IV = Tag + 16;
+
+	uint8 Key[16];
+	GetLegacyKey(Password, Key);
+
+	int32 Len = 0;
+	EVP_CIPHER_CTX* Context = EVP_CIPHER_CTX_new();
+	const bool bEncrypted = Context != nullptr
+		&& RAND_bytes(IV, 16) == 1
+		&& EVP_EncryptInit_ex(Context, EVP_aes_128_gcm(), nullptr, Key, IV) == 1
+		&& EVP_EncryptUpdate(Context, IV + 16, &Len, Data.GetData(), Data.Num()) == 1
+		&& EVP_EncryptFinal_ex(Context, IV + 16 + Len, &Len) == 1
+		&& EVP_CIPHER_CTX_ctrl(Context, EVP_CTRL_GCM_GET_TAG, 16, Tag) == 1;
+	EVP_CIPHER_CTX_free(Context);
+	OPENSSL_cleanse(Key, sizeof(Key));
+
+	if (!bEncrypted)
 	{
-		static const char* HexChars = "0123456789ABCDEF";
-		EncryptedBase16.AppendChar(HexChars[Char / 16]);
-		EncryptedBase16.AppendChar(HexChars[Char % 16]);
+		EncryptedData.Reset();
 	}
-	UE_LOG(LogTemp, Warning, TEXT("%s"), *EncryptedBase16);
-	//GEngine->AddOnScreenDebugMessage(-1, 10, FColor::Red, EncryptedBase16);
-
 	return EncryptedData;
 }
 
 TArray<uint8> FCryptoUtils::DecryptAES128GCM(const TArray<uint8>& EncryptedData, const FString& Password)
 {
-	const string key = std::string(TCHAR_TO_UTF8(*Password));
-	const vector<unsigned char> ciphertext(EncryptedData.GetData(), EncryptedData.GetData() + EncryptedData.Num());
-
-	FString EncryptedBase16 = "";
-	for (const uint8& Char : EncryptedData)
+	TArray<uint8> DecryptedData;
+	if (EncryptedData.Num() < 32)
+		return DecryptedData;
+
+	const uint8* Tag = EncryptedData.GetData();
+	const uint8* IV = Tag + 16;
+	DecryptedData.SetNumUninitialized(EncryptedData.Num() - 32);
+
+	uint8 Key[16];
+	GetLegacyKey(Password, Key);
+
+	int32 Len = 0;
+	EVP_CIPHER_CTX* Context = EVP_CIPHER_CTX_new();
+	const bool bDecrypted = Context != nullptr
+		&& EVP_DecryptInit_ex(Context, EVP_aes_128_gcm(), nullptr, Key, IV) == 1
+		&& EVP_DecryptUpdate(Context, DecryptedData.GetData(), &Len, IV + 16, DecryptedData.Num()) == 1
+		&& EVP_CIPHER_CTX_ctrl(Context, EVP_CTRL_GCM_SET_TAG, 16, const_cast<uint8*>(Tag)) == 1
+		&& EVP_DecryptFinal_ex(Context, DecryptedData.GetData() + Len, &Len) == 1;
+	EVP_CIPHER_CTX_free(Context);
+	OPENSSL_cleanse(Key, sizeof(Key));
+
+	// Nothing of data that fails its tag is handed out.
+	if (!bDecrypted)
 	{
-		static const char* HexChars = "0123456789ABCDEF";
-		EncryptedBase16.AppendChar(HexChars[Char / 16]);
-		EncryptedBase16.AppendChar(HexChars[Char % 16]);
+		OPENSSL_cleanse(DecryptedData.GetData(), DecryptedData.Num());
+		DecryptedData.Reset();
 	}
-	UE_LOG(LogTemp, Warning, TEXT("%s"), *EncryptedBase16);
-	//GEngine->AddOnScreenDebugMessage(-1, 10, FColor::Red, EncryptedBase16);
-
-	vector<unsigned char> plain = aes_128_gcm_decrypt(ciphertext,key);
-
-	TArray<uint8> DecryptedData(plain.data(), plain.size());
 	return DecryptedData;
 }
@@ -25,13 +25,34 @@ public:
 	static TArray<uint8> SHA512_Digest(const uint8* Data, uint32 Size);
 
 	static TArray<uint8> HMAC_SHA512(const TArray<uint8>& Data, const FString& Key);
-	static TArray<uint8> HMAC_SHA512(const TArray<uint8>& Key, const TArray<uint8>& Data);
+	/** Evaluating many messages under one key is cheaper through FHmacSha512. */
+	static TArray<uint8> HMAC_SHA512(const TArray<uint8>& Data, const TArray<uint8>& Key);
 
 	static TArray<uint8> GenerateSeed(const char* Mnemonic, int MnemonicSize, const unsigned char*  Salt, int SaltSize);
 	static void GenerateKeyPair(const TArray<uint8>& Seed, TArray<uint8>& OutPublicKey, TArray<uint8>& OutPrivateKey );
+	/**
+	 * GenerateKeyPair of each 32 byte seed in Seeds, the keys laid out back to back in the outputs, which it sizes.
+	 * Batches share their field inversions, and at least MinParallelNum keys are spread over the task graph workers.
+	 */
+	static void GenerateKeyPairs(const TArray<uint8>& Seeds, TArray<uint8>& OutPublicKeys, TArray<uint8>& OutPrivateKeys, int32 MinParallelNum = 256);
 
+	/**
+	 * Sizes Signature itself. Signing repeatedly with one key is cheaper through FEd25519SigningKey, and messages
+	 * too large to hold sign from files or in pieces through FStreamingSignature.
+	 */
 	static void SignMessage(TArray<uint8>& Signature, const TArray<uint8>& Message, const TArray<uint8>& PrivateKey);
 	static bool VerifyMessage(const TArray<uint8>& Signature, const TArray<uint8>& Message, const TArray<uint8>& PublicKey);
+	/**
+	 * VerifyMessage for payloads and signers seen again and again. Signatures found valid are kept in FVerificationCache,
+	 * and the decoded keys of signers in FVerifyingKeyCache.
+	 */
+	static bool VerifyMessageCached(const TArray<uint8>& Signature, const TArray<uint8>& Message, const TArray<uint8>& PublicKey);
+	/**
+	 * Verifies many signatures at once, true if all are valid. OutValid receives the result of each one, which doesn't
+	 * depend on the rest of the batch. The check is cofactored and refuses small order R and A: it agrees with
+	 * VerifyMessage on signatures with torsion free points, and accepts some with mixed order points VerifyMessage refuses.
+	 */
+	static bool VerifyBatch(const TArray<TArray<uint8>>& Signatures, const TArray<TArray<uint8>>& Messages, const TArray<TArray<uint8>>& PublicKeys, TArray<bool>* OutValid = nullptr);
 	
 	static bool RandomBytes(TArray<uint8>& Salt, int32 Length);
 
@@ -41,6 +62,7 @@ public:
 	static TArray<uint8> Int32ToDataArrayBE(int32 Integer);
 	static TArray<uint8> Int64ToDataArrayBE(int64 Integer);
 
+	/** BIP39 sentences are encoded, checked and generated by FMnemonic. */
 	static TArray<uint32> SplitBytesByBits(const TArray<uint8>& Data, int BitIncrements);
 	static TBitArray<> BytesToBitArray(const TArray<uint8>& Data);
 	
@@ -48,6 +70,10 @@ public:
 
 	static TArray<uint8> ShortVectorEncodeLength(int32 Len);
 
+	/**
+	 * Kept for data already written this way: the key is the password's first 16 bytes, with no key derivation.
+	 * New data goes through FKeystore. Both return an empty array on failure, Decrypt also if the tag doesn't match.
+	 */
 	static TArray<uint8> EncryptAES128GCM(const TArray<uint8>& Data, const FString& Password);
 	static TArray<uint8> DecryptAES128GCM(const TArray<uint8>& EncryptedData, const FString& Password);
 };
@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Ed25519SigningKey.h"
+
+#include "Async/ParallelFor.h"
+#include "Crypto/ed25519/ed25519.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/crypto.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#elif PLATFORM_UNIX || PLATFORM_ANDROID || PLATFORM_APPLE
+#include <sys/mman.h>
+#endif
+
+DECLARE_LOG_CATEGORY_CLASS(LogEd25519SigningKey, Log, All);
+
+static constexpr SIZE_T ExpandedSize = 64;
+
+// Messages signed by one worker task, enough to amortize scheduling.
+static constexpr int32 ParallelChunkSize = 32;
+
+static uint8* AllocateLocked(SIZE_T Size)
+{
+	uint8* Memory = static_cast<uint8*>(FPlatformMemory::BinnedAllocFromOS(Size));
+	check(Memory);
+
+	// Best effort, the process may be over its locked memory limit. The key is still wiped on release.
+#if PLATFORM_WINDOWS
+	const bool bLocked = VirtualLock(Memory, Size) != 0;
+#elif PLATFORM_UNIX || PLATFORM_ANDROID || PLATFORM_APPLE
+	const bool bLocked = mlock(Memory, Size) == 0;
+#else
+	const bool bLocked = false;
+#endif
+	UE_CLOG(!bLocked, LogEd25519SigningKey, Verbose, TEXT("Signing key memory could not be locked"));
+
+	return Memory;
+}
+
+static void FreeLocked(uint8* Memory, SIZE_T Size)
+{
+	OPENSSL_cleanse(Memory, Size);
+
+#if PLATFORM_WINDOWS
+	VirtualUnlock(Memory, Size);
+#elif PLATFORM_UNIX || PLATFORM_ANDROID || PLATFORM_APPLE
+	munlock(Memory, Size);
+#endif
+
+	FPlatformMemory::BinnedFreeToOS(Memory, Size);
+}
+
+FEd25519SigningKey::FEd25519SigningKey(const TArray<uint8>& PrivateKey)
+{
+	check(PrivateKey.Num() == 64);
+
+	Expanded = AllocateLocked(ExpandedSize);
+	ed25519_expand_private_key(Expanded, PrivateKey.GetData());
+	FMemory::Memcpy(PublicKey, PrivateKey.GetData() + 32, sizeof(PublicKey));
+}
+
+FEd25519SigningKey::FEd25519SigningKey(const uint8* ExpandedKey, const uint8* InPublicKey)
+{
+	Expanded = AllocateLocked(ExpandedSize);
+	FMemory::Memcpy(Expanded, ExpandedKey, ExpandedSize);
+	FMemory::Memcpy(PublicKey, InPublicKey, sizeof(PublicKey));
+}
+
+FEd25519SigningKey::~FEd25519SigningKey()
+{
+	FreeLocked(Expanded, ExpandedSize);
+}
+
+void FEd25519SigningKey::Sign(const uint8* Message, int32 MessageLen, uint8* OutSignature) const
+{
+	ed25519_sign_expanded(OutSignature, Message, MessageLen, PublicKey, Expanded);
+}
+
+TArray<uint8> FEd25519SigningKey::Sign(const TArray<uint8>& Message) const
+{
+	TArray<uint8> Signature;
+	Signature.SetNumUninitialized(64);
+	Sign(Message.GetData(), Message.Num(), Signature.GetData());
+	return Signature;
+}
+
+void FEd25519SigningKey::Sign(TConstArrayView<TArray<uint8>> Messages, TArray<uint8>& OutSignatures, int32 MinParallelNum) const
+{
+	OutSignatures.SetNumUninitialized(Messages.Num() * 64);
+	uint8* Signatures = OutSignatures.GetData();
+
+	if (Messages.Num() < MinParallelNum)
+	{
+		for (int32 First = 0; First < Messages.Num(); First += ParallelChunkSize)
+		{
+			SignChunk(Messages, First, FMath::Min(First + ParallelChunkSize, Messages.Num()), Signatures);
+		}
+		return;
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Messages.Num(), ParallelChunkSize);
+	ParallelFor(NumChunks, [this, Messages, Signatures](int32 Chunk)
+	{
+		const int32 First = Chunk * ParallelChunkSize;
+		SignChunk(Messages, First, FMath::Min(First + ParallelChunkSize, Messages.Num()), Signatures);
+	});
+}
+
+void FEd25519SigningKey::SignChunk(TConstArrayView<TArray<uint8>> Messages, int32 First, int32 End, uint8* Signatures) const
+{
+	// Signed together, so their hashes can be computed four at a time.
+	TArray<const uint8*, TInlineAllocator<ParallelChunkSize>> MessageData;
+	TArray<size_t, TInlineAllocator<ParallelChunkSize>> MessageLens;
+	for (int32 Index = First; Index < End; Index++)
+	{
+		MessageData.Add(Messages[Index].GetData());
+		MessageLens.Add(Messages[Index].Num());
+	}
+
+	ed25519_sign_expanded_many(Signatures + First * 64, MessageData.GetData(), MessageLens.GetData(), MessageData.Num(), PublicKey, Expanded);
+}
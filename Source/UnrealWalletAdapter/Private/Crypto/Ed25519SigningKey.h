@@ -0,0 +1,45 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * An ed25519 private key expanded once for signing many messages.
+ *
+ * The secret scalar and nonce prefix are hashed out of the seed at construction, instead of on every
+ * ed25519_sign, and live in memory locked out of swap that is wiped when the key is destroyed.
+ * Signing is safe from any thread.
+ */
+class FEd25519SigningKey
+{
+public:
+	/** From a 64 byte private key, the seed followed by the public key. */
+	explicit FEd25519SigningKey(const TArray<uint8>& PrivateKey);
+	/** From a 64 byte expanded key, the secret scalar followed by the nonce prefix, such as FVanityGrinder finds. */
+	FEd25519SigningKey(const uint8* ExpandedKey, const uint8* InPublicKey);
+	~FEd25519SigningKey();
+
+	UE_NONCOPYABLE(FEd25519SigningKey);
+
+	TArray<uint8> GetPublicKey() const { return TArray<uint8>(PublicKey, 32); }
+
+	void Sign(const uint8* Message, int32 MessageLen, uint8* OutSignature) const;
+	TArray<uint8> Sign(const TArray<uint8>& Message) const;
+
+	/**
+	 * Signs each message into the next 64 bytes of OutSignatures. Spans of at least MinParallelNum
+	 * messages are spread over the task graph workers.
+	 */
+	void Sign(TConstArrayView<TArray<uint8>> Messages, TArray<uint8>& OutSignatures, int32 MinParallelNum = 256) const;
+
+private:
+	/** Signs Messages[First, End) into their places in Signatures. */
+	void SignChunk(TConstArrayView<TArray<uint8>> Messages, int32 First, int32 End, uint8* Signatures) const;
+
+	uint8 PublicKey[32];
+	/** ed25519_expand_private_key output, in its own locked pages. */
+	uint8* Expanded;
+};
@@ -18,11 +18,24 @@ Author: Jon Sawler
 
 #include "FEd25519Bip39.h"
 
+#include "Async/ParallelFor.h"
 #include "CryptoUtils.h"
+#include "Crypto/HmacSha512.h"
+#include "Crypto/ed25519/ed25519.h"
+#include "Misc/AutomationTest.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/crypto.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
 
 const uint32 HardenedOffset = 0x80000000;
 const FString Curve = "ed25519 seed";
 
+// Accounts derived by one worker task, enough to amortize scheduling.
+static constexpr int32 ParallelChunkSize = 16;
+
 FEd25519Bip39::FEd25519Bip39(const TArray<uint8>& seed)
 {
     TArray<uint8> hmac = FCryptoUtils::HMAC_SHA512(seed, Curve);
@@ -37,54 +50,169 @@ FEd25519Bip39::FEd25519Bip39(const TArray<uint8>& seed)
             KeyPair.ChainCode.Add(hmac[i]);
         }
     }
+
+    FNode Master;
+    FNode Purpose;
+    FMemory::Memcpy(Master.Key, hmac.GetData(), 32);
+    FMemory::Memcpy(Master.ChainCode, hmac.GetData() + 32, 32);
+    DeriveChild(Master, 44 + HardenedOffset, Purpose);
+    DeriveChild(Purpose, 501 + HardenedOffset, CoinNode);
+
+    OPENSSL_cleanse(hmac.GetData(), hmac.Num());
+    OPENSSL_cleanse(&Master, sizeof(Master));
+    OPENSSL_cleanse(&Purpose, sizeof(Purpose));
+}
+
+FEd25519Bip39::~FEd25519Bip39()
+{
+    OPENSSL_cleanse(&CoinNode, sizeof(CoinNode));
 }
 
 TArray<uint8> FEd25519Bip39::DeriveAccountPath(uint32 index)
 {
     //Bip39 Derivation Path = "m/44'/501'/index'/0'"
-    TArray<uint32> segments = { 44, 501, index, 0 };
+    TArray<uint8> Seed;
+    Seed.SetNumUninitialized(32);
+    DeriveAccountSeed(index, Seed.GetData());
+    return Seed;
+}
+
+TArray<uint8> FEd25519Bip39::DeriveAccountPath(const TArray<uint32>& Segments)
+{
+    // Paths under m/44'/501' continue from the node derived in the constructor.
+    const bool bUnderCoin = Segments.Num() >= 2 && Segments[0] == 44 && Segments[1] == 501;
 
-    Bip39KeyPair result = KeyPair;
-    for(int i = 0; i < segments.Num(); i++)
+    FNode Result = CoinNode;
+    if (!bUnderCoin)
     {
-        result = GetChildKeyDerivation(result.MasterKey, result.ChainCode, segments[i] + HardenedOffset);
+        FMemory::Memcpy(Result.Key, KeyPair.MasterKey.GetData(), 32);
+        FMemory::Memcpy(Result.ChainCode, KeyPair.ChainCode.GetData(), 32);
     }
 
-    return result.MasterKey;
+    for(int i = bUnderCoin ? 2 : 0; i < Segments.Num(); i++)
+    {
+        DeriveChild(Result, Segments[i] + HardenedOffset, Result);
+    }
+
+    TArray<uint8> Key(Result.Key, 32);
+    OPENSSL_cleanse(&Result, sizeof(Result));
+    return Key;
 }
 
-TArray<uint8> FEd25519Bip39::DeriveAccountPath(const TArray<uint32>& Segments)
+void FEd25519Bip39::DeriveAccounts(uint32 FirstIndex, int32 Num, TArray<uint8>& OutPublicKeys, TArray<uint8>& OutPrivateKeys, int32 MinParallelNum) const
 {
-    Bip39KeyPair Result = KeyPair;
-    for(int i = 0; i < Segments.Num(); i++)
+    OutPublicKeys.SetNumUninitialized(Num * 32);
+    OutPrivateKeys.SetNumUninitialized(Num * 64);
+    uint8* PublicKeys = OutPublicKeys.GetData();
+    uint8* PrivateKeys = OutPrivateKeys.GetData();
+
+    const int32 NumChunks = FMath::DivideAndRoundUp(Num, ParallelChunkSize);
+    ParallelFor(NumChunks, [this, FirstIndex, Num, PublicKeys, PrivateKeys](int32 Chunk)
     {
-        Result = GetChildKeyDerivation(Result.MasterKey, Result.ChainCode, Segments[i] + HardenedOffset);
-    }
+        const int32 End = FMath::Min((Chunk + 1) * ParallelChunkSize, Num);
+        for (int32 Index = Chunk * ParallelChunkSize; Index < End; Index++)
+        {
+            uint8 Seed[32];
+            DeriveAccountSeed(FirstIndex + Index, Seed);
+            ed25519_create_keypair(PublicKeys + Index * 32, PrivateKeys + Index * 64, Seed);
+            OPENSSL_cleanse(Seed, sizeof(Seed));
+        }
+    }, Num < MinParallelNum ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void FEd25519Bip39::DeriveChild(const FNode& Parent, uint32 Index, FNode& OutChild)
+{
+    // SLIP-10 hardened child: HMAC-SHA512(chain code, 0x00 || key || index), on the stack.
+    uint8 Data[37];
+    Data[0] = 0;
+    FMemory::Memcpy(Data + 1, Parent.Key, 32);
+    Data[33] = static_cast<uint8>(Index >> 24);
+    Data[34] = static_cast<uint8>(Index >> 16);
+    Data[35] = static_cast<uint8>(Index >> 8);
+    Data[36] = static_cast<uint8>(Index);
+
+    uint8 Hmac[FHmacSha512::DigestSize];
+    FHmacSha512(Parent.ChainCode, 32).Compute(Data, sizeof(Data), Hmac);
+
+    FMemory::Memcpy(&OutChild, Hmac, sizeof(OutChild));
+    OPENSSL_cleanse(Data, sizeof(Data));
+    OPENSSL_cleanse(Hmac, sizeof(Hmac));
+}
+
+void FEd25519Bip39::DeriveAccountSeed(uint32 Index, uint8* OutSeed) const
+{
+    FNode Account;
+    DeriveChild(CoinNode, Index + HardenedOffset, Account);
+    DeriveChild(Account, HardenedOffset, Account);
 
-    return Result.MasterKey;
+    FMemory::Memcpy(OutSeed, Account.Key, 32);
+    OPENSSL_cleanse(&Account, sizeof(Account));
 }
 
-Bip39KeyPair FEd25519Bip39::GetChildKeyDerivation(const TArray<uint8>& key, const TArray<uint8>& chainCode, uint32 index)
+#if WITH_DEV_AUTOMATION_TESTS
+
+static bool MatchesHex(const TArray<uint8>& Bytes, const TCHAR* Hex)
 {
-    TArray<uint8> buffer;
-    buffer.Add(0);
-    buffer.Append(key);
-    buffer.Append(FCryptoUtils::Int32ToDataArrayBE(index));
+    TArray<uint8> Expected;
+    Expected.SetNumUninitialized(FCString::Strlen(Hex) / 2);
+    HexToBytes(Hex, Expected.GetData());
+    return Bytes == Expected;
+}
 
-    TArray<uint8> hmac = FCryptoUtils::HMAC_SHA512( buffer, chainCode );
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEd25519Bip39Test, "Solana.Crypto.AccountDerivation", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 
-    Bip39KeyPair keypair;
-    for(int i = 0; i < 64; i++)
+bool FEd25519Bip39Test::RunTest(const FString& Parameters)
+{
+    // SLIP-10 ed25519 test vector 1, the key at each depth of m/0'/1'/2'/2'/1000000000'.
+    static const uint32 Path[] = { 0, 1, 2, 2, 1000000000 };
+    static const TCHAR* Keys[] = {
+        TEXT("2b4be7f19ee27bbf30c667b642d5f4aa69fd169872f8fc3059c08ebae2eb19e7"),
+        TEXT("68e0fe46dfb67e368c75379acec591dad19df3cde26e63b93a8e704f1dade7a3"),
+        TEXT("b1d0bad404bf35da785a64ca1ac54b2617211d2777696fbffaf208f746ae84f2"),
+        TEXT("92a5b23c0b8a99e37d07df3fb9966917f5d06e02ddbd909c7e184371463e9fc9"),
+        TEXT("30d1dc7e5fc04c31219ab25a27ae00b50f6fd66622f6e9c913253d6511d1e662"),
+        TEXT("8f94d394a8e8fd6b1bc2f3f49f5c47e385281d5c17e65324b0f62483e37e8793"),
+    };
+
+    TArray<uint8> Seed;
+    Seed.SetNumUninitialized(16);
+    HexToBytes(TEXT("000102030405060708090a0b0c0d0e0f"), Seed.GetData());
+    FEd25519Bip39 Bip39(Seed);
+
+    TestTrue(TEXT("Master key"), MatchesHex(Bip39.KeyPair.MasterKey, Keys[0]));
+    for (int32 Depth = 0; Depth < UE_ARRAY_COUNT(Keys); Depth++)
     {
-        if( i < 32 )
-        {
-            keypair.MasterKey.Add(hmac[i]);
-        }
-        else
+        TestTrue(FString::Printf(TEXT("Vector 1 key at depth %d"), Depth), MatchesHex(Bip39.DeriveAccountPath(TArray<uint32>(Path, Depth)), Keys[Depth]));
+    }
+
+    // m/44'/501'/0'/0' of the same seed, through the node cached by the constructor.
+    TestTrue(TEXT("Account 0"), MatchesHex(Bip39.DeriveAccountPath(0), TEXT("f1f890d181d1bc1fdfdb9e1911e59285b9f8a28c5c31c13e56747e6993bfa053")));
+    for (const uint32 Index : { 0u, 1u, 17u, 0x7fffffffu })
+    {
+        TestTrue(FString::Printf(TEXT("Account %u matches its full path"), Index), Bip39.DeriveAccountPath(Index) == Bip39.DeriveAccountPath({ 44, 501, Index, 0 }));
+    }
+
+    // A partial last chunk included, once on the calling thread and once spread over the workers.
+    constexpr uint32 FirstIndex = 3;
+    constexpr int32 Num = 40;
+    for (const int32 MinParallelNum : { Num + 1, 1 })
+    {
+        TArray<uint8> PublicKeys;
+        TArray<uint8> PrivateKeys;
+        Bip39.DeriveAccounts(FirstIndex, Num, PublicKeys, PrivateKeys, MinParallelNum);
+
+        int32 NumMatching = 0;
+        for (int32 Index = 0; Index < Num; Index++)
         {
-            keypair.ChainCode.Add(hmac[i]);
+            uint8 PublicKey[32];
+            uint8 PrivateKey[64];
+            ed25519_create_keypair(PublicKey, PrivateKey, Bip39.DeriveAccountPath(FirstIndex + Index).GetData());
+            NumMatching += FMemory::Memcmp(PublicKeys.GetData() + Index * 32, PublicKey, 32) == 0
+                && FMemory::Memcmp(PrivateKeys.GetData() + Index * 64, PrivateKey, 64) == 0;
         }
+        TestEqual(MinParallelNum > Num ? TEXT("DeriveAccounts on one thread") : TEXT("DeriveAccounts in parallel"), NumMatching, Num);
     }
-
-    return keypair;
+    return true;
 }
+
+#endif
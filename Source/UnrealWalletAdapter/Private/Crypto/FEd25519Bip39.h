@@ -29,13 +29,33 @@ class FEd25519Bip39
 public:
 
 	FEd25519Bip39(const TArray<uint8>& seed);
+	~FEd25519Bip39();
 
 	TArray<uint8> DeriveAccountPath(uint32 index);
 	TArray<uint8> DeriveAccountPath(const TArray<uint32>& Segments);
 
+	/**
+	 * Keypairs of the Num accounts m/44'/501'/index'/0' from FirstIndex on, back to back in Num * 32 bytes of
+	 * OutPublicKeys and Num * 64 bytes of OutPrivateKeys. Spans of at least MinParallelNum accounts are spread
+	 * over the task graph workers.
+	 */
+	void DeriveAccounts(uint32 FirstIndex, int32 Num, TArray<uint8>& OutPublicKeys, TArray<uint8>& OutPrivateKeys, int32 MinParallelNum = 64) const;
+
 	Bip39KeyPair KeyPair;
 
 private:
 
-	Bip39KeyPair GetChildKeyDerivation(const TArray<uint8>& key, const TArray<uint8>& chainCode, uint32 index);
+	struct FNode
+	{
+		uint8 Key[32];
+		uint8 ChainCode[32];
+	};
+
+	static void DeriveChild(const FNode& Parent, uint32 Index, FNode& OutChild);
+
+	/** The 32 byte seed of account m/44'/501'/index'/0'. */
+	void DeriveAccountSeed(uint32 Index, uint8* OutSeed) const;
+
+	/** m/44'/501', where every account path starts. Derived once so each account only costs its last two levels. */
+	FNode CoinNode;
 };
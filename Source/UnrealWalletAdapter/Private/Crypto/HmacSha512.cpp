@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/HmacSha512.h"
+
+#include "Crypto/ed25519/ed_sha512.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/crypto.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+static_assert(sizeof(uint64) == sizeof(uint64_t), "The states are handed to ed_sha512 as they are");
+
+static constexpr int32 BlockSize = 128;
+
+/** A context that has compressed the padded key block into State and takes the rest of the message. */
+static void ContinueFrom(sha512_context& Context, const uint64* State)
+{
+	FMemory::Memcpy(Context.state, State, sizeof(Context.state));
+	Context.length = BlockSize * 8;
+	Context.curlen = 0;
+}
+
+FHmacSha512::FHmacSha512(const uint8* Key, int32 KeyLen)
+{
+	// Keys longer than a block are hashed first.
+	uint8 Block[BlockSize] = {};
+	if (KeyLen > BlockSize)
+	{
+		ed_sha512(Key, KeyLen, Block);
+	}
+	else if (KeyLen > 0)
+	{
+		FMemory::Memcpy(Block, Key, KeyLen);
+	}
+
+	sha512_context Context;
+	for (uint8& Byte : Block)
+	{
+		Byte ^= 0x36;
+	}
+	ed_sha512_init(&Context);
+	ed_sha512_update(&Context, Block, BlockSize);
+	FMemory::Memcpy(InnerState, Context.state, sizeof(InnerState));
+
+	// 0x36 ^ 0x5c, turning the inner pad into the outer one.
+	for (uint8& Byte : Block)
+	{
+		Byte ^= 0x6a;
+	}
+	ed_sha512_init(&Context);
+	ed_sha512_update(&Context, Block, BlockSize);
+	FMemory::Memcpy(OuterState, Context.state, sizeof(OuterState));
+
+	OPENSSL_cleanse(Block, sizeof(Block));
+	OPENSSL_cleanse(&Context, sizeof(Context));
+}
+
+FHmacSha512::~FHmacSha512()
+{
+	OPENSSL_cleanse(InnerState, sizeof(InnerState));
+	OPENSSL_cleanse(OuterState, sizeof(OuterState));
+}
+
+void FHmacSha512::Compute(const uint8* Message, int32 MessageLen, uint8* OutDigest) const
+{
+	sha512_context Context;
+	uint8 Inner[DigestSize];
+
+	ContinueFrom(Context, InnerState);
+	ed_sha512_update(&Context, Message, MessageLen);
+	ed_sha512_final(&Context, Inner);
+
+	ContinueFrom(Context, OuterState);
+	ed_sha512_update(&Context, Inner, DigestSize);
+	ed_sha512_final(&Context, OutDigest);
+}
+
+TArray<uint8> FHmacSha512::Compute(TConstArrayView<uint8> Message) const
+{
+	TArray<uint8> Digest;
+	Digest.SetNumUninitialized(DigestSize);
+	Compute(Message.GetData(), Message.Num(), Digest.GetData());
+	return Digest;
+}
+
+void FHmacSha512::Compute(TConstArrayView<TArray<uint8>> Messages, uint8* OutDigests) const
+{
+	const uint64_t* InnerWords = reinterpret_cast<const uint64_t*>(InnerState);
+	const uint64_t* OuterWords = reinterpret_cast<const uint64_t*>(OuterState);
+	const uint64_t* const Inner[4] = { InnerWords, InnerWords, InnerWords, InnerWords };
+	const uint64_t* const Outer[4] = { OuterWords, OuterWords, OuterWords, OuterWords };
+
+	int32 Index = 0;
+	for (; Index + 4 <= Messages.Num(); Index += 4)
+	{
+		sha512_parts Parts[4] = {};
+		uint8 InnerDigests[4][DigestSize];
+		for (int32 Lane = 0; Lane < 4; Lane++)
+		{
+			Parts[Lane].parts[0] = Messages[Index + Lane].GetData();
+			Parts[Lane].lens[0] = Messages[Index + Lane].Num();
+		}
+		ed_sha512_x4_from(Inner, BlockSize, Parts, InnerDigests);
+
+		for (int32 Lane = 0; Lane < 4; Lane++)
+		{
+			Parts[Lane].parts[0] = InnerDigests[Lane];
+			Parts[Lane].lens[0] = DigestSize;
+		}
+		ed_sha512_x4_from(Outer, BlockSize, Parts, reinterpret_cast<uint8(*)[DigestSize]>(OutDigests + Index * DigestSize));
+	}
+
+	for (; Index < Messages.Num(); Index++)
+	{
+		Compute(Messages[Index].GetData(), Messages[Index].Num(), OutDigests + Index * DigestSize);
+	}
+}
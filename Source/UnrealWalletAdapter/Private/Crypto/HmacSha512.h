@@ -0,0 +1,41 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * HMAC-SHA512 under one key, for evaluating it over and over.
+ *
+ * The SHA-512 states after the inner and outer padded key blocks are computed once at construction, so an
+ * evaluation only hashes the message and the inner digest. Nothing is allocated after construction, and the
+ * key states are wiped on destruction. Safe to use from any thread.
+ */
+class FHmacSha512
+{
+public:
+	static constexpr int32 DigestSize = 64;
+
+	FHmacSha512(const uint8* Key, int32 KeyLen);
+	explicit FHmacSha512(TConstArrayView<uint8> Key)
+		: FHmacSha512(Key.GetData(), Key.Num())
+	{
+	}
+	~FHmacSha512();
+
+	void Compute(const uint8* Message, int32 MessageLen, uint8* OutDigest) const;
+	TArray<uint8> Compute(TConstArrayView<uint8> Message) const;
+
+	/** The HMAC of each message into the next DigestSize bytes of OutDigests, four at a time where AVX2 is enabled. */
+	void Compute(TConstArrayView<TArray<uint8>> Messages, uint8* OutDigests) const;
+
+	/** The SHA-512 states after the 128 byte inner and outer padded key blocks, where ed_sha512_x4_from can continue. */
+	const uint64* GetInnerState() const { return InnerState; }
+	const uint64* GetOuterState() const { return OuterState; }
+
+private:
+	uint64 InnerState[8];
+	uint64 OuterState[8];
+};
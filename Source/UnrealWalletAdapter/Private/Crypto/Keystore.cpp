@@ -0,0 +1,435 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Keystore.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/AutomationTest.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+#include <atomic>
+
+DECLARE_LOG_CATEGORY_CLASS(LogKeystore, Log, All);
+
+// Header: magic, version, the FKeystoreParams fields, salt, nonce prefix.
+static constexpr uint8 Magic[4] = { 'S', 'O', 'L', 'K' };
+static constexpr uint8 Version = 1;
+static constexpr int32 ParamsOffset = 5;
+static constexpr int32 SaltOffset = 9;
+static constexpr int32 SaltSize = 16;
+static constexpr int32 NoncePrefixOffset = SaltOffset + SaltSize;
+static constexpr int32 NoncePrefixSize = 7;
+static_assert(NoncePrefixOffset + NoncePrefixSize == FKeystore::HeaderSize, "The header fields fill it");
+
+static constexpr int32 KeySize = 32;
+static constexpr int32 NonceSize = 12;
+// The most scrypt may use, so a crafted header cannot exhaust memory.
+static constexpr uint64 MaxScryptMemory = 1024ull * 1024 * 1024;
+// Bytes each task seals or opens, small chunks are grouped so the task overhead stays negligible.
+static constexpr int64 BytesPerTask = 1024 * 1024;
+// Bytes of a file read at a time, rounded down to whole chunks. The memory used is about twice this.
+static constexpr int64 FileBatchSize = 8 * 1024 * 1024;
+
+static bool IsInRange(const FKeystoreParams& Params)
+{
+	return Params.ScryptLogN >= 1 && Params.ScryptLogN < 40 && Params.ScryptR >= 1 && Params.ScryptP >= 1
+		&& 128ull * Params.ScryptR * ((1ull << Params.ScryptLogN) + Params.ScryptP + 2) <= MaxScryptMemory
+		&& Params.ChunkSizeLog2 >= 12 && Params.ChunkSizeLog2 <= 24;
+}
+
+static bool ReadParams(const uint8* Header, FKeystoreParams& OutParams)
+{
+	if (FMemory::Memcmp(Header, Magic, sizeof(Magic)) != 0 || Header[sizeof(Magic)] != Version)
+		return false;
+
+	OutParams.ScryptLogN = Header[ParamsOffset];
+	OutParams.ScryptR = Header[ParamsOffset + 1];
+	OutParams.ScryptP = Header[ParamsOffset + 2];
+	OutParams.ChunkSizeLog2 = Header[ParamsOffset + 3];
+	return IsInRange(OutParams);
+}
+
+static int64 GetSealedSize(int64 DataSize, int64 ChunkSize)
+{
+	// Empty data still has its last chunk, so it cannot be cut off.
+	const int64 NumChunks = FMath::Max<int64>(FMath::DivideAndRoundUp(DataSize, ChunkSize), 1);
+	return DataSize + NumChunks * FKeystore::TagSize;
+}
+
+static int64 GetOpenedSize(int64 SealedSize, int64 ChunkSize)
+{
+	if (SealedSize < FKeystore::TagSize)
+		return -1;
+
+	const int64 NumChunks = FMath::DivideAndRoundUp(SealedSize, ChunkSize + FKeystore::TagSize);
+	if (SealedSize - (NumChunks - 1) * (ChunkSize + FKeystore::TagSize) < FKeystore::TagSize)
+		return -1;
+	return SealedSize - NumChunks * FKeystore::TagSize;
+}
+
+/** The header of one blob and the key derived for it. */
+struct FStreamKey
+{
+	uint8 Header[FKeystore::HeaderSize];
+	uint8 Key[KeySize];
+	int64 ChunkSize = 0;
+
+	~FStreamKey()
+	{
+		OPENSSL_cleanse(Key, sizeof(Key));
+	}
+
+	/** A header with a fresh salt and nonce prefix. */
+	bool Create(const FKeystoreParams& Params, const FString& Password)
+	{
+		if (!IsInRange(Params))
+		{
+			UE_LOG(LogKeystore, Warning, TEXT("scrypt 2^%d, r %d, p %d with 2^%d byte chunks is out of range"),
+				Params.ScryptLogN, Params.ScryptR, Params.ScryptP, Params.ChunkSizeLog2);
+			return false;
+		}
+
+		FMemory::Memcpy(Header, Magic, sizeof(Magic));
+		Header[sizeof(Magic)] = Version;
+		Header[ParamsOffset] = Params.ScryptLogN;
+		Header[ParamsOffset + 1] = Params.ScryptR;
+		Header[ParamsOffset + 2] = Params.ScryptP;
+		Header[ParamsOffset + 3] = Params.ChunkSizeLog2;
+		if (RAND_bytes(Header + SaltOffset, SaltSize + NoncePrefixSize) != 1)
+		{
+			UE_LOG(LogKeystore, Warning, TEXT("No random salt"));
+			return false;
+		}
+		return Derive(Params, Password);
+	}
+
+	bool Open(const uint8* InHeader, const FString& Password)
+	{
+		FKeystoreParams Params;
+		if (!ReadParams(InHeader, Params))
+			return false;
+
+		FMemory::Memcpy(Header, InHeader, FKeystore::HeaderSize);
+		return Derive(Params, Password);
+	}
+
+	void MakeNonce(uint32 Index, bool bLast, uint8 Nonce[NonceSize]) const
+	{
+		FMemory::Memcpy(Nonce, Header + NoncePrefixOffset, NoncePrefixSize);
+		Nonce[7] = static_cast<uint8>(Index >> 24);
+		Nonce[8] = static_cast<uint8>(Index >> 16);
+		Nonce[9] = static_cast<uint8>(Index >> 8);
+		Nonce[10] = static_cast<uint8>(Index);
+		Nonce[11] = bLast ? 1 : 0;
+	}
+
+private:
+	bool Derive(const FKeystoreParams& Params, const FString& Password)
+	{
+		ChunkSize = int64(1) << Params.ChunkSizeLog2;
+
+		FTCHARToUTF8 Utf8(*Password);
+		const bool bDerived = EVP_PBE_scrypt(Utf8.Get(), Utf8.Length(), Header + SaltOffset, SaltSize,
+			1ull << Params.ScryptLogN, Params.ScryptR, Params.ScryptP, MaxScryptMemory, Key, KeySize) == 1;
+		OPENSSL_cleanse(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+
+		if (!bDerived)
+		{
+			UE_LOG(LogKeystore, Warning, TEXT("scrypt failed"));
+		}
+		return bDerived;
+	}
+};
+
+// The header goes into every tag, so no parameter can be changed either.
+static bool SealChunk(EVP_CIPHER_CTX* Context, const FStreamKey& Key, uint32 Index, bool bLast, const uint8* In, int64 InLen, uint8* Out)
+{
+	uint8 Nonce[NonceSize];
+	Key.MakeNonce(Index, bLast, Nonce);
+
+	int32 Len = 0;
+	return EVP_EncryptInit_ex(Context, nullptr, nullptr, nullptr, Nonce) == 1
+		&& EVP_EncryptUpdate(Context, nullptr, &Len, Key.Header, FKeystore::HeaderSize) == 1
+		&& EVP_EncryptUpdate(Context, Out, &Len, In, static_cast<int32>(InLen)) == 1
+		&& EVP_EncryptFinal_ex(Context, Out + InLen, &Len) == 1
+		&& EVP_CIPHER_CTX_ctrl(Context, EVP_CTRL_GCM_GET_TAG, FKeystore::TagSize, Out + InLen) == 1;
+}
+
+static bool OpenChunk(EVP_CIPHER_CTX* Context, const FStreamKey& Key, uint32 Index, bool bLast, const uint8* In, int64 InLen, uint8* Out)
+{
+	if (InLen < FKeystore::TagSize)
+		return false;
+
+	uint8 Nonce[NonceSize];
+	Key.MakeNonce(Index, bLast, Nonce);
+
+	const int64 DataLen = InLen - FKeystore::TagSize;
+	int32 Len = 0;
+	return EVP_DecryptInit_ex(Context, nullptr, nullptr, nullptr, Nonce) == 1
+		&& EVP_DecryptUpdate(Context, nullptr, &Len, Key.Header, FKeystore::HeaderSize) == 1
+		&& EVP_DecryptUpdate(Context, Out, &Len, In, static_cast<int32>(DataLen)) == 1
+		&& EVP_CIPHER_CTX_ctrl(Context, EVP_CTRL_GCM_SET_TAG, FKeystore::TagSize, const_cast<uint8*>(In + DataLen)) == 1
+		&& EVP_DecryptFinal_ex(Context, Out + DataLen, &Len) == 1;
+}
+
+/**
+ * Seals or opens a run of chunks from chunk FirstIndex on, the last of them ending the data if bEndsData.
+ * Only a run ending the data may end in a partial chunk.
+ */
+static bool ProcessChunks(const FStreamKey& Key, bool bSeal, const uint8* In, int64 InSize, uint8* Out, int64 FirstIndex, bool bEndsData)
+{
+	const int64 InChunk = bSeal ? Key.ChunkSize : Key.ChunkSize + FKeystore::TagSize;
+	const int64 OutChunk = bSeal ? Key.ChunkSize + FKeystore::TagSize : Key.ChunkSize;
+	const int64 NumChunks = FMath::Max<int64>(FMath::DivideAndRoundUp(InSize, InChunk), 1);
+	if (FirstIndex + NumChunks - 1 > MAX_uint32)
+		return false;
+
+	const int64 ChunksPerTask = FMath::Max<int64>(BytesPerTask / InChunk, 1);
+	const int32 NumTasks = static_cast<int32>(FMath::DivideAndRoundUp(NumChunks, ChunksPerTask));
+
+	std::atomic<bool> bFailed{ false };
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		EVP_CIPHER_CTX* Context = EVP_CIPHER_CTX_new();
+		bool bProcessed = Context != nullptr && (bSeal
+			? EVP_EncryptInit_ex(Context, EVP_aes_256_gcm(), nullptr, Key.Key, nullptr)
+			: EVP_DecryptInit_ex(Context, EVP_aes_256_gcm(), nullptr, Key.Key, nullptr)) == 1;
+
+		const int64 Last = FMath::Min((Task + 1) * ChunksPerTask, NumChunks);
+		for (int64 Chunk = Task * ChunksPerTask; bProcessed && Chunk < Last; Chunk++)
+		{
+			const int64 InLen = FMath::Min(InChunk, InSize - Chunk * InChunk);
+			const bool bLast = bEndsData && Chunk == NumChunks - 1;
+			bProcessed = (bSeal ? &SealChunk : &OpenChunk)(Context, Key, static_cast<uint32>(FirstIndex + Chunk), bLast,
+				In + Chunk * InChunk, InLen, Out + Chunk * OutChunk);
+		}
+
+		EVP_CIPHER_CTX_free(Context);
+		if (!bProcessed)
+		{
+			bFailed = true;
+		}
+	}, NumTasks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	return !bFailed;
+}
+
+// Processes Source from its current position to its end into Dest, a batch of chunks at a time.
+static bool ProcessFile(IFileHandle& Source, IFileHandle& Dest, const FStreamKey& Key, bool bSeal)
+{
+	const int64 InChunk = bSeal ? Key.ChunkSize : Key.ChunkSize + FKeystore::TagSize;
+	const int64 BatchSize = FMath::Max<int64>(FileBatchSize / InChunk, 1) * InChunk;
+	int64 Remaining = Source.Size() - Source.Tell();
+
+	// The first batch is the largest.
+	TArray64<uint8> In;
+	TArray64<uint8> Out;
+	In.SetNumUninitialized(FMath::Min(BatchSize, Remaining));
+	Out.SetNumUninitialized(bSeal ? GetSealedSize(In.Num(), Key.ChunkSize) : In.Num());
+
+	bool bProcessed = true;
+	for (int64 FirstIndex = 0; bProcessed; FirstIndex += BatchSize / InChunk)
+	{
+		const int64 Size = FMath::Min(BatchSize, Remaining);
+		const bool bEndsData = Size == Remaining;
+		const int64 OutSize = bSeal ? GetSealedSize(Size, Key.ChunkSize) : GetOpenedSize(Size, Key.ChunkSize);
+
+		bProcessed = OutSize >= 0
+			&& Source.Read(In.GetData(), Size)
+			&& ProcessChunks(Key, bSeal, In.GetData(), Size, Out.GetData(), FirstIndex, bEndsData)
+			&& Dest.Write(Out.GetData(), OutSize);
+		if (bEndsData)
+			break;
+		Remaining -= Size;
+	}
+
+	OPENSSL_cleanse(In.GetData(), In.Num());
+	OPENSSL_cleanse(Out.GetData(), Out.Num());
+	return bProcessed;
+}
+
+int64 FKeystore::GetEncryptedSize(int64 DataSize, const FKeystoreParams& Params)
+{
+	return HeaderSize + GetSealedSize(DataSize, int64(1) << Params.ChunkSizeLog2);
+}
+
+int64 FKeystore::GetDecryptedSize(TConstArrayView<uint8> Encrypted)
+{
+	FKeystoreParams Params;
+	if (Encrypted.Num() < HeaderSize || !ReadParams(Encrypted.GetData(), Params))
+		return -1;
+
+	return GetOpenedSize(Encrypted.Num() - HeaderSize, int64(1) << Params.ChunkSizeLog2);
+}
+
+bool FKeystore::Encrypt(TConstArrayView<uint8> Data, const FString& Password, TArrayView<uint8> Out, const FKeystoreParams& Params)
+{
+	check(Out.Num() >= GetEncryptedSize(Data.Num(), Params));
+
+	FStreamKey Key;
+	if (!Key.Create(Params, Password))
+		return false;
+
+	FMemory::Memcpy(Out.GetData(), Key.Header, HeaderSize);
+	return ProcessChunks(Key, true, Data.GetData(), Data.Num(), Out.GetData() + HeaderSize, 0, true);
+}
+
+bool FKeystore::Decrypt(TConstArrayView<uint8> Encrypted, const FString& Password, TArrayView<uint8> Out)
+{
+	const int64 DataSize = GetDecryptedSize(Encrypted);
+	if (DataSize < 0)
+		return false;
+	check(Out.Num() >= DataSize);
+
+	FStreamKey Key;
+	if (Key.Open(Encrypted.GetData(), Password)
+		&& ProcessChunks(Key, false, Encrypted.GetData() + HeaderSize, Encrypted.Num() - HeaderSize, Out.GetData(), 0, true))
+		return true;
+
+	// The chunks before a failing one open fine, none of them are handed out.
+	OPENSSL_cleanse(Out.GetData(), DataSize);
+	return false;
+}
+
+bool FKeystore::EncryptFile(const FString& SourceFilename, const FString& DestFilename, const FString& Password, const FKeystoreParams& Params)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IFileHandle> Source(PlatformFile.OpenRead(*SourceFilename));
+	if (!Source.IsValid())
+	{
+		UE_LOG(LogKeystore, Warning, TEXT("Could not open %s"), *SourceFilename);
+		return false;
+	}
+
+	FStreamKey Key;
+	if (!Key.Create(Params, Password))
+		return false;
+
+	TUniquePtr<IFileHandle> Dest(PlatformFile.OpenWrite(*DestFilename));
+	if (!Dest.IsValid())
+	{
+		UE_LOG(LogKeystore, Warning, TEXT("Could not create %s"), *DestFilename);
+		return false;
+	}
+
+	const bool bEncrypted = Dest->Write(Key.Header, HeaderSize) && ProcessFile(*Source, *Dest, Key, true);
+	Dest.Reset();
+	if (!bEncrypted)
+	{
+		UE_LOG(LogKeystore, Warning, TEXT("Could not encrypt %s into %s"), *SourceFilename, *DestFilename);
+		PlatformFile.DeleteFile(*DestFilename);
+	}
+	return bEncrypted;
+}
+
+bool FKeystore::DecryptFile(const FString& SourceFilename, const FString& DestFilename, const FString& Password)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IFileHandle> Source(PlatformFile.OpenRead(*SourceFilename));
+	if (!Source.IsValid())
+	{
+		UE_LOG(LogKeystore, Warning, TEXT("Could not open %s"), *SourceFilename);
+		return false;
+	}
+
+	uint8 Header[HeaderSize];
+	FStreamKey Key;
+	if (!Source->Read(Header, HeaderSize) || !Key.Open(Header, Password) || GetOpenedSize(Source->Size() - HeaderSize, Key.ChunkSize) < 0)
+	{
+		UE_LOG(LogKeystore, Warning, TEXT("%s is not keystore data"), *SourceFilename);
+		return false;
+	}
+
+	TUniquePtr<IFileHandle> Dest(PlatformFile.OpenWrite(*DestFilename));
+	if (!Dest.IsValid())
+	{
+		UE_LOG(LogKeystore, Warning, TEXT("Could not create %s"), *DestFilename);
+		return false;
+	}
+
+	const bool bDecrypted = ProcessFile(*Source, *Dest, Key, false);
+	Dest.Reset();
+	if (!bDecrypted)
+	{
+		UE_LOG(LogKeystore, Warning, TEXT("Could not decrypt %s, wrong password or changed data"), *SourceFilename);
+		PlatformFile.DeleteFile(*DestFilename);
+	}
+	return bDecrypted;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKeystoreTest, "Solana.Crypto.Keystore", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FKeystoreTest::RunTest(const FString& Parameters)
+{
+	// Cheap parameters and small chunks, so a few chunks are quick to cover.
+	FKeystoreParams Params;
+	Params.ScryptLogN = 10;
+	Params.ChunkSizeLog2 = 12;
+	const int32 ChunkSize = 1 << Params.ChunkSizeLog2;
+	const int32 SealedChunk = ChunkSize + FKeystore::TagSize;
+	const int32 HeaderSize = FKeystore::HeaderSize;
+	const FString Password = TEXT("correct horse battery staple");
+
+	const auto Opens = [](TConstArrayView<uint8> Encrypted, const FString& WithPassword)
+	{
+		TArray<uint8> Decrypted;
+		Decrypted.SetNumUninitialized(FMath::Max<int64>(FKeystore::GetDecryptedSize(Encrypted), 0));
+		return FKeystore::GetDecryptedSize(Encrypted) >= 0 && FKeystore::Decrypt(Encrypted, WithPassword, Decrypted);
+	};
+
+	for (const int32 DataSize : { 0, 1, ChunkSize - 1, ChunkSize, ChunkSize + 1, 3 * ChunkSize + 100 })
+	{
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(DataSize);
+		for (int32 I = 0; I < DataSize; I++)
+		{
+			Data[I] = static_cast<uint8>(I * 131 + 7);
+		}
+
+		TArray<uint8> Encrypted;
+		Encrypted.SetNumUninitialized(FKeystore::GetEncryptedSize(DataSize, Params));
+		if (!TestTrue(FString::Printf(TEXT("Encrypt %d bytes"), DataSize), FKeystore::Encrypt(Data, Password, Encrypted, Params)))
+			continue;
+		TestEqual(TEXT("GetDecryptedSize"), FKeystore::GetDecryptedSize(Encrypted), static_cast<int64>(DataSize));
+
+		TArray<uint8> Decrypted;
+		Decrypted.SetNumUninitialized(DataSize);
+		TestTrue(FString::Printf(TEXT("Decrypt %d bytes"), DataSize), FKeystore::Decrypt(Encrypted, Password, Decrypted) && Decrypted == Data);
+		TestFalse(TEXT("Wrong password"), Opens(Encrypted, TEXT("wrong password")));
+
+		// A flipped bit in the chunk size, the first chunk and the last tag.
+		for (const int32 Offset : { ParamsOffset + 3, HeaderSize, Encrypted.Num() - 1 })
+		{
+			TArray<uint8> Changed = Encrypted;
+			Changed[Offset] ^= 1;
+			TestFalse(FString::Printf(TEXT("Bit flipped at %d of %d"), Offset, Encrypted.Num()), Opens(Changed, Password));
+		}
+
+		// Whole chunks dropped from the end, and two chunks swapped.
+		if (Encrypted.Num() > HeaderSize + SealedChunk)
+		{
+			TestFalse(TEXT("Chunks dropped"), Opens(MakeArrayView(Encrypted.GetData(), HeaderSize + SealedChunk), Password));
+		}
+
+		if (Encrypted.Num() >= HeaderSize + 2 * SealedChunk)
+		{
+			TArray<uint8> Swapped = Encrypted;
+			FMemory::Memswap(Swapped.GetData() + HeaderSize, Swapped.GetData() + HeaderSize + SealedChunk, SealedChunk);
+			TestFalse(TEXT("Chunks swapped"), Opens(Swapped, Password));
+		}
+	}
+	return true;
+}
+
+#endif
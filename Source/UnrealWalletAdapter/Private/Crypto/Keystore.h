@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** The costs of an FKeystore blob, recorded in its header. */
+struct FKeystoreParams
+{
+	/** scrypt N = 2^ScryptLogN, using 128 * N * ScryptR bytes: 32MB and around 100ms by default. */
+	uint8 ScryptLogN = 15;
+	uint8 ScryptR = 8;
+	uint8 ScryptP = 1;
+	/** Chunks of 2^ChunkSizeLog2 bytes, 12 to 24, each adding FKeystore::TagSize bytes. */
+	uint8 ChunkSizeLog2 = 16;
+};
+
+/**
+ * Password encryption of key material and other blobs of any size, into caller buffers or between files.
+ *
+ * The key comes from the password through scrypt at a cost the header records, so it can be raised for new
+ * data without breaking old data. The data is split into fixed-size chunks, each sealed with AES-256-GCM under
+ * a nonce made of a random per-blob prefix, the chunk index and a flag on the last chunk. Chunks cannot be
+ * reordered, dropped or cut off at the end without failing decryption. They are independent, so large buffers
+ * are processed on the task graph workers, and files a few megabytes at a time, whatever their size.
+ */
+class FKeystore
+{
+public:
+	static constexpr int32 HeaderSize = 32;
+	static constexpr int32 TagSize = 16;
+
+	static int64 GetEncryptedSize(int64 DataSize, const FKeystoreParams& Params = FKeystoreParams());
+	/** -1 if Encrypted isn't keystore data, or is cut short. */
+	static int64 GetDecryptedSize(TConstArrayView<uint8> Encrypted);
+
+	/** Out holds GetEncryptedSize(Data.Num(), Params) bytes. False if Params are out of range. */
+	static bool Encrypt(TConstArrayView<uint8> Data, const FString& Password, TArrayView<uint8> Out, const FKeystoreParams& Params = FKeystoreParams());
+	/**
+	 * Out holds GetDecryptedSize(Encrypted) bytes. False if the password is wrong or the data was changed, and
+	 * Out is zeroed then.
+	 */
+	static bool Decrypt(TConstArrayView<uint8> Encrypted, const FString& Password, TArrayView<uint8> Out);
+
+	static bool EncryptFile(const FString& SourceFilename, const FString& DestFilename, const FString& Password, const FKeystoreParams& Params = FKeystoreParams());
+	/**
+	 * Writes each chunk once it is authenticated. If a later one fails, or the file was cut short, DestFilename
+	 * is deleted and false returned.
+	 */
+	static bool DecryptFile(const FString& SourceFilename, const FString& DestFilename, const FString& Password);
+};
@@ -0,0 +1,324 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Mnemonic.h"
+
+#include "Async/ParallelFor.h"
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/Pbkdf2Sha512.h"
+#include "Misc/AutomationTest.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/crypto.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+#include "Crypto/Bip39WordList.inl"
+
+static constexpr int32 MaxWordLength = 8;
+static constexpr int32 IndexBits = 11;
+static constexpr int32 MaxEntropySize = 32;
+
+static bool IsValidNumWords(int32 NumWords)
+{
+	return NumWords >= FMnemonic::MinWords && NumWords <= FMnemonic::MaxWords && NumWords % 3 == 0;
+}
+
+/** The wordlist index at each 11 bits of Bits, most significant bit first. */
+static void ReadIndices(const uint8* Bits, int32 NumWords, uint16* OutIndices)
+{
+	uint32 Window = 0;
+	int32 NumBits = 0;
+	for (int32 Word = 0; Word < NumWords; Word++)
+	{
+		while (NumBits < IndexBits)
+		{
+			Window = (Window << 8) | *Bits++;
+			NumBits += 8;
+		}
+		NumBits -= IndexBits;
+		OutIndices[Word] = static_cast<uint16>((Window >> NumBits) & (FMnemonic::NumListWords - 1));
+	}
+}
+
+/** ReadIndices the other way round, the last byte padded with zero bits. */
+static void WriteIndices(const uint16* Indices, int32 NumWords, uint8* OutBits)
+{
+	uint32 Window = 0;
+	int32 NumBits = 0;
+	for (int32 Word = 0; Word < NumWords; Word++)
+	{
+		Window = (Window << IndexBits) | Indices[Word];
+		NumBits += IndexBits;
+		while (NumBits >= 8)
+		{
+			NumBits -= 8;
+			*OutBits++ = static_cast<uint8>(Window >> NumBits);
+		}
+	}
+	if (NumBits > 0)
+	{
+		*OutBits = static_cast<uint8>(Window << (8 - NumBits));
+	}
+}
+
+/** The top entropy bits / 32 of the SHA-256 of the entropy, in place in the byte that follows it. */
+static uint8 Checksum(const uint8* Entropy, int32 Size)
+{
+	const int32 NumBits = Size / 4;
+	return FCryptoUtils::SHA256_Digest(Entropy, Size)[0] & static_cast<uint8>(0xff << (8 - NumBits));
+}
+
+/**
+ * The word indices of a sentence split at whitespace, 0 if there are too many or one is not on the list.
+ * Words only ever are lower case ASCII, so they are narrowed to ANSI one at a time.
+ */
+static int32 ParseIndices(const FString& Mnemonic, uint16* OutIndices)
+{
+	const TCHAR* Chars = *Mnemonic;
+	const int32 Len = Mnemonic.Len();
+	int32 NumWords = 0;
+	for (int32 Start = 0;;)
+	{
+		while (Start < Len && FChar::IsWhitespace(Chars[Start]))
+		{
+			Start++;
+		}
+		if (Start == Len)
+			return NumWords;
+
+		int32 End = Start;
+		while (End < Len && !FChar::IsWhitespace(Chars[End]))
+		{
+			End++;
+		}
+		if (NumWords == FMnemonic::MaxWords || End - Start > MaxWordLength)
+			return 0;
+
+		ANSICHAR Word[MaxWordLength];
+		for (int32 Index = Start; Index < End; Index++)
+		{
+			if (Chars[Index] > 0x7f)
+				return 0;
+			Word[Index - Start] = static_cast<ANSICHAR>(Chars[Index]);
+		}
+
+		const int32 Index = FMnemonic::FindWord(FAnsiStringView(Word, End - Start));
+		if (Index == INDEX_NONE)
+			return 0;
+		OutIndices[NumWords++] = static_cast<uint16>(Index);
+		Start = End;
+	}
+}
+
+/** The entropy of the indices into OutEntropy, false if their checksum is wrong. */
+static bool IndicesToEntropy(const uint16* Indices, int32 NumWords, uint8* OutEntropy)
+{
+	const int32 Size = NumWords * 4 / 3;
+	uint8 Bits[MaxEntropySize + 1];
+	WriteIndices(Indices, NumWords, Bits);
+	FMemory::Memcpy(OutEntropy, Bits, Size);
+
+	const bool bValid = Bits[Size] == Checksum(Bits, Size);
+	OPENSSL_cleanse(Bits, sizeof(Bits));
+	return bValid;
+}
+
+const ANSICHAR* FMnemonic::GetWord(int32 Index)
+{
+	check(Index >= 0 && Index < NumListWords);
+	return Bip39Words[Index];
+}
+
+int32 FMnemonic::FindWord(FAnsiStringView Word)
+{
+	if (Word.Len() < 3 || Word.Len() > MaxWordLength)
+		return INDEX_NONE;
+
+	// Words are keyed by their first four letters, which BIP39 makes unique, five bits a letter. The top nine
+	// bits of the multiplied key pick a displacement that moves the next twelve to a slot of the word's own.
+	uint32 Key = 0;
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		Key = Key * 32 + (Index < Word.Len() ? static_cast<uint32>(Word[Index] - 'a' + 1) & 31 : 0);
+	}
+	const uint32 Hash = Key * Bip39WordHashMultiplier;
+	const uint16 Index = Bip39WordSlots[((Hash >> 11) ^ Bip39WordDisplacements[Hash >> 23]) & 4095];
+	if (Index == 0xffff)
+		return INDEX_NONE;
+
+	const ANSICHAR* Candidate = Bip39Words[Index];
+	return FCStringAnsi::Strlen(Candidate) == Word.Len() && FMemory::Memcmp(Candidate, Word.GetData(), Word.Len()) == 0
+		? Index
+		: INDEX_NONE;
+}
+
+bool FMnemonic::FromEntropy(TConstArrayView<uint8> Entropy, FString& OutMnemonic)
+{
+	const int32 Size = Entropy.Num();
+	if (Size < 16 || Size > MaxEntropySize || Size % 4 != 0)
+		return false;
+
+	uint8 Bits[MaxEntropySize + 1];
+	FMemory::Memcpy(Bits, Entropy.GetData(), Size);
+	Bits[Size] = Checksum(Bits, Size);
+
+	const int32 NumWords = Size * 3 / 4;
+	uint16 Indices[MaxWords];
+	ReadIndices(Bits, NumWords, Indices);
+
+	ANSICHAR Sentence[MaxWords * (MaxWordLength + 1)];
+	int32 Len = 0;
+	for (int32 Word = 0; Word < NumWords; Word++)
+	{
+		if (Word > 0)
+		{
+			Sentence[Len++] = ' ';
+		}
+		for (const ANSICHAR* Char = Bip39Words[Indices[Word]]; *Char; Char++)
+		{
+			Sentence[Len++] = *Char;
+		}
+	}
+	OutMnemonic = FString(Len, Sentence);
+
+	OPENSSL_cleanse(Bits, sizeof(Bits));
+	OPENSSL_cleanse(Indices, sizeof(Indices));
+	OPENSSL_cleanse(Sentence, sizeof(Sentence));
+	return true;
+}
+
+bool FMnemonic::ToEntropy(const FString& Mnemonic, TArray<uint8>& OutEntropy)
+{
+	uint16 Indices[MaxWords];
+	const int32 NumWords = ParseIndices(Mnemonic, Indices);
+	if (!IsValidNumWords(NumWords))
+		return false;
+
+	OutEntropy.SetNumUninitialized(NumWords * 4 / 3);
+	const bool bValid = IndicesToEntropy(Indices, NumWords, OutEntropy.GetData());
+	OPENSSL_cleanse(Indices, sizeof(Indices));
+	if (!bValid)
+	{
+		OPENSSL_cleanse(OutEntropy.GetData(), OutEntropy.Num());
+		OutEntropy.Reset();
+	}
+	return bValid;
+}
+
+bool FMnemonic::IsValid(const FString& Mnemonic)
+{
+	uint16 Indices[MaxWords];
+	const int32 NumWords = ParseIndices(Mnemonic, Indices);
+	if (!IsValidNumWords(NumWords))
+		return false;
+
+	uint8 Entropy[MaxEntropySize];
+	const bool bValid = IndicesToEntropy(Indices, NumWords, Entropy);
+	OPENSSL_cleanse(Indices, sizeof(Indices));
+	OPENSSL_cleanse(Entropy, sizeof(Entropy));
+	return bValid;
+}
+
+bool FMnemonic::Generate(int32 NumWords, FString& OutMnemonic)
+{
+	TArray<FString> Mnemonics;
+	if (!Generate(1, NumWords, Mnemonics))
+		return false;
+
+	OutMnemonic = MoveTemp(Mnemonics[0]);
+	return true;
+}
+
+void FMnemonic::Validate(TConstArrayView<FString> Mnemonics, TArray<bool>& OutValid, int32 MinParallelNum)
+{
+	OutValid.SetNumUninitialized(Mnemonics.Num());
+	ParallelFor(Mnemonics.Num(), [Mnemonics, &OutValid](int32 Index)
+	{
+		OutValid[Index] = IsValid(Mnemonics[Index]);
+	}, Mnemonics.Num() < MinParallelNum ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+bool FMnemonic::Generate(int32 Num, int32 NumWords, TArray<FString>& OutMnemonics, int32 MinParallelNum)
+{
+	if (!IsValidNumWords(NumWords) || Num < 0)
+		return false;
+
+	const int32 Size = NumWords * 4 / 3;
+	TArray<uint8> Entropy;
+	if (!FCryptoUtils::RandomBytes(Entropy, Num * Size))
+		return false;
+
+	OutMnemonics.SetNum(Num);
+	ParallelFor(Num, [&Entropy, &OutMnemonics, Size](int32 Index)
+	{
+		FromEntropy(MakeArrayView(Entropy.GetData() + Index * Size, Size), OutMnemonics[Index]);
+	}, Num < MinParallelNum ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	OPENSSL_cleanse(Entropy.GetData(), Entropy.Num());
+	return true;
+}
+
+TArray<uint8> FMnemonic::ToSeed(const FString& Mnemonic, const FString& Passphrase)
+{
+	const FTCHARToUTF8 Utf8Mnemonic(*Mnemonic);
+	const FTCHARToUTF8 Utf8Passphrase(*Passphrase);
+	return FPbkdf2Sha512::MnemonicToSeed(
+		MakeArrayView(reinterpret_cast<const uint8*>(Utf8Mnemonic.Get()), Utf8Mnemonic.Length()),
+		MakeArrayView(reinterpret_cast<const uint8*>(Utf8Passphrase.Get()), Utf8Passphrase.Length()));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMnemonicTest, "Solana.Crypto.Mnemonic", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMnemonicTest::RunTest(const FString& Parameters)
+{
+	int32 NumFound = 0;
+	for (int32 Index = 0; Index < FMnemonic::NumListWords; Index++)
+	{
+		NumFound += FMnemonic::FindWord(Bip39Words[Index]) == Index;
+	}
+	TestEqual(TEXT("Words found at their list index"), NumFound, FMnemonic::NumListWords);
+
+	// BIP39 reference vectors, each entropy a single repeated byte.
+	struct FVector
+	{
+		uint8 Fill;
+		int32 Size;
+		const TCHAR* Mnemonic;
+	};
+
+	static const FVector Vectors[] = {
+		{ 0x00, 16, TEXT("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about") },
+		{ 0x7f, 16, TEXT("legal winner thank year wave sausage worth useful legal winner thank yellow") },
+		{ 0x80, 16, TEXT("letter advice cage absurd amount doctor acoustic avoid letter advice cage above") },
+		{ 0xff, 16, TEXT("zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo wrong") },
+		{ 0x00, 24, TEXT("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon agent") },
+		{ 0x7f, 24, TEXT("legal winner thank year wave sausage worth useful legal winner thank year wave sausage worth useful legal will") },
+		{ 0x80, 32, TEXT("letter advice cage absurd amount doctor acoustic avoid letter advice cage absurd amount doctor acoustic avoid letter advice cage absurd amount doctor acoustic bless") },
+		{ 0xff, 32, TEXT("zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo vote") },
+	};
+
+	for (const FVector& Vector : Vectors)
+	{
+		TArray<uint8> Entropy;
+		Entropy.Init(Vector.Fill, Vector.Size);
+
+		FString Mnemonic;
+		TArray<uint8> Decoded;
+		TestTrue(FString::Printf(TEXT("FromEntropy, %s"), Vector.Mnemonic),
+			FMnemonic::FromEntropy(Entropy, Mnemonic) && Mnemonic.Equals(Vector.Mnemonic, ESearchCase::CaseSensitive));
+		TestTrue(FString::Printf(TEXT("ToEntropy, %s"), Vector.Mnemonic), FMnemonic::ToEntropy(Vector.Mnemonic, Decoded) && Decoded == Entropy);
+	}
+
+	// A wrong checksum, a word off the list, and a word too many.
+	TestFalse(TEXT("Wrong checksum"), FMnemonic::IsValid(TEXT("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon")));
+	TestFalse(TEXT("Word off the list"), FMnemonic::IsValid(TEXT("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abou")));
+	TestFalse(TEXT("Word too many"), FMnemonic::IsValid(TEXT("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about about")));
+	return true;
+}
+
+#endif
@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * BIP39 mnemonic sentences over the English wordlist.
+ *
+ * Word indices are read from and written to the entropy and checksum bits with shifts and masks, and words
+ * are looked up through a perfect hash of their first four letters, so checking a sentence costs one SHA-256
+ * and a table probe per word. Safe to use from any thread.
+ */
+class FMnemonic
+{
+public:
+	static constexpr int32 NumListWords = 2048;
+	static constexpr int32 MinWords = 12;
+	static constexpr int32 MaxWords = 24;
+
+	static const ANSICHAR* GetWord(int32 Index);
+	/** The wordlist index of Word, INDEX_NONE if it is not on the list. */
+	static int32 FindWord(FAnsiStringView Word);
+
+	/** The sentence of 16 to 32 bytes of entropy in steps of 4, false for any other size. */
+	static bool FromEntropy(TConstArrayView<uint8> Entropy, FString& OutMnemonic);
+	/** False if a word is not on the list, there are not 12, 15, 18, 21 or 24 of them, or the checksum is wrong. */
+	static bool ToEntropy(const FString& Mnemonic, TArray<uint8>& OutEntropy);
+	static bool IsValid(const FString& Mnemonic);
+
+	/** A new sentence of 12, 15, 18, 21 or 24 words. */
+	static bool Generate(int32 NumWords, FString& OutMnemonic);
+
+	/** IsValid for each sentence. Spans of at least MinParallelNum are spread over the task graph workers. */
+	static void Validate(TConstArrayView<FString> Mnemonics, TArray<bool>& OutValid, int32 MinParallelNum = 64);
+	/** Num new sentences, their entropy drawn all at once. */
+	static bool Generate(int32 Num, int32 NumWords, TArray<FString>& OutMnemonics, int32 MinParallelNum = 64);
+
+	/** The BIP39 seed of the sentence. The passphrase is used as it is, NFKD normalizing it is up to the caller. */
+	static TArray<uint8> ToSeed(const FString& Mnemonic, const FString& Passphrase = FString());
+};
@@ -0,0 +1,225 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/Pbkdf2Sha512.h"
+
+#include "Async/ParallelFor.h"
+#include "Crypto/HmacSha512.h"
+#include "Crypto/ed25519/ed_sha512.h"
+#include "Misc/AutomationTest.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/crypto.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+static constexpr int32 BlockSize = FHmacSha512::DigestSize;
+
+static const uint64_t* InnerWords(const FHmacSha512& Hmac)
+{
+	return reinterpret_cast<const uint64_t*>(Hmac.GetInnerState());
+}
+
+static const uint64_t* OuterWords(const FHmacSha512& Hmac)
+{
+	return reinterpret_cast<const uint64_t*>(Hmac.GetOuterState());
+}
+
+/** U_1 of output block Block, the HMAC of the salt followed by the big endian block number. */
+static void FirstRound(const FHmacSha512& Hmac, TConstArrayView<uint8> Salt, uint32 Block, uint8* OutU)
+{
+	TArray<uint8, TInlineAllocator<256>> Message;
+	Message.Append(Salt.GetData(), Salt.Num());
+	Message.Add(static_cast<uint8>(Block >> 24));
+	Message.Add(static_cast<uint8>(Block >> 16));
+	Message.Add(static_cast<uint8>(Block >> 8));
+	Message.Add(static_cast<uint8>(Block));
+	Hmac.Compute(Message.GetData(), Message.Num(), OutU);
+
+	// The salt carries the BIP39 passphrase.
+	OPENSSL_cleanse(Message.GetData(), Message.Num());
+}
+
+void FPbkdf2Sha512::DeriveKey(TConstArrayView<uint8> Password, TConstArrayView<uint8> Salt, uint32 Iterations, uint8* OutKey, int32 KeyLen)
+{
+	check(Iterations > 0);
+
+	const FHmacSha512 Hmac(Password);
+	const uint64_t* const Inner[4] = { InnerWords(Hmac), InnerWords(Hmac), InnerWords(Hmac), InnerWords(Hmac) };
+	const uint64_t* const Outer[4] = { OuterWords(Hmac), OuterWords(Hmac), OuterWords(Hmac), OuterWords(Hmac) };
+
+	// Keys longer than a block have their blocks derived four at a time.
+	const int32 NumBlocks = FMath::DivideAndRoundUp(KeyLen, BlockSize);
+	uint8 T[4][BlockSize];
+	for (int32 First = 0; First < NumBlocks; First += 4)
+	{
+		const int32 Count = FMath::Min(NumBlocks - First, 4);
+		for (int32 Lane = 0; Lane < Count; Lane++)
+		{
+			FirstRound(Hmac, Salt, First + Lane + 1, T[Lane]);
+		}
+
+		if (Count == 4)
+		{
+			ed_sha512_pbkdf2_x4(Inner, Outer, T, Iterations);
+		}
+		else
+		{
+			for (int32 Lane = 0; Lane < Count; Lane++)
+			{
+				ed_sha512_pbkdf2(Inner[Lane], Outer[Lane], T[Lane], Iterations);
+			}
+		}
+
+		for (int32 Lane = 0; Lane < Count; Lane++)
+		{
+			const int32 Offset = (First + Lane) * BlockSize;
+			FMemory::Memcpy(OutKey + Offset, T[Lane], FMath::Min(KeyLen - Offset, BlockSize));
+		}
+	}
+
+	OPENSSL_cleanse(T, sizeof(T));
+}
+
+void FPbkdf2Sha512::DeriveKeys(TConstArrayView<TArray<uint8>> Passwords, TConstArrayView<TArray<uint8>> Salts, uint32 Iterations, uint8* OutKeys, int32 MinParallelNum)
+{
+	check(Iterations > 0);
+	check(Passwords.Num() == 1 || Passwords.Num() == Salts.Num());
+
+	const int32 NumGroups = FMath::DivideAndRoundUp(Salts.Num(), 4);
+	ParallelFor(NumGroups, [Passwords, Salts, Iterations, OutKeys](int32 Group)
+	{
+		const int32 First = Group * 4;
+		const int32 Count = FMath::Min(Salts.Num() - First, 4);
+
+		TArray<FHmacSha512, TInlineAllocator<4>> Hmacs;
+		for (int32 Lane = 0; Lane < (Passwords.Num() == 1 ? 1 : Count); Lane++)
+		{
+			Hmacs.Emplace(Passwords[Passwords.Num() == 1 ? 0 : First + Lane]);
+		}
+
+		const uint64_t* Inner[4];
+		const uint64_t* Outer[4];
+		uint8 T[4][BlockSize];
+		for (int32 Lane = 0; Lane < Count; Lane++)
+		{
+			const FHmacSha512& Hmac = Hmacs[FMath::Min(Lane, Hmacs.Num() - 1)];
+			Inner[Lane] = InnerWords(Hmac);
+			Outer[Lane] = OuterWords(Hmac);
+			FirstRound(Hmac, Salts[First + Lane], 1, T[Lane]);
+		}
+
+		if (Count == 4)
+		{
+			ed_sha512_pbkdf2_x4(Inner, Outer, T, Iterations);
+		}
+		else
+		{
+			for (int32 Lane = 0; Lane < Count; Lane++)
+			{
+				ed_sha512_pbkdf2(Inner[Lane], Outer[Lane], T[Lane], Iterations);
+			}
+		}
+
+		FMemory::Memcpy(OutKeys + First * BlockSize, T, Count * BlockSize);
+		OPENSSL_cleanse(T, sizeof(T));
+	}, Salts.Num() < MinParallelNum ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+TArray<uint8> FPbkdf2Sha512::MnemonicToSeed(TConstArrayView<uint8> Mnemonic, TConstArrayView<uint8> Passphrase)
+{
+	static const uint8 SaltPrefix[] = { 'm', 'n', 'e', 'm', 'o', 'n', 'i', 'c' };
+
+	TArray<uint8, TInlineAllocator<256>> Salt;
+	Salt.Append(SaltPrefix, UE_ARRAY_COUNT(SaltPrefix));
+	Salt.Append(Passphrase.GetData(), Passphrase.Num());
+
+	TArray<uint8> Seed;
+	Seed.SetNumUninitialized(Bip39SeedSize);
+	DeriveKey(Mnemonic, Salt, Bip39Iterations, Seed.GetData(), Seed.Num());
+
+	OPENSSL_cleanse(Salt.GetData(), Salt.Num());
+	return Seed;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static TArray<uint8> AnsiBytes(const ANSICHAR* Text)
+{
+	return TArray<uint8>(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+}
+
+static bool MatchesHex(const uint8* Bytes, int32 Num, const TCHAR* Hex)
+{
+	TArray<uint8> Expected;
+	Expected.SetNumUninitialized(FCString::Strlen(Hex) / 2);
+	HexToBytes(Hex, Expected.GetData());
+	return Expected.Num() == Num && FMemory::Memcmp(Bytes, Expected.GetData(), Num) == 0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPbkdf2Sha512Test, "Solana.Crypto.Pbkdf2", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPbkdf2Sha512Test::RunTest(const FString& Parameters)
+{
+	struct FVector
+	{
+		const ANSICHAR* Password;
+		const ANSICHAR* Salt;
+		uint32 Iterations;
+		const TCHAR* Key;
+	};
+
+	static const FVector Vectors[] = {
+		{ "password", "salt", 1,
+			TEXT("867f70cf1ade02cff3752599a3a53dc4af34c7a669815ae5d513554e1c8cf252c02d470a285a0501bad999bfe943c08f050235d7d68b1da55e63f73b60a57fce") },
+		{ "password", "salt", 2,
+			TEXT("e1d9c16aa681708a45f5c7c4e215ceb66e011a2e9f0040713f18aefdb866d53cf76cab2868a39b9f7840edce4fef5a82be67335c77a6068e04112754f27ccf4e") },
+		// BIP39 reference vectors, passphrase "TREZOR".
+		{ "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about", "mnemonicTREZOR", FPbkdf2Sha512::Bip39Iterations,
+			TEXT("c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04") },
+		{ "legal winner thank year wave sausage worth useful legal winner thank yellow", "mnemonicTREZOR", FPbkdf2Sha512::Bip39Iterations,
+			TEXT("2e8905819b8723fe2c1d161860e5ee1830318dbf49a83bd451cfb8440c28bd6fa457fe1296106559a3c80937a1c1069be3a3a5bd381ee6260e8d9739fce1f607") },
+	};
+
+	uint8 Key[BlockSize];
+	for (const FVector& Vector : Vectors)
+	{
+		FPbkdf2Sha512::DeriveKey(AnsiBytes(Vector.Password), AnsiBytes(Vector.Salt), Vector.Iterations, Key, BlockSize);
+		TestTrue(FString::Printf(TEXT("DeriveKey(%hs, %hs, %u)"), Vector.Password, Vector.Salt, Vector.Iterations), MatchesHex(Key, BlockSize, Vector.Key));
+	}
+
+	// The BIP39 vectors again as a batch, with a password each.
+	TArray<TArray<uint8>> Passwords;
+	TArray<TArray<uint8>> Salts;
+	for (int32 Index = 0; Index < 5; Index++)
+	{
+		const FVector& Vector = Vectors[2 + Index % 2];
+		Passwords.Add(AnsiBytes(Vector.Password));
+		Salts.Add(AnsiBytes(Vector.Salt));
+	}
+
+	uint8 Keys[5 * BlockSize];
+	FPbkdf2Sha512::DeriveKeys(Passwords, Salts, FPbkdf2Sha512::Bip39Iterations, Keys);
+	for (int32 Index = 0; Index < 5; Index++)
+	{
+		TestTrue(FString::Printf(TEXT("DeriveKeys, a password each, key %d"), Index), MatchesHex(Keys + Index * BlockSize, BlockSize, Vectors[2 + Index % 2].Key));
+	}
+
+	// Passphrases tried against one mnemonic: a salt each, through the four way and the single lane paths.
+	for (int32 Index = 0; Index < 5; Index++)
+	{
+		Salts[Index].Add(static_cast<uint8>('0' + Index));
+	}
+
+	FPbkdf2Sha512::DeriveKeys(MakeArrayView(Passwords.GetData(), 1), Salts, FPbkdf2Sha512::Bip39Iterations, Keys);
+	for (int32 Index = 0; Index < 5; Index++)
+	{
+		FPbkdf2Sha512::DeriveKey(Passwords[0], Salts[Index], FPbkdf2Sha512::Bip39Iterations, Key, BlockSize);
+		TestTrue(FString::Printf(TEXT("DeriveKeys, one password, key %d"), Index), FMemory::Memcmp(Keys + Index * BlockSize, Key, BlockSize) == 0);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,32 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * PBKDF2-HMAC-SHA512, the BIP39 mnemonic to seed function.
+ *
+ * The HMAC key states are computed once per password, after which each round hashes just two blocks.
+ * Batches run four derivations side by side in the AVX2 lanes where the CPU has them, and are spread over
+ * the task graph workers.
+ */
+class FPbkdf2Sha512
+{
+public:
+	static constexpr uint32 Bip39Iterations = 2048;
+	static constexpr int32 Bip39SeedSize = 64;
+
+	static void DeriveKey(TConstArrayView<uint8> Password, TConstArrayView<uint8> Salt, uint32 Iterations, uint8* OutKey, int32 KeyLen);
+
+	/**
+	 * 64 byte keys for each salt into the next 64 bytes of OutKeys. Passwords holds either one password for
+	 * all the salts, like passphrases tried against one mnemonic, or one per salt.
+	 */
+	static void DeriveKeys(TConstArrayView<TArray<uint8>> Passwords, TConstArrayView<TArray<uint8>> Salts, uint32 Iterations, uint8* OutKeys, int32 MinParallelNum = 8);
+
+	/** The BIP39 seed of a mnemonic sentence and passphrase, both UTF-8 NFKD. */
+	static TArray<uint8> MnemonicToSeed(TConstArrayView<uint8> Mnemonic, TConstArrayView<uint8> Passphrase = {});
+};
@@ -0,0 +1,288 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/ProgramAddress.h"
+
+#include "Async/ParallelFor.h"
+#include "Containers/LruCache.h"
+#include "Crypto/Base58.h"
+#include "Crypto/ed25519/ed25519.h"
+#include "Misc/AutomationTest.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include "openssl/sha.h"
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+static const char PdaMarker[] = "ProgramDerivedAddress";
+
+static const ANSICHAR TokenProgram[] = "TokenkegQfeZyiNwAJbNbGKPFXCWuBvf9Ss623VQ5DA";
+static const ANSICHAR AssociatedTokenProgram[] = "ATokenGPvbdGVxr1b2hvZbsiqW5xWH25efTNsLJA8knL";
+
+/** The program id followed by each seed with its length, so different splits of the same bytes differ. */
+struct FProgramAddressKey
+{
+	TArray<uint8> Bytes;
+	uint32 Hash = 0;
+
+	FProgramAddressKey(TConstArrayView<TArray<uint8>> Seeds, const TArray<uint8>& ProgramId)
+	{
+		Bytes.Reserve(ProgramId.Num() + Seeds.Num() * (FProgramAddress::MaxSeedLength + 1));
+		Bytes.Append(ProgramId);
+		for (const TArray<uint8>& Seed : Seeds)
+		{
+			Bytes.Add(static_cast<uint8>(Seed.Num()));
+			Bytes.Append(Seed);
+		}
+		Hash = FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+	}
+
+	bool operator==(const FProgramAddressKey& Other) const
+	{
+		return Hash == Other.Hash && Bytes == Other.Bytes;
+	}
+
+	friend uint32 GetTypeHash(const FProgramAddressKey& Key)
+	{
+		return Key.Hash;
+	}
+};
+
+struct FFoundAddress
+{
+	uint8 Address[32];
+	uint8 Bump;
+};
+
+static constexpr int32 DefaultCacheCapacity = 4096;
+
+static FCriticalSection CacheLock;
+static TLruCache<FProgramAddressKey, FFoundAddress> Cache(DefaultCacheCapacity);
+
+static bool AreSeedsValid(TConstArrayView<TArray<uint8>> Seeds, int32 MaxSeeds)
+{
+	if (Seeds.Num() > MaxSeeds)
+		return false;
+
+	for (const TArray<uint8>& Seed : Seeds)
+	{
+		if (Seed.Num() > FProgramAddress::MaxSeedLength)
+			return false;
+	}
+	return true;
+}
+
+static void HashSeeds(SHA256_CTX& Context, TConstArrayView<TArray<uint8>> Seeds)
+{
+	SHA256_Init(&Context);
+	for (const TArray<uint8>& Seed : Seeds)
+	{
+		SHA256_Update(&Context, Seed.GetData(), Seed.Num());
+	}
+}
+
+/** Finishes the hash of the seeds in SeedsContext, which is left as it is. True if the address is off the curve. */
+static bool FinishAddress(const SHA256_CTX& SeedsContext, const uint8* Bump, const uint8* ProgramId, uint8* OutAddress)
+{
+	SHA256_CTX Context = SeedsContext;
+	if (Bump)
+	{
+		SHA256_Update(&Context, Bump, 1);
+	}
+	SHA256_Update(&Context, ProgramId, 32);
+	SHA256_Update(&Context, PdaMarker, sizeof(PdaMarker) - 1);
+	SHA256_Final(OutAddress, &Context);
+
+	return !ed25519_is_on_curve(OutAddress);
+}
+
+static bool FindAddress(TConstArrayView<TArray<uint8>> Seeds, const TArray<uint8>& ProgramId, FFoundAddress& OutFound)
+{
+	// The bump seed takes up one of the seeds.
+	if (ProgramId.Num() != 32 || !AreSeedsValid(Seeds, FProgramAddress::MaxSeeds - 1))
+		return false;
+
+	const FProgramAddressKey Key(Seeds, ProgramId);
+	{
+		FScopeLock Lock(&CacheLock);
+		if (const FFoundAddress* Found = Cache.FindAndTouch(Key))
+		{
+			OutFound = *Found;
+			return true;
+		}
+	}
+
+	// About half of all hashes are on the curve, the seeds are only hashed once for all the bumps tried.
+	SHA256_CTX SeedsContext;
+	HashSeeds(SeedsContext, Seeds);
+
+	for (int32 Bump = 255; Bump > 0; Bump--)
+	{
+		OutFound.Bump = static_cast<uint8>(Bump);
+		if (FinishAddress(SeedsContext, &OutFound.Bump, ProgramId.GetData(), OutFound.Address))
+		{
+			FScopeLock Lock(&CacheLock);
+			Cache.Add(Key, OutFound);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FProgramAddress::Create(TConstArrayView<TArray<uint8>> Seeds, const TArray<uint8>& ProgramId, TArray<uint8>& OutAddress)
+{
+	if (ProgramId.Num() != 32 || !AreSeedsValid(Seeds, MaxSeeds))
+		return false;
+
+	SHA256_CTX SeedsContext;
+	HashSeeds(SeedsContext, Seeds);
+
+	OutAddress.SetNumUninitialized(32);
+	return FinishAddress(SeedsContext, nullptr, ProgramId.GetData(), OutAddress.GetData());
+}
+
+bool FProgramAddress::Find(TConstArrayView<TArray<uint8>> Seeds, const TArray<uint8>& ProgramId, TArray<uint8>& OutAddress, uint8& OutBump)
+{
+	FFoundAddress Found;
+	if (!FindAddress(Seeds, ProgramId, Found))
+		return false;
+
+	OutAddress = TArray<uint8>(Found.Address, 32);
+	OutBump = Found.Bump;
+	return true;
+}
+
+static TArray<uint8> DecodeProgramId(const ANSICHAR* Encoded)
+{
+	TArray<uint8> ProgramId;
+	ProgramId.SetNumUninitialized(32);
+	verify(FBase58::DecodeFixed<32>(MakeArrayView(Encoded, FCStringAnsi::Strlen(Encoded)), ProgramId.GetData()));
+	return ProgramId;
+}
+
+bool FProgramAddress::FindAssociatedTokenAddress(const TArray<uint8>& Wallet, const TArray<uint8>& Mint, TArray<uint8>& OutAddress)
+{
+	static const TArray<uint8> TokenProgramId = DecodeProgramId(TokenProgram);
+	static const TArray<uint8> AssociatedTokenProgramId = DecodeProgramId(AssociatedTokenProgram);
+
+	const TArray<uint8> Seeds[] = { Wallet, TokenProgramId, Mint };
+	uint8 Bump;
+	return Find(Seeds, AssociatedTokenProgramId, OutAddress, Bump);
+}
+
+void FProgramAddress::Find(TConstArrayView<FRequest> Requests, TArray<FResult>& OutResults, int32 MinParallelNum)
+{
+	OutResults.SetNumUninitialized(Requests.Num());
+	FResult* Results = OutResults.GetData();
+
+	ParallelFor(Requests.Num(), [Requests, Results](int32 Index)
+	{
+		FFoundAddress Found = {};
+		FResult& Result = Results[Index];
+		Result.bFound = FindAddress(Requests[Index].Seeds, Requests[Index].ProgramId, Found);
+		FMemory::Memcpy(Result.Address, Found.Address, sizeof(Result.Address));
+		Result.Bump = Found.Bump;
+	}, Requests.Num() < MinParallelNum ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void FProgramAddress::SetCacheCapacity(int32 Capacity)
+{
+	check(Capacity > 0);
+
+	FScopeLock Lock(&CacheLock);
+	Cache.Empty(Capacity);
+}
+
+int32 FProgramAddress::GetCacheCapacity()
+{
+	FScopeLock Lock(&CacheLock);
+	return Cache.Max();
+}
+
+void FProgramAddress::EmptyCache()
+{
+	FScopeLock Lock(&CacheLock);
+	Cache.Empty(Cache.Max());
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static TArray<uint8> AnsiBytes(const ANSICHAR* Text)
+{
+	return TArray<uint8>(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProgramAddressTest, "Solana.Crypto.ProgramAddress", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FProgramAddressTest::RunTest(const FString& Parameters)
+{
+	const TArray<uint8> ProgramId = DecodeProgramId("BPFLoaderUpgradeab1e11111111111111111111111");
+	const TArray<uint8> PublicKey = DecodeProgramId("SeedPubey1111111111111111111111111111111111");
+
+	// The create_program_address vectors of the Solana SDK.
+	struct FVector
+	{
+		TArray<TArray<uint8>> Seeds;
+		const ANSICHAR* Address;
+	};
+
+	const FVector Vectors[] = {
+		{ { {}, { 1 } }, "BwqrghZA2htAcqq8dzP1WDAhTXYTYWj7CHxF5j7TDBAe" },
+		{ { AnsiBytes("\xe2\x98\x89"), { 0 } }, "13yWmRpaTR4r5nAktwLqMpRNr28tnVUZw26rTvPSSB19" },
+		{ { AnsiBytes("Talking"), AnsiBytes("Squirrels") }, "2fnQrngrQT4SeLcdToJAD96phoEjNL2man2kfRLCASVk" },
+		{ { PublicKey, { 1 } }, "976ymqVnfE32QFe6NfGDctSvVa36LWnvYxhU6G2232YL" },
+	};
+
+	TArray<uint8> Address;
+	for (const FVector& Vector : Vectors)
+	{
+		TestTrue(FString::Printf(TEXT("Create gives %hs"), Vector.Address),
+			FProgramAddress::Create(Vector.Seeds, ProgramId, Address) && Address == DecodeProgramId(Vector.Address));
+	}
+
+	TArray<uint8> MaxSeed;
+	MaxSeed.SetNumZeroed(FProgramAddress::MaxSeedLength);
+	TArray<uint8> ExceededSeed;
+	ExceededSeed.Init(127, FProgramAddress::MaxSeedLength + 1);
+
+	const TArray<uint8> MaxSeeds[] = { MaxSeed };
+	const TArray<uint8> ExceededSeeds[] = { ExceededSeed };
+	const TArray<uint8> ShortAndExceededSeeds[] = { AnsiBytes("short_seed"), ExceededSeed };
+	TestTrue(TEXT("Seed of the max length"), FProgramAddress::Create(MaxSeeds, ProgramId, Address));
+	TestFalse(TEXT("Seed over the max length"), FProgramAddress::Create(ExceededSeeds, ProgramId, Address));
+	TestFalse(TEXT("Seed over the max length after a short one"), FProgramAddress::Create(ShortAndExceededSeeds, ProgramId, Address));
+
+	uint8 Bump = 0;
+	TestFalse(TEXT("Find with a seed over the max length"), FProgramAddress::Find(ExceededSeeds, ProgramId, Address, Bump));
+
+	TArray<uint8> Joined;
+	const TArray<uint8> TalkingSeeds[] = { AnsiBytes("Talking") };
+	TestTrue(TEXT("Seeds split differently give another address"),
+		FProgramAddress::Create(TalkingSeeds, ProgramId, Address) && FProgramAddress::Create(Vectors[2].Seeds, ProgramId, Joined) && Address != Joined);
+
+	FProgramAddress::EmptyCache();
+	TestTrue(TEXT("Find takes bump 255 when it is off the curve"),
+		FProgramAddress::Find(Vectors[2].Seeds, ProgramId, Address, Bump) && Bump == 255 && Address == DecodeProgramId("HTqKuCuTUMwRJV4ceegG2CwYRxub4qjpj9DEg3nz1NGF"));
+
+	// "Talking" alone lands on the curve with bumps 255 and 254.
+	TestTrue(TEXT("Find skips the bumps on the curve"),
+		FProgramAddress::Find(TalkingSeeds, ProgramId, Address, Bump) && Bump == 253 && Address == DecodeProgramId("AzKsjBuYyjkurfVnuAv7wzgbYkkcgePo87CRQWYQVCsf"));
+	for (int32 Tried = 255; Tried >= 253; Tried--)
+	{
+		const TArray<uint8> BumpedSeeds[] = { TalkingSeeds[0], { static_cast<uint8>(Tried) } };
+		TestEqual(FString::Printf(TEXT("Create with bump %d"), Tried), FProgramAddress::Create(BumpedSeeds, ProgramId, Joined) && Joined == Address, Tried == Bump);
+	}
+
+	uint8 CachedBump = 0;
+	TestTrue(TEXT("Find again from the cache"), FProgramAddress::Find(TalkingSeeds, ProgramId, Joined, CachedBump) && CachedBump == Bump && Joined == Address);
+
+	// USDC held by the SDK seed key, as the associated token account program derives it.
+	const TArray<uint8> Mint = DecodeProgramId("EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1v");
+	TestTrue(TEXT("Associated token address"),
+		FProgramAddress::FindAssociatedTokenAddress(PublicKey, Mint, Address) && Address == DecodeProgramId("7N6mLQcinNPPkJmQaTNyiFrASrSenpRbkWQXxVcskyza"));
+	return true;
+}
+
+#endif
@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Program derived addresses, the SHA-256 of the seeds, the program id and "ProgramDerivedAddress"
+ * that has no private key because it is not a point on ed25519.
+ *
+ * Find searches the bump seed from 255 down like the Solana runtime does, and keeps what it found for
+ * the (seeds, program) pairs derived most recently, so deriving the same account again is a lookup.
+ * Safe to use from any thread.
+ */
+class FProgramAddress
+{
+public:
+	static constexpr int32 MaxSeeds = 16;
+	static constexpr int32 MaxSeedLength = 32;
+
+	struct FRequest
+	{
+		TArray<TArray<uint8>> Seeds;
+		TArray<uint8> ProgramId;
+	};
+
+	struct FResult
+	{
+		uint8 Address[32];
+		uint8 Bump;
+		/** False if the seeds were out of bounds or no bump gave an address off the curve. */
+		bool bFound;
+	};
+
+	/** False if the seeds are out of bounds or the address would be on the curve. */
+	static bool Create(TConstArrayView<TArray<uint8>> Seeds, const TArray<uint8>& ProgramId, TArray<uint8>& OutAddress);
+
+	/** The address of the highest bump seed appended to Seeds that gives one, false if none does. */
+	static bool Find(TConstArrayView<TArray<uint8>> Seeds, const TArray<uint8>& ProgramId, TArray<uint8>& OutAddress, uint8& OutBump);
+
+	/** The associated token account of Wallet for Mint, under the SPL token program. */
+	static bool FindAssociatedTokenAddress(const TArray<uint8>& Wallet, const TArray<uint8>& Mint, TArray<uint8>& OutAddress);
+
+	/** Find for each request. Spans of at least MinParallelNum requests are spread over the task graph workers. */
+	static void Find(TConstArrayView<FRequest> Requests, TArray<FResult>& OutResults, int32 MinParallelNum = 64);
+
+	/** About 100 bytes per entry plus the seeds. Changing it empties the cache. */
+	static void SetCacheCapacity(int32 Capacity);
+	static int32 GetCacheCapacity();
+	static void EmptyCache();
+};
@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/StreamingSignature.h"
+
+#include "Async/MappedFileHandle.h"
+#include "Crypto/ed25519/ed25519.h"
+#include "HAL/PlatformFileManager.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/crypto.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+DECLARE_LOG_CATEGORY_CLASS(LogStreamingSignature, Log, All);
+
+// Bytes of a file mapped at a time. Its pages are only read, so the system can drop them, and unmapping releases them.
+static constexpr int64 MappedWindowSize = 64 * 1024 * 1024;
+// Bytes of a file read at a time where it cannot be mapped.
+static constexpr int64 ReadBufferSize = 1024 * 1024;
+
+static int ReadStreamChunk(void* Context, unsigned long long Offset, const unsigned char** Chunk, size_t* ChunkLen)
+{
+	TConstArrayView<uint8> View;
+	if (!(*static_cast<FStreamingSignature::FChunkProvider*>(Context))(Offset, View))
+		return 0;
+
+	*Chunk = View.GetData();
+	*ChunkLen = View.Num();
+	return 1;
+}
+
+/** Hands out a file a mapped window at a time, falling back to reads into a buffer. */
+class FFileChunkProvider
+{
+public:
+	explicit FFileChunkProvider(const FString& Filename)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		MappedFile.Reset(PlatformFile.OpenMapped(*Filename));
+		if (MappedFile.IsValid())
+		{
+			FileSize = MappedFile->GetFileSize();
+			return;
+		}
+
+		File.Reset(PlatformFile.OpenRead(*Filename));
+		if (File.IsValid())
+		{
+			FileSize = File->Size();
+			Buffer.SetNumUninitialized(ReadBufferSize);
+		}
+	}
+
+	bool IsOpen() const { return MappedFile.IsValid() || File.IsValid(); }
+
+	bool Read(uint64 Offset, TConstArrayView<uint8>& OutChunk)
+	{
+		const int64 Start = static_cast<int64>(Offset);
+		if (Start >= FileSize)
+		{
+			OutChunk = TConstArrayView<uint8>();
+			return true;
+		}
+
+		if (MappedFile.IsValid())
+		{
+			if (!Region.IsValid() || Start < RegionStart || Start >= RegionStart + static_cast<int64>(Region->GetMappedSize()))
+			{
+				// The previous window goes first, so no more than one is mapped.
+				Region.Reset();
+				Region.Reset(MappedFile->MapRegion(Start, FMath::Min(MappedWindowSize, FileSize - Start)));
+				if (!Region.IsValid())
+				{
+					UE_LOG(LogStreamingSignature, Warning, TEXT("Could not map %lld bytes at %lld"), FMath::Min(MappedWindowSize, FileSize - Start), Start);
+					return false;
+				}
+				RegionStart = Start;
+			}
+			const int64 Skip = Start - RegionStart;
+			OutChunk = TConstArrayView<uint8>(Region->GetMappedPtr() + Skip, static_cast<int32>(Region->GetMappedSize() - Skip));
+			return true;
+		}
+
+		const int64 Size = FMath::Min(ReadBufferSize, FileSize - Start);
+		if (!File->Seek(Start) || !File->Read(Buffer.GetData(), Size))
+		{
+			UE_LOG(LogStreamingSignature, Warning, TEXT("Could not read %lld bytes at %lld"), Size, Start);
+			return false;
+		}
+		OutChunk = TConstArrayView<uint8>(Buffer.GetData(), static_cast<int32>(Size));
+		return true;
+	}
+
+private:
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> Region;
+	int64 RegionStart = 0;
+	TUniquePtr<IFileHandle> File;
+	TArray<uint8> Buffer;
+	int64 FileSize = 0;
+};
+
+bool FStreamingSignature::Sign(FChunkProvider ReadChunk, const TArray<uint8>& PrivateKey, TArray<uint8>& OutSignature)
+{
+	if (PrivateKey.Num() != 64)
+		return false;
+
+	uint8 Expanded[64];
+	ed25519_expand_private_key(Expanded, PrivateKey.GetData());
+	OutSignature.SetNumUninitialized(64);
+	const bool bSigned = ed25519_sign_expanded_stream(OutSignature.GetData(), &ReadStreamChunk, &ReadChunk, PrivateKey.GetData() + 32, Expanded) != 0;
+	OPENSSL_cleanse(Expanded, sizeof(Expanded));
+
+	if (!bSigned)
+	{
+		OutSignature.Reset();
+	}
+	return bSigned;
+}
+
+bool FStreamingSignature::Verify(FChunkProvider ReadChunk, const TArray<uint8>& Signature, const TArray<uint8>& PublicKey)
+{
+	if (Signature.Num() != 64 || PublicKey.Num() != 32)
+		return false;
+
+	return ed25519_verify_stream(Signature.GetData(), &ReadStreamChunk, &ReadChunk, PublicKey.GetData()) != 0;
+}
+
+bool FStreamingSignature::SignFile(const FString& Filename, const TArray<uint8>& PrivateKey, TArray<uint8>& OutSignature)
+{
+	FFileChunkProvider Provider(Filename);
+	if (!Provider.IsOpen())
+	{
+		UE_LOG(LogStreamingSignature, Warning, TEXT("Could not open %s"), *Filename);
+		return false;
+	}
+
+	return Sign([&Provider](uint64 Offset, TConstArrayView<uint8>& OutChunk) { return Provider.Read(Offset, OutChunk); }, PrivateKey, OutSignature);
+}
+
+bool FStreamingSignature::VerifyFile(const FString& Filename, const TArray<uint8>& Signature, const TArray<uint8>& PublicKey)
+{
+	FFileChunkProvider Provider(Filename);
+	if (!Provider.IsOpen())
+	{
+		UE_LOG(LogStreamingSignature, Warning, TEXT("Could not open %s"), *Filename);
+		return false;
+	}
+
+	return Verify([&Provider](uint64 Offset, TConstArrayView<uint8>& OutChunk) { return Provider.Read(Offset, OutChunk); }, Signature, PublicKey);
+}
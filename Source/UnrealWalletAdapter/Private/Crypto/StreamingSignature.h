@@ -0,0 +1,35 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Ed25519 signatures over messages too large to hold in memory, like content manifests and replays, read
+ * piece by piece instead of from one array.
+ *
+ * Signing reads the message twice, verifying once. Files are memory-mapped a window at a time, or read
+ * through a small buffer where the platform cannot map them, so the memory used does not grow with their
+ * size. Signatures are the same as those of FCryptoUtils::SignMessage over the whole message.
+ */
+class FStreamingSignature
+{
+public:
+	/**
+	 * Sets OutChunk to bytes of the message from Offset on, as many as are at hand, and to an empty view past
+	 * the end. False if the message cannot be read. The view has to stay valid until the next call.
+	 */
+	using FChunkProvider = TFunctionRef<bool(uint64 Offset, TConstArrayView<uint8>& OutChunk)>;
+
+	/**
+	 * False if a read fails, or if the message read differently the second time, as a nonce derived from one
+	 * message must not sign another.
+	 */
+	static bool Sign(FChunkProvider ReadChunk, const TArray<uint8>& PrivateKey, TArray<uint8>& OutSignature);
+	static bool Verify(FChunkProvider ReadChunk, const TArray<uint8>& Signature, const TArray<uint8>& PublicKey);
+
+	static bool SignFile(const FString& Filename, const TArray<uint8>& PrivateKey, TArray<uint8>& OutSignature);
+	static bool VerifyFile(const FString& Filename, const TArray<uint8>& Signature, const TArray<uint8>& PublicKey);
+};
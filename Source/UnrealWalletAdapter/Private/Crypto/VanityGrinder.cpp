@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/VanityGrinder.h"
+
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Crypto/Base58.h"
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/ed25519/ed25519.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/crypto.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+#include <atomic>
+
+DECLARE_LOG_CATEGORY_CLASS(LogVanityGrinder, Log, All);
+
+// Keys per ed25519_public_key_run call, each call costing one full scalar multiplication.
+static constexpr int32 RunLength = 1024;
+
+static constexpr double ReportInterval = 10.0;
+
+/** A value of up to 288 bits in 32-bit words, least significant first, room for 58^44 > 2^256. */
+struct FWideValue
+{
+	uint32 Words[9] = {};
+
+	void MulAdd(uint32 Mul, uint32 Add)
+	{
+		uint64 Carry = Add;
+		for (uint32& Word : Words)
+		{
+			Carry += static_cast<uint64>(Word) * Mul;
+			Word = static_cast<uint32>(Carry);
+			Carry >>= 32;
+		}
+	}
+
+	bool IsAbove256Bits() const { return Words[8] != 0; }
+
+	/** Big endian, the way keys are read as numbers for base58. */
+	void ToBytes(uint8* Out) const
+	{
+		for (int32 Index = 0; Index < 32; Index++)
+		{
+			Out[Index] = static_cast<uint8>(Words[7 - Index / 4] >> (24 - 8 * (Index % 4)));
+		}
+	}
+};
+
+/**
+ * Tells from the key bytes whether its address can start with the prefix. A key that doesn't start with a
+ * zero byte encodes to 43 or 44 characters, and those starting with a prefix P of k characters are the
+ * values from P * 58^(43 - k) or P * 58^(44 - k) up to (P + 1) times the same, which are compared bytewise.
+ * Each leading '1' stands for a zero byte instead.
+ */
+class FPrefixFilter
+{
+public:
+	explicit FPrefixFilter(const FString& InPrefix)
+	{
+		for (const TCHAR Char : InPrefix)
+		{
+			Prefix.Add(static_cast<ANSICHAR>(Char));
+		}
+		while (NumLeadingOnes < Prefix.Num() && Prefix[NumLeadingOnes] == '1')
+		{
+			NumLeadingOnes++;
+		}
+		if (NumLeadingOnes > 0)
+			return;
+
+		TArray<uint8> Value;
+		verify(FBase58::Decode(Prefix, Value));
+		for (const int32 EncodedLength : { 43, 44 })
+		{
+			FWideValue Low;
+			FWideValue High;
+			for (const uint8 Byte : Value)
+			{
+				Low.MulAdd(256, Byte);
+				High.MulAdd(256, Byte);
+			}
+			High.MulAdd(1, 1);
+			for (int32 Digit = Prefix.Num(); Digit < EncodedLength; Digit++)
+			{
+				Low.MulAdd(58, 0);
+				High.MulAdd(58, 0);
+			}
+			if (Low.IsAbove256Bits())
+				continue;
+
+			FRange& Range = Ranges[NumRanges++];
+			Low.ToBytes(Range.Low);
+			High.ToBytes(Range.High);
+			Range.bUnbounded = High.IsAbove256Bits();
+		}
+	}
+
+	bool MayMatch(const uint8* Key) const
+	{
+		if (NumLeadingOnes > 0)
+		{
+			for (int32 Index = 0; Index < NumLeadingOnes; Index++)
+			{
+				if (Key[Index] != 0)
+					return false;
+			}
+			return true;
+		}
+
+		for (int32 Index = 0; Index < NumRanges; Index++)
+		{
+			const FRange& Range = Ranges[Index];
+			if (FMemory::Memcmp(Key, Range.Low, 32) >= 0 && (Range.bUnbounded || FMemory::Memcmp(Key, Range.High, 32) < 0))
+				return true;
+		}
+		return false;
+	}
+
+	bool Matches(const uint8* Key) const
+	{
+		ANSICHAR Encoded[FBase58::GetMaxEncodedLength(32)];
+		const int32 Len = FBase58::EncodeFixed<32>(Key, Encoded);
+		return Len >= Prefix.Num() && FMemory::Memcmp(Encoded, Prefix.GetData(), Prefix.Num()) == 0;
+	}
+
+private:
+	/** Keys from Low up to but not including High, both big endian. */
+	struct FRange
+	{
+		uint8 Low[32];
+		uint8 High[32];
+		/** High is 2^256. */
+		bool bUnbounded;
+	};
+
+	TArray<ANSICHAR, TInlineAllocator<FVanityGrinder::MaxPrefixLength>> Prefix;
+	int32 NumLeadingOnes = 0;
+	FRange Ranges[2];
+	int32 NumRanges = 0;
+};
+
+/** Scalar + Value, little endian, into Out. */
+static void AddToScalar(const uint8* Scalar, uint64 Value, uint8* Out)
+{
+	for (int32 Index = 0; Index < 32; Index++)
+	{
+		Value += Scalar[Index];
+		Out[Index] = static_cast<uint8>(Value);
+		Value >>= 8;
+	}
+}
+
+bool FVanityGrinder::IsValidPrefix(const FString& Prefix)
+{
+	if (Prefix.IsEmpty() || Prefix.Len() > MaxPrefixLength)
+		return false;
+
+	TArray<ANSICHAR, TInlineAllocator<MaxPrefixLength>> Chars;
+	for (const TCHAR Char : Prefix)
+	{
+		if (Char > 0x7f)
+			return false;
+		Chars.Add(static_cast<ANSICHAR>(Char));
+	}
+	TArray<uint8> Value;
+	return FBase58::Decode(Chars, Value);
+}
+
+bool FVanityGrinder::Grind(const FSettings& Settings, TArray<FResult>& OutResults, FStats* OutStats)
+{
+	OutResults.Reset();
+	if (!IsValidPrefix(Settings.Prefix) || Settings.NumKeys <= 0)
+		return false;
+
+	const FPrefixFilter Filter(Settings.Prefix);
+	const int32 NumWorkers = Settings.NumWorkers > 0 ? Settings.NumWorkers : FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+
+	// Starts far below 2^255 so no walk can carry into the top bit.
+	TArray<uint8> Starts;
+	if (!FCryptoUtils::RandomBytes(Starts, NumWorkers * 32))
+	{
+		UE_LOG(LogVanityGrinder, Error, TEXT("No random start scalars"));
+		return false;
+	}
+
+	FCriticalSection ResultsLock;
+	std::atomic<bool> bDone(false);
+	std::atomic<int64> KeysSearched(0);
+	const double StartTime = FPlatformTime::Seconds();
+
+	ParallelFor(NumWorkers, [&](int32 Worker)
+	{
+		uint8* Scalar = Starts.GetData() + Worker * 32;
+		Scalar[31] &= 63;
+
+		TArray<uint8> Keys;
+		Keys.SetNumUninitialized(RunLength * 32);
+		double NextReport = StartTime + ReportInterval;
+		while (!bDone)
+		{
+			ed25519_public_key_run(Keys.GetData(), Scalar, RunLength);
+			for (int32 Index = 0; Index < RunLength; Index++)
+			{
+				const uint8* Key = Keys.GetData() + Index * 32;
+				if (!Filter.MayMatch(Key) || !Filter.Matches(Key))
+					continue;
+
+				TArray<uint8> Nonce;
+				if (!FCryptoUtils::RandomBytes(Nonce, 32))
+					continue;
+
+				FResult Result;
+				FMemory::Memcpy(Result.PublicKey, Key, 32);
+				AddToScalar(Scalar, Index, Result.ExpandedKey);
+				FMemory::Memcpy(Result.ExpandedKey + 32, Nonce.GetData(), 32);
+				{
+					FScopeLock Lock(&ResultsLock);
+					if (OutResults.Num() < Settings.NumKeys)
+					{
+						OutResults.Add(Result);
+						if (OutResults.Num() == Settings.NumKeys)
+						{
+							bDone = true;
+						}
+					}
+				}
+				OPENSSL_cleanse(&Result, sizeof(Result));
+				OPENSSL_cleanse(Nonce.GetData(), Nonce.Num());
+			}
+			AddToScalar(Scalar, RunLength, Scalar);
+			KeysSearched += RunLength;
+
+			const double Now = FPlatformTime::Seconds();
+			if (Settings.MaxSeconds > 0.0 && Now - StartTime >= Settings.MaxSeconds)
+			{
+				bDone = true;
+			}
+			if (Worker == 0 && Now >= NextReport)
+			{
+				UE_LOG(LogVanityGrinder, Display, TEXT("%lld keys searched, %.0f keys/s"), KeysSearched.load(), KeysSearched.load() / (Now - StartTime));
+				NextReport += ReportInterval;
+			}
+		}
+	});
+
+	OPENSSL_cleanse(Starts.GetData(), Starts.Num());
+
+	FStats Stats;
+	Stats.KeysSearched = KeysSearched;
+	Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogVanityGrinder, Display, TEXT("Found %d of %d keys starting with %s, %lld keys searched in %.1f s, %.0f keys/s on %d workers"),
+		OutResults.Num(), Settings.NumKeys, *Settings.Prefix, Stats.KeysSearched, Stats.Seconds, Stats.GetKeysPerSecond(), NumWorkers);
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+	return OutResults.Num() > 0;
+}
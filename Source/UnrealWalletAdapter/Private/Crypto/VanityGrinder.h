@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Searches for keypairs whose base58 address starts with a chosen prefix.
+ *
+ * Each worker walks the public keys of consecutive secret scalars from a random start, one point addition
+ * and a share of a batched field inversion per key instead of a full keypair generation. Prefixes are
+ * matched on the key bytes against the ranges of values whose encoding starts with them, only candidates
+ * inside are base58 encoded to confirm.
+ *
+ * The keys found have no seed, as they are not hashed out of one. They sign through their expanded key,
+ * with FEd25519SigningKey or ed25519_sign_expanded, and cannot be exported as a seed or seed phrase.
+ */
+class FVanityGrinder
+{
+public:
+	static constexpr int32 MaxPrefixLength = 8;
+
+	struct FSettings
+	{
+		FString Prefix;
+		/** Stops once this many keys are found. */
+		int32 NumKeys = 1;
+		/** Stops after this long even if fewer keys were found, 0 for no limit. */
+		double MaxSeconds = 0.0;
+		/** 0 for one per core. */
+		int32 NumWorkers = 0;
+	};
+
+	struct FResult
+	{
+		uint8 PublicKey[32];
+		/** The secret scalar followed by a random nonce prefix. */
+		uint8 ExpandedKey[64];
+	};
+
+	struct FStats
+	{
+		int64 KeysSearched = 0;
+		double Seconds = 0.0;
+
+		double GetKeysPerSecond() const { return Seconds > 0.0 ? KeysSearched / Seconds : 0.0; }
+	};
+
+	/** False for an empty prefix, one longer than MaxPrefixLength or one with characters outside the alphabet. */
+	static bool IsValidPrefix(const FString& Prefix);
+
+	/** Blocks until done, so best called off the game thread. False if the prefix is invalid or no key was found. */
+	static bool Grind(const FSettings& Settings, TArray<FResult>& OutResults, FStats* OutStats = nullptr);
+};
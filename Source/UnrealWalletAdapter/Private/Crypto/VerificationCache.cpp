@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/VerificationCache.h"
+
+#include "Crypto/CryptoUtils.h"
+#include "Crypto/ed25519/ed25519.h"
+
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/sha.h>
+THIRD_PARTY_INCLUDES_END
+#undef UI
+
+DECLARE_LOG_CATEGORY_CLASS(LogVerificationCache, Log, All);
+
+// Each shard has its own lock, so threads verifying different payloads rarely wait on each other.
+static constexpr int32 NumShards = 64;
+// Entries a lookup compares, the ones of its bucket.
+static constexpr int32 NumWays = 4;
+static constexpr int32 DefaultCapacity = 65536;
+
+struct FEntry
+{
+	/** All zeros while empty. */
+	uint8 Digest[32];
+};
+
+struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+{
+	FCriticalSection Lock;
+	/** NumWays entries per bucket, a power of two of buckets. */
+	TArray<FEntry> Entries;
+	/** The way each bucket replaces next. */
+	TArray<uint8> NextWay;
+	int64 Hits = 0;
+	int64 Misses = 0;
+
+	void Reset(int32 NumBuckets)
+	{
+		Entries.Reset();
+		Entries.SetNumZeroed(NumBuckets * NumWays);
+		NextWay.Reset();
+		NextWay.SetNumZeroed(NumBuckets);
+	}
+
+	bool Contains(const FEntry& Entry, uint32 BucketHash) const
+	{
+		const FEntry* Bucket = Entries.GetData() + (BucketHash & (NextWay.Num() - 1)) * NumWays;
+		for (int32 Way = 0; Way < NumWays; Way++)
+		{
+			if (FMemory::Memcmp(Bucket[Way].Digest, Entry.Digest, sizeof(Entry.Digest)) == 0)
+				return true;
+		}
+		return false;
+	}
+
+	void AddEntry(const FEntry& Entry, uint32 BucketHash)
+	{
+		const int32 Bucket = BucketHash & (NextWay.Num() - 1);
+		Entries[Bucket * NumWays + NextWay[Bucket]] = Entry;
+		NextWay[Bucket] = (NextWay[Bucket] + 1) % NumWays;
+	}
+};
+
+struct FCacheState
+{
+	FShard Shards[NumShards];
+	/** The hash state after the salt, a whole block of it. */
+	SHA256_CTX Salted;
+
+	FCacheState()
+	{
+		// Without a random salt hits are still sound, only the buckets become predictable enough to flood.
+		TArray<uint8> Salt;
+		if (!FCryptoUtils::RandomBytes(Salt, SHA256_CBLOCK))
+		{
+			UE_LOG(LogVerificationCache, Warning, TEXT("No random salt, using a fixed one"));
+			Salt.SetNumZeroed(SHA256_CBLOCK);
+		}
+		SHA256_Init(&Salted);
+		SHA256_Update(&Salted, Salt.GetData(), Salt.Num());
+
+		for (FShard& Shard : Shards)
+		{
+			Shard.Reset(GetBucketsPerShard(DefaultCapacity));
+		}
+	}
+
+	static int32 GetBucketsPerShard(int32 Capacity)
+	{
+		return FMath::RoundUpToPowerOfTwo(FMath::DivideAndRoundUp(Capacity, NumShards * NumWays));
+	}
+};
+
+static FCacheState& GetState()
+{
+	static FCacheState State;
+	return State;
+}
+
+static bool VerifyUncached(const uint8* Signature, const uint8* Message, int32 MessageLen, const uint8* PublicKey)
+{
+	return ed25519_verify(Signature, Message, MessageLen, PublicKey) != 0;
+}
+
+void FVerificationCache::SetCapacity(int32 Capacity)
+{
+	check(Capacity > 0);
+
+	const int32 NumBuckets = FCacheState::GetBucketsPerShard(Capacity);
+	for (FShard& Shard : GetState().Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		Shard.Reset(NumBuckets);
+	}
+}
+
+int32 FVerificationCache::GetCapacity()
+{
+	FShard& Shard = GetState().Shards[0];
+	FScopeLock Lock(&Shard.Lock);
+	return Shard.Entries.Num() * NumShards;
+}
+
+bool FVerificationCache::Verify(const uint8* Signature, const uint8* Message, int32 MessageLen, const uint8* PublicKey)
+{
+	return Verify(Signature, Message, MessageLen, PublicKey, &VerifyUncached);
+}
+
+bool FVerificationCache::Verify(const uint8* Signature, const uint8* Message, int32 MessageLen, const uint8* PublicKey, FVerifyFunction MissVerify)
+{
+	FCacheState& State = GetState();
+
+	FEntry Entry;
+	SHA256_CTX Context = State.Salted;
+	SHA256_Update(&Context, Signature, 64);
+	SHA256_Update(&Context, PublicKey, 32);
+	SHA256_Update(&Context, Message, MessageLen);
+	SHA256_Final(Entry.Digest, &Context);
+
+	// The digest is uniform, its first byte picks the shard and the next four the bucket.
+	FShard& Shard = State.Shards[Entry.Digest[0] % NumShards];
+	uint32 BucketHash;
+	FMemory::Memcpy(&BucketHash, Entry.Digest + 1, sizeof(BucketHash));
+	{
+		FScopeLock Lock(&Shard.Lock);
+		if (Shard.Contains(Entry, BucketHash))
+		{
+			Shard.Hits++;
+			return true;
+		}
+		Shard.Misses++;
+	}
+
+	// Verified outside the lock, two threads missing on the same payload both do it and one entry is kept.
+	if (!MissVerify(Signature, Message, MessageLen, PublicKey))
+		return false;
+
+	FScopeLock Lock(&Shard.Lock);
+	if (!Shard.Contains(Entry, BucketHash))
+	{
+		Shard.AddEntry(Entry, BucketHash);
+	}
+	return true;
+}
+
+FVerificationCache::FStats FVerificationCache::GetStats()
+{
+	FStats Stats;
+	for (FShard& Shard : GetState().Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		Stats.Hits += Shard.Hits;
+		Stats.Misses += Shard.Misses;
+	}
+	return Stats;
+}
+
+void FVerificationCache::ResetStats()
+{
+	for (FShard& Shard : GetState().Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		Shard.Hits = 0;
+		Shard.Misses = 0;
+	}
+}
+
+void FVerificationCache::Empty()
+{
+	for (FShard& Shard : GetState().Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		Shard.Reset(Shard.NextWay.Num());
+	}
+}
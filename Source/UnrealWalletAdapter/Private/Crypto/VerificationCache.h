@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Signatures already found valid, so payloads seen again, like retries and rebroadcasts, skip verification.
+ *
+ * Entries are a SHA-256 of the signature, public key and message under a random per-process salt, so a hit
+ * costs one pass over the message and a probe of a few entries under one of many shard locks, against tens
+ * of microseconds for a verify. Invalid signatures are not kept, so they cannot push valid ones out.
+ * Safe to use from any thread.
+ */
+class FVerificationCache
+{
+public:
+	struct FStats
+	{
+		int64 Hits = 0;
+		int64 Misses = 0;
+
+		double GetHitRate() const { return Hits + Misses > 0 ? static_cast<double>(Hits) / (Hits + Misses) : 0.0; }
+	};
+
+	using FVerifyFunction = bool (*)(const uint8* Signature, const uint8* Message, int32 MessageLen, const uint8* PublicKey);
+
+	/** 32 bytes per entry, rounded up to whole buckets. Changing it empties the cache. */
+	static void SetCapacity(int32 Capacity);
+	static int32 GetCapacity();
+
+	/** ed25519_verify, unless the same signature, key and message were found valid before. */
+	static bool Verify(const uint8* Signature, const uint8* Message, int32 MessageLen, const uint8* PublicKey);
+	/** Verify with misses checked by MissVerify, like FVerifyingKeyCache::Verify. */
+	static bool Verify(const uint8* Signature, const uint8* Message, int32 MessageLen, const uint8* PublicKey, FVerifyFunction MissVerify);
+
+	static FStats GetStats();
+	static void ResetStats();
+
+	static void Empty();
+};
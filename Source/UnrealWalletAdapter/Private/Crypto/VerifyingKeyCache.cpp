@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Crypto/VerifyingKeyCache.h"
+
+#include "Containers/LruCache.h"
+#include "Crypto/ed25519/ed25519.h"
+
+struct FPublicKeyBytes
+{
+	uint8 Bytes[32];
+
+	bool operator==(const FPublicKeyBytes& Other) const
+	{
+		return FMemory::Memcmp(Bytes, Other.Bytes, sizeof(Bytes)) == 0;
+	}
+
+	friend uint32 GetTypeHash(const FPublicKeyBytes& Key)
+	{
+		// Public keys are uniformly distributed already.
+		uint32 Hash;
+		FMemory::Memcpy(&Hash, Key.Bytes, sizeof(Hash));
+		return Hash;
+	}
+};
+
+// Entries are shared so a verify can keep using one while another thread evicts it.
+using FPreparedKeyPtr = TSharedPtr<const ed25519_prepared_key, ESPMode::ThreadSafe>;
+
+static constexpr int32 DefaultCapacity = 4096;
+
+static FCriticalSection CacheLock;
+static TLruCache<FPublicKeyBytes, FPreparedKeyPtr> Cache(DefaultCapacity);
+
+void FVerifyingKeyCache::SetCapacity(int32 Capacity)
+{
+	check(Capacity > 0);
+
+	FScopeLock Lock(&CacheLock);
+	Cache.Empty(Capacity);
+}
+
+int32 FVerifyingKeyCache::GetCapacity()
+{
+	FScopeLock Lock(&CacheLock);
+	return Cache.Max();
+}
+
+bool FVerifyingKeyCache::Verify(const uint8* Signature, const uint8* Message, int32 MessageLen, const uint8* PublicKey)
+{
+	FPublicKeyBytes Key;
+	FMemory::Memcpy(Key.Bytes, PublicKey, sizeof(Key.Bytes));
+
+	FPreparedKeyPtr Prepared;
+	{
+		FScopeLock Lock(&CacheLock);
+		if (const FPreparedKeyPtr* Found = Cache.FindAndTouch(Key))
+		{
+			Prepared = *Found;
+		}
+	}
+
+	if (!Prepared.IsValid())
+	{
+		// Prepared outside the lock, two threads missing on the same key both do it and one copy is kept.
+		TSharedRef<ed25519_prepared_key, ESPMode::ThreadSafe> NewKey = MakeShared<ed25519_prepared_key, ESPMode::ThreadSafe>();
+		if (!ed25519_prepare_key(&NewKey.Get(), PublicKey))
+			return false;
+
+		FScopeLock Lock(&CacheLock);
+		Cache.Add(Key, NewKey);
+		Prepared = NewKey;
+	}
+
+	return ed25519_verify_prepared(Signature, Message, MessageLen, Prepared.Get()) != 0;
+}
+
+void FVerifyingKeyCache::Empty()
+{
+	FScopeLock Lock(&CacheLock);
+	Cache.Empty(Cache.Max());
+}
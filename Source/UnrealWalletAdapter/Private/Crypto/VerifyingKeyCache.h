@@ -0,0 +1,26 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Public keys decoded into the tables ed25519 verification needs, kept for the signers seen most recently.
+ *
+ * Verifying against a cached key skips decoding it and building its multiples, and uses a wider window
+ * for the base point, which about halves the cost of each repeat signature. A miss costs a little more
+ * than a plain verify. Safe to use from any thread.
+ */
+class FVerifyingKeyCache
+{
+public:
+	/** About 4 KB per key. Changing it empties the cache. */
+	static void SetCapacity(int32 Capacity);
+	static int32 GetCapacity();
+
+	static bool Verify(const uint8* Signature, const uint8* Message, int32 MessageLen, const uint8* PublicKey);
+
+	static void Empty();
+};
@@ -25,12 +25,107 @@ int ED25519_DECLSPEC ed25519_create_seed(unsigned char *seed);
 #endif
     
 void ED25519_DECLSPEC ed25519_create_keypair(unsigned char *public_key, unsigned char *private_key, const unsigned char *seed);
+/*
+   ed25519_create_keypair of count seeds, 32 bytes each, into 32 and 64 bytes each. The seeds are hashed
+   four at a time where AVX2 is enabled and the public keys share their field inversions.
+*/
+void ED25519_DECLSPEC ed25519_create_keypairs(unsigned char *public_keys, unsigned char *private_keys, const unsigned char *seeds, size_t count);
+
+/* A fixed-base table of its own, for comparing widths without touching the one installed. */
+typedef struct ed25519_base_table ed25519_base_table;
+/* NULL if window isn't 4 to 8 or memory runs out. */
+ed25519_base_table ED25519_DECLSPEC *ed25519_base_table_create(int window);
+void ED25519_DECLSPEC ed25519_base_table_free(ed25519_base_table *table);
+/* ed25519_create_keypairs over table, or over the built-in table for NULL. */
+void ED25519_DECLSPEC ed25519_create_keypairs_with_table(unsigned char *public_keys, unsigned char *private_keys, const unsigned char *seeds, size_t count, const ed25519_base_table *table);
+/*
+   Public keys of the count scalars scalar, scalar + 1, ..., one base point addition apart and sharing
+   field inversions, for searches over many keys. scalar is 32 bytes little endian, and scalar + count
+   must stay below 2^255. The keys have no seed, they sign through ed25519_sign_expanded.
+*/
+void ED25519_DECLSPEC ed25519_public_key_run(unsigned char *public_keys, const unsigned char *scalar, size_t count);
 void ED25519_DECLSPEC ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *private_key);
+/* Signing split in two for signers that keep the 64 byte expanded key around: the clamped scalar followed by the nonce prefix. */
+void ED25519_DECLSPEC ed25519_expand_private_key(unsigned char *expanded, const unsigned char *private_key);
+void ED25519_DECLSPEC ed25519_sign_expanded(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *expanded);
+/* Signs count messages with one expanded key, hashing four at a time where AVX2 is enabled. signatures receives 64 bytes each. */
+void ED25519_DECLSPEC ed25519_sign_expanded_many(unsigned char *signatures, const unsigned char *const *messages, const size_t *message_lens, size_t count, const unsigned char *public_key, const unsigned char *expanded);
 int ED25519_DECLSPEC ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key);
+
+/*
+   Hands out a message piece by piece to the stream functions: points *chunk at bytes of it from offset on, as
+   many as are at hand, and sets *chunk_len to their count, 0 past the end. Returns 0 if the message cannot be
+   read. Pieces are asked for in order, but signing reads the message twice.
+*/
+typedef int (*ed25519_read_chunk)(void *context, unsigned long long offset, const unsigned char **chunk, size_t *chunk_len);
+/* ed25519_sign_expanded over a streamed message. Returns 0, with a zeroed signature, if a read fails or the two reads differ. */
+int ED25519_DECLSPEC ed25519_sign_expanded_stream(unsigned char *signature, ed25519_read_chunk read, void *context, const unsigned char *public_key, const unsigned char *expanded);
+/* ed25519_verify over a streamed message, read once. Returns 0 if a read fails as well. */
+int ED25519_DECLSPEC ed25519_verify_stream(const unsigned char *signature, ed25519_read_chunk read, void *context, const unsigned char *public_key);
+
+/*
+   Cofactored verification: s < 2^253, R canonical, R and A not of small order, and 8 * (s B - R - h A) = 0.
+   It accepts every signature ed25519_verify does whose points are torsion free, and some with mixed order
+   points that ed25519_verify refuses.
+*/
+int ED25519_DECLSPEC ed25519_verify_cofactored(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key);
+/*
+   Verifies count signatures, weighted by 16 unpredictable random bytes each. Returns 1 when all are valid, valid
+   receives each result if given. Each result is that of ed25519_verify_cofactored, whatever the other signatures.
+*/
+int ED25519_DECLSPEC ed25519_verify_batch(const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, size_t count, const unsigned char *random, int *valid);
+
+/* A public key decoded once, with the tables verification needs, for signers that sign over and over. */
+typedef struct {
+    unsigned char public_key[32];
+    unsigned long long tables[480];
+} ed25519_prepared_key;
+
+/* Returns 0 if public_key isn't a valid point. */
+int ED25519_DECLSPEC ed25519_prepare_key(ed25519_prepared_key *key, const unsigned char *public_key);
+int ED25519_DECLSPEC ed25519_verify_prepared(const unsigned char *signature, const unsigned char *message, size_t message_len, const ed25519_prepared_key *key);
+
+/* Returns 1 if point decodes to a point on the curve, which program derived addresses must not. */
+int ED25519_DECLSPEC ed25519_is_on_curve(const unsigned char *point);
+
 void ED25519_DECLSPEC ed25519_add_scalar(unsigned char *public_key, unsigned char *private_key, const unsigned char *scalar);
 void ED25519_DECLSPEC ed25519_key_exchange(unsigned char *shared_secret, const unsigned char *public_key, const unsigned char *private_key);
     
 void ED25519_DECLSPEC ed25519_sha512(const unsigned char *message, size_t message_len, unsigned char *out);
+
+/*
+   Builds and installs a fixed-base table with a row for each window of window bits, 4 to 8, for key
+   generation and signing: fewer point additions for a larger table, about 60KB at 4 bits, 100KB at 5 and
+   480KB at 8. Meant to be called once, at startup before any other thread uses the library; the table is
+   never replaced after that. Returns 1 if the table was built and is now in use, 0 for window 0, which
+   keeps the built-in table, for a window out of range, if memory runs out, or if a table is installed already.
+*/
+int ED25519_DECLSPEC ed25519_use_base_window(int window);
+/* The window of the table in use, 0 for the built-in one. */
+int ED25519_DECLSPEC ed25519_get_base_window(void);
+
+/*
+   Lets scalar multiplication and batched SHA-512 use AVX2, only to be set once the CPU is known to support it.
+   Returns 1 if any AVX2 code is built in and now used.
+*/
+int ED25519_DECLSPEC ed25519_enable_avx2(int enabled);
+/*
+   For comparing backends without switching them: the fixed-base multiplication of key generation and
+   signing, over the built-in table, and the double multiplication of verification, a * point + b * B with
+   point negated as verification decodes it, each on the portable code or, for avx2, on the AVX2 code. out
+   is the encoded result. scalar[31], a[31] and b[31] must be at most 127. avx2 is only for CPUs that have
+   it. Return 0 if the backend isn't built in or point doesn't decode.
+*/
+int ED25519_DECLSPEC ed25519_scalarmult_base_on(unsigned char *out, const unsigned char *scalar, int avx2);
+int ED25519_DECLSPEC ed25519_double_scalarmult_on(unsigned char *out, const unsigned char *a, const unsigned char *point, const unsigned char *b, int avx2);
+/* Lets SHA-512 use the ARMv8.2 SHA512 instructions, returns 1 if they are built in and pass the known answer tests. */
+int ED25519_DECLSPEC ed25519_enable_sha512_ext(int enabled);
+/* Runs the FIPS 180-2 known answer tests on the SHA-512 backends in use, returns 1 if all pass. */
+int ED25519_DECLSPEC ed25519_sha512_self_test(void);
+/* Checks the 64 bit scalar arithmetic against the portable code on edge cases and pseudo-random inputs, returns 1 if they agree. */
+int ED25519_DECLSPEC ed25519_sc_self_test(void);
+/* Checks the radix 2^51 field arithmetic against the portable code on edge cases and pseudo-random inputs, returns 1 if they agree. */
+int ED25519_DECLSPEC ed25519_fe_self_test(void);
     
 #ifdef __cplusplus
 }
@@ -9,11 +9,14 @@
  * Tom St Denis, tomstdenis@gmail.com, http://libtom.org
  */
 
+#include <string.h>
+
 #include "fixedint.h"
+#include "ed25519.h"
 #include "ed_sha512.h"
 
-/* the K array */
-static const uint64_t K[80] = {
+/* the K array, shared with the backends */
+const uint64_t ed_sha512_K[80] = {
     UINT64_C(0x428a2f98d728ae22), UINT64_C(0x7137449123ef65cd), 
     UINT64_C(0xb5c0fbcfec4d3b2f), UINT64_C(0xe9b5dba58189dbbc),
     UINT64_C(0x3956c25bf348b538), UINT64_C(0x59f111f1b605d019), 
@@ -86,16 +89,19 @@ static const uint64_t K[80] = {
 #ifndef MIN
    #define MIN(x, y) ( ((x)<(y))?(x):(y) )
 #endif
+#ifndef MAX
+   #define MAX(x, y) ( ((x)>(y))?(x):(y) )
+#endif
 
 /* compress 1024-bits */
-static int sha512_compress(sha512_context *md, unsigned char *buf)
+static int sha512_compress(uint64_t *state, const unsigned char *buf)
 {
     uint64_t S[8], W[80], t0, t1;
     int i;
 
     /* copy state into S */
     for (i = 0; i < 8; i++) {
-        S[i] = md->state[i];
+        S[i] = state[i];
     }
 
     /* copy the state into 1024-bits into W[0..15] */
@@ -110,7 +116,7 @@ static int sha512_compress(sha512_context *md, unsigned char *buf)
 
 /* Compress */
     #define RND(a,b,c,d,e,f,g,h,i) \
-    t0 = h + Sigma1(e) + Ch(e, f, g) + K[i] + W[i]; \
+    t0 = h + Sigma1(e) + Ch(e, f, g) + ed_sha512_K[i] + W[i]; \
     t1 = Sigma0(a) + Maj(a, b, c);\
     d += t0; \
     h  = t0 + t1;
@@ -132,12 +138,22 @@ static int sha512_compress(sha512_context *md, unsigned char *buf)
 
     /* feedback */
    for (i = 0; i < 8; i++) {
-        md->state[i] = md->state[i] + S[i];
+        state[i] = state[i] + S[i];
     }
 
     return 0;
 }
 
+static void sha512_blocks_portable(uint64_t state[8], const unsigned char *in, size_t blocks)
+{
+    for (; blocks > 0; --blocks, in += 128) {
+        sha512_compress(state, in);
+    }
+}
+
+/* the block function of the selected backend */
+static void (*sha512_blocks)(uint64_t state[8], const unsigned char *in, size_t blocks) = sha512_blocks_portable;
+
 
 /**
    Initialize the hash state
@@ -171,21 +187,19 @@ int ed_sha512_init(sha512_context * md) {
 int ed_sha512_update (sha512_context * md, const unsigned char *in, size_t inlen)               
 {                                                                                           
     size_t n;
-    size_t i;                                                                        
-    int           err;     
+    size_t i;
     if (md == NULL) return 1;  
     if (in == NULL) return 1;                                                              
     if (md->curlen > sizeof(md->buf)) {                             
        return 1;                                                            
     }                                                                                       
     while (inlen > 0) {                                                                     
-        if (md->curlen == 0 && inlen >= 128) {                           
-           if ((err = sha512_compress (md, (unsigned char *)in)) != 0) {               
-              return err;                                                                   
-           }                                                                                
-           md->length += 128 * 8;                                        
-           in             += 128;                                                    
-           inlen          -= 128;                                                    
+        if (md->curlen == 0 && inlen >= 128) {
+           n = inlen / 128;
+           sha512_blocks(md->state, in, n);
+           md->length += 128 * 8 * (uint64_t)n;
+           in             += 128 * n;
+           inlen          -= 128 * n;
         } else {                                                                            
            n = MIN(inlen, (128 - md->curlen));
 
@@ -197,10 +211,8 @@ int ed_sha512_update (sha512_context * md, const unsigned char *in, size_t inlen
            md->curlen += n;                                                     
            in             += n;                                                             
            inlen          -= n;                                                             
-           if (md->curlen == 128) {                                      
-              if ((err = sha512_compress (md, md->buf)) != 0) {            
-                 return err;                                                                
-              }                                                                             
+           if (md->curlen == 128) {
+              sha512_blocks(md->state, md->buf, 1);
               md->length += 8*128;                                       
               md->curlen = 0;                                                   
            }                                                                                
@@ -240,7 +252,7 @@ int ed_sha512_update (sha512_context * md, const unsigned char *in, size_t inlen
         while (md->curlen < 128) {
             md->buf[md->curlen++] = (unsigned char)0;
         }
-        sha512_compress(md, md->buf);
+        sha512_blocks(md->state, md->buf, 1);
         md->curlen = 0;
     }
 
@@ -254,7 +266,7 @@ while (md->curlen < 120) {
 
     /* store length */
 STORE64H(md->length, md->buf+120);
-sha512_compress(md, md->buf);
+sha512_blocks(md->state, md->buf, 1);
 
     /* copy output */
 for (i = 0; i < 8; i++) {
@@ -273,3 +285,436 @@ int ed_sha512(const unsigned char *message, size_t message_len, unsigned char *o
     if ((ret = ed_sha512_final(&ctx, out))) return ret;
     return 0;
 }
+
+
+
+/* the initial state, as set by ed_sha512_init */
+static const uint64_t sha512_iv[8] = {
+    UINT64_C(0x6a09e667f3bcc908), UINT64_C(0xbb67ae8584caa73b), UINT64_C(0x3c6ef372fe94f82b), UINT64_C(0xa54ff53a5f1d36f1),
+    UINT64_C(0x510e527fade682d1), UINT64_C(0x9b05688c2b3e6c1f), UINT64_C(0x1f83d9abfb41bd6b), UINT64_C(0x5be0cd19137e2179)
+};
+
+/*
+   Block k of the padded message in p, len bytes long and following prefix bytes already compressed.
+   Points into the message when the block lies within one part, otherwise it is assembled in buf.
+*/
+static const unsigned char *sha512_padded_block(const sha512_parts *p, size_t len, uint64_t prefix, size_t k, unsigned char *buf)
+{
+    size_t offset = 128 * k;
+    size_t start = 0;
+    size_t n;
+    int i;
+
+    for (i = 0; i < 3; i++) {
+        if (offset >= start && offset + 128 <= start + p->lens[i]) {
+            return p->parts[i] + (offset - start);
+        }
+        start += p->lens[i];
+    }
+
+    /* empty parts may be NULL, and are skipped rather than copied from */
+    start = 0;
+    for (i = 0; i < 3; i++) {
+        size_t end = start + p->lens[i];
+        if (p->lens[i] != 0 && end > offset && start < offset + 128) {
+            size_t from = offset > start ? offset - start : 0;
+            size_t to = MIN(end, offset + 128) - start;
+            memcpy(buf + (start + from - offset), p->parts[i] + from, to - from);
+        }
+        start = end;
+    }
+
+    n = len > offset ? MIN(len - offset, 128) : 0;
+    if (n < 128) {
+        memset(buf + n, 0, 128 - n);
+        if (len >= offset) {
+            buf[len - offset] = 0x80;
+        }
+    }
+
+    /* the final block ends with the length in bits */
+    if (k == (len + 17 + 127) / 128 - 1) {
+        STORE64H((prefix + len) * 8, buf + 120);
+    }
+
+    return buf;
+}
+
+static void sha512_parts_with(void (*blocks)(uint64_t state[8], const unsigned char *in, size_t blocks), const uint64_t *start, uint64_t prefix, const sha512_parts *p, unsigned char *out)
+{
+    uint64_t state[8];
+    unsigned char buf[128];
+    size_t len = p->lens[0] + p->lens[1] + p->lens[2];
+    size_t count = (len + 17 + 127) / 128;
+    size_t k;
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        state[i] = start[i];
+    }
+
+    for (k = 0; k < count; k++) {
+        blocks(state, sha512_padded_block(p, len, prefix, k, buf), 1);
+    }
+
+    for (i = 0; i < 8; i++) {
+        STORE64H(state[i], out + (8 * i));
+    }
+}
+
+#if ED25519_SHA512_AVX2
+static int sha512_x4_enabled = 0;
+
+/* Lanes run in lockstep, one that is done repeats its last block until the longest one is. */
+static void sha512_x4_avx2(const uint64_t *const starts[4], uint64_t prefix, const sha512_parts *in, unsigned char out[4][64])
+{
+    uint64_t state[8][4];
+    unsigned char bufs[4][128];
+    const unsigned char *blocks[4];
+    size_t lens[4];
+    size_t counts[4];
+    size_t max = 0;
+    size_t k;
+    int i;
+    int j;
+
+    for (j = 0; j < 4; j++) {
+        lens[j] = in[j].lens[0] + in[j].lens[1] + in[j].lens[2];
+        counts[j] = (lens[j] + 17 + 127) / 128;
+        max = MAX(max, counts[j]);
+        for (i = 0; i < 8; i++) {
+            state[i][j] = starts[j][i];
+        }
+    }
+
+    for (k = 0; k < max; k++) {
+        for (j = 0; j < 4; j++) {
+            blocks[j] = sha512_padded_block(&in[j], lens[j], prefix, MIN(k, counts[j] - 1), bufs[j]);
+        }
+
+        ed_sha512_x4_block_avx2(state, blocks);
+
+        for (j = 0; j < 4; j++) {
+            if (k == counts[j] - 1) {
+                for (i = 0; i < 8; i++) {
+                    STORE64H(state[i][j], out[j] + (8 * i));
+                }
+            }
+        }
+    }
+}
+#endif
+
+void ed_sha512_x4_from(const uint64_t *const states[4], uint64_t prefix_len, const sha512_parts *in, unsigned char out[4][64])
+{
+    int i;
+
+#if ED25519_SHA512_AVX2
+    if (sha512_x4_enabled) {
+        sha512_x4_avx2(states, prefix_len, in, out);
+        return;
+    }
+#endif
+
+    for (i = 0; i < 4; i++) {
+        sha512_parts_with(sha512_blocks, states[i], prefix_len, &in[i], out[i]);
+    }
+}
+
+void ed_sha512_x4(const sha512_parts *in, unsigned char out[4][64])
+{
+    const uint64_t *const states[4] = { sha512_iv, sha512_iv, sha512_iv, sha512_iv };
+
+    ed_sha512_x4_from(states, 0, in, out);
+}
+
+
+
+/*
+   The rest of the PBKDF2-HMAC-SHA512 rounds of one 64 byte block. Each round hashes a single padded
+   block after the inner and after the outer key state, only its first 64 bytes change.
+*/
+#define PBKDF2_PAD(block) \
+    memset((block) + 64, 0, 64); \
+    (block)[64] = 0x80; \
+    STORE64H((uint64_t)(128 + 64) * 8, (block) + 120)
+
+void ed_sha512_pbkdf2(const uint64_t *inner, const uint64_t *outer, unsigned char t[64], uint32_t iterations)
+{
+    unsigned char block[128];
+    uint64_t state[8];
+    uint64_t acc[8];
+    uint32_t r;
+    int i;
+
+    PBKDF2_PAD(block);
+    memcpy(block, t, 64);
+    for (i = 0; i < 8; i++) {
+        LOAD64H(acc[i], t + (8 * i));
+    }
+
+    for (r = 1; r < iterations; r++) {
+        memcpy(state, inner, sizeof(state));
+        sha512_blocks(state, block, 1);
+        for (i = 0; i < 8; i++) {
+            STORE64H(state[i], block + (8 * i));
+        }
+
+        memcpy(state, outer, sizeof(state));
+        sha512_blocks(state, block, 1);
+        for (i = 0; i < 8; i++) {
+            STORE64H(state[i], block + (8 * i));
+            acc[i] ^= state[i];
+        }
+    }
+
+    for (i = 0; i < 8; i++) {
+        STORE64H(acc[i], t + (8 * i));
+    }
+}
+
+void ed_sha512_pbkdf2_x4(const uint64_t *const inner[4], const uint64_t *const outer[4], unsigned char t[4][64], uint32_t iterations)
+{
+#if ED25519_SHA512_AVX2
+    unsigned char blocks[4][128];
+    const unsigned char *const lanes[4] = { blocks[0], blocks[1], blocks[2], blocks[3] };
+    uint64_t state[8][4];
+    uint64_t acc[8][4];
+    uint32_t r;
+    int i;
+    int j;
+
+    if (sha512_x4_enabled) {
+        for (j = 0; j < 4; j++) {
+            PBKDF2_PAD(blocks[j]);
+            memcpy(blocks[j], t[j], 64);
+            for (i = 0; i < 8; i++) {
+                LOAD64H(acc[i][j], t[j] + (8 * i));
+            }
+        }
+
+        for (r = 1; r < iterations; r++) {
+            for (i = 0; i < 8; i++) {
+                for (j = 0; j < 4; j++) {
+                    state[i][j] = inner[j][i];
+                }
+            }
+            ed_sha512_x4_block_avx2(state, lanes);
+            for (j = 0; j < 4; j++) {
+                for (i = 0; i < 8; i++) {
+                    STORE64H(state[i][j], blocks[j] + (8 * i));
+                }
+            }
+
+            for (i = 0; i < 8; i++) {
+                for (j = 0; j < 4; j++) {
+                    state[i][j] = outer[j][i];
+                }
+            }
+            ed_sha512_x4_block_avx2(state, lanes);
+            for (j = 0; j < 4; j++) {
+                for (i = 0; i < 8; i++) {
+                    STORE64H(state[i][j], blocks[j] + (8 * i));
+                    acc[i][j] ^= state[i][j];
+                }
+            }
+        }
+
+        for (j = 0; j < 4; j++) {
+            for (i = 0; i < 8; i++) {
+                STORE64H(acc[i][j], t[j] + (8 * i));
+            }
+        }
+        return;
+    }
+#endif
+
+    {
+        int k;
+
+        for (k = 0; k < 4; k++) {
+            ed_sha512_pbkdf2(inner[k], outer[k], t[k], iterations);
+        }
+    }
+}
+
+#undef PBKDF2_PAD
+
+
+
+/* Known answers from FIPS 180-2, the million 'a' one only in the full test. */
+static const char *const sha512_kat_messages[4] = {
+    "abc",
+    "",
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+    "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu"
+};
+
+static const unsigned char sha512_kat_digests[5][64] = {
+    {
+        0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba, 0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31,
+        0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2, 0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a,
+        0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8, 0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+        0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e, 0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f
+    },
+    {
+        0xcf, 0x83, 0xe1, 0x35, 0x7e, 0xef, 0xb8, 0xbd, 0xf1, 0x54, 0x28, 0x50, 0xd6, 0x6d, 0x80, 0x07,
+        0xd6, 0x20, 0xe4, 0x05, 0x0b, 0x57, 0x15, 0xdc, 0x83, 0xf4, 0xa9, 0x21, 0xd3, 0x6c, 0xe9, 0xce,
+        0x47, 0xd0, 0xd1, 0x3c, 0x5d, 0x85, 0xf2, 0xb0, 0xff, 0x83, 0x18, 0xd2, 0x87, 0x7e, 0xec, 0x2f,
+        0x63, 0xb9, 0x31, 0xbd, 0x47, 0x41, 0x7a, 0x81, 0xa5, 0x38, 0x32, 0x7a, 0xf9, 0x27, 0xda, 0x3e
+    },
+    {
+        0x20, 0x4a, 0x8f, 0xc6, 0xdd, 0xa8, 0x2f, 0x0a, 0x0c, 0xed, 0x7b, 0xeb, 0x8e, 0x08, 0xa4, 0x16,
+        0x57, 0xc1, 0x6e, 0xf4, 0x68, 0xb2, 0x28, 0xa8, 0x27, 0x9b, 0xe3, 0x31, 0xa7, 0x03, 0xc3, 0x35,
+        0x96, 0xfd, 0x15, 0xc1, 0x3b, 0x1b, 0x07, 0xf9, 0xaa, 0x1d, 0x3b, 0xea, 0x57, 0x78, 0x9c, 0xa0,
+        0x31, 0xad, 0x85, 0xc7, 0xa7, 0x1d, 0xd7, 0x03, 0x54, 0xec, 0x63, 0x12, 0x38, 0xca, 0x34, 0x45
+    },
+    {
+        0x8e, 0x95, 0x9b, 0x75, 0xda, 0xe3, 0x13, 0xda, 0x8c, 0xf4, 0xf7, 0x28, 0x14, 0xfc, 0x14, 0x3f,
+        0x8f, 0x77, 0x79, 0xc6, 0xeb, 0x9f, 0x7f, 0xa1, 0x72, 0x99, 0xae, 0xad, 0xb6, 0x88, 0x90, 0x18,
+        0x50, 0x1d, 0x28, 0x9e, 0x49, 0x00, 0xf7, 0xe4, 0x33, 0x1b, 0x99, 0xde, 0xc4, 0xb5, 0x43, 0x3a,
+        0xc7, 0xd3, 0x29, 0xee, 0xb6, 0xdd, 0x26, 0x54, 0x5e, 0x96, 0xe5, 0x5b, 0x87, 0x4b, 0xe9, 0x09
+    },
+    {
+        0xe7, 0x18, 0x48, 0x3d, 0x0c, 0xe7, 0x69, 0x64, 0x4e, 0x2e, 0x42, 0xc7, 0xbc, 0x15, 0xb4, 0x63,
+        0x8e, 0x1f, 0x98, 0xb1, 0x3b, 0x20, 0x44, 0x28, 0x56, 0x32, 0xa8, 0x03, 0xaf, 0xa9, 0x73, 0xeb,
+        0xde, 0x0f, 0xf2, 0x44, 0x87, 0x7e, 0xa6, 0x0a, 0x4c, 0xb0, 0x43, 0x2c, 0xe5, 0x77, 0xc3, 0x1b,
+        0xeb, 0x00, 0x9c, 0x5c, 0x2c, 0x49, 0xaa, 0x2e, 0x4e, 0xad, 0xb2, 0x17, 0xad, 0x8c, 0xc0, 0x9b
+    }
+};
+
+/*
+   The short messages split into parts at every offset they have, so blocks are taken both from
+   within a part and assembled across them.
+*/
+static void sha512_kat_parts(sha512_parts *p, int message, int split)
+{
+    const unsigned char *m = (const unsigned char *)sha512_kat_messages[message];
+    size_t len = strlen(sha512_kat_messages[message]);
+    size_t a = MIN((size_t)split, len);
+    size_t b = MIN((size_t)split * 2, len);
+
+    p->parts[0] = m;
+    p->lens[0] = a;
+    p->parts[1] = m + a;
+    p->lens[1] = b - a;
+    p->parts[2] = m + b;
+    p->lens[2] = len - b;
+}
+
+static int sha512_known_answers(void (*blocks)(uint64_t state[8], const unsigned char *in, size_t blocks), int x4, int full)
+{
+    sha512_parts p[4];
+    unsigned char out[4][64];
+    int split;
+    int i;
+
+    for (split = 0; split <= 112; split++) {
+        for (i = 0; i < 4; i++) {
+            sha512_kat_parts(&p[i], i, split);
+        }
+
+#if ED25519_SHA512_AVX2
+        if (x4) {
+            const uint64_t *const states[4] = { sha512_iv, sha512_iv, sha512_iv, sha512_iv };
+            sha512_x4_avx2(states, 0, p, out);
+        } else
+#endif
+        {
+            (void)x4;
+            for (i = 0; i < 4; i++) {
+                sha512_parts_with(blocks, sha512_iv, 0, &p[i], out[i]);
+            }
+        }
+
+        for (i = 0; i < 4; i++) {
+            if (memcmp(out[i], sha512_kat_digests[i], 64) != 0) {
+                return 0;
+            }
+        }
+    }
+
+    if (full) {
+        unsigned char buf[128];
+        sha512_context md;
+
+        /* 7812 blocks of 'a', then the last 64 with the padding */
+        memset(buf, 'a', sizeof(buf));
+        ed_sha512_init(&md);
+        for (i = 0; i < 7812; i++) {
+            blocks(md.state, buf, 1);
+        }
+
+        memset(buf + 64, 0, 64);
+        buf[64] = 0x80;
+        STORE64H(UINT64_C(8000000), buf + 120);
+        blocks(md.state, buf, 1);
+
+        for (i = 0; i < 8; i++) {
+            STORE64H(md.state[i], out[0] + (8 * i));
+        }
+
+        if (memcmp(out[0], sha512_kat_digests[4], 64) != 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+
+
+/**
+   Switch to the ARMv8.2 SHA512 instructions
+   @param enabled  Non zero once the CPU is known to have them
+   @return 1 if they are now used, 0 if not built in or failing the known answer tests
+*/
+int ed_sha512_enable_ext(int enabled)
+{
+    sha512_blocks = sha512_blocks_portable;
+
+#if ED25519_SHA512_ARM
+    if (enabled && sha512_known_answers(ed_sha512_blocks_arm, 0, 0)) {
+        sha512_blocks = ed_sha512_blocks_arm;
+        return 1;
+    }
+#else
+    (void)enabled;
+#endif
+
+    return 0;
+}
+
+/**
+   Switch ed_sha512_x4 to hashing four messages at once with AVX2
+   @param enabled  Non zero once the CPU is known to have AVX2
+   @return 1 if it is now used, 0 if not built in or failing the known answer tests
+*/
+int ed_sha512_enable_x4(int enabled)
+{
+#if ED25519_SHA512_AVX2
+    sha512_x4_enabled = enabled && sha512_known_answers(NULL, 1, 0);
+    return sha512_x4_enabled;
+#else
+    (void)enabled;
+    return 0;
+#endif
+}
+
+int ed25519_enable_sha512_ext(int enabled)
+{
+    return ed_sha512_enable_ext(enabled);
+}
+
+int ed25519_sha512_self_test(void)
+{
+    int ok = sha512_known_answers(sha512_blocks_portable, 0, 1) && sha512_known_answers(sha512_blocks, 0, 1);
+
+#if ED25519_SHA512_AVX2
+    if (sha512_x4_enabled) {
+        ok = ok && sha512_known_answers(NULL, 1, 0);
+    }
+#endif
+
+    return ok;
+}
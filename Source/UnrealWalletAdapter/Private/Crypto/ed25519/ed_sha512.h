@@ -5,6 +5,10 @@
 
 #include "fixedint.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* state */
 typedef struct sha512_context_ {
     uint64_t  length, state[8];
@@ -18,4 +22,78 @@ int ed_sha512_final(sha512_context * md, unsigned char *out);
 int ed_sha512_update(sha512_context * md, const unsigned char *in, size_t inlen);
 int ed_sha512(const unsigned char *message, size_t message_len, unsigned char *out);
 
+
+/*
+    A message given as the concatenation of up to three parts, like R, A and
+    the message hashed by signing and verification.
+*/
+
+typedef struct {
+    const unsigned char *parts[3];
+    size_t lens[3];
+} sha512_parts;
+
+/* Hashes four independent messages, side by side when the AVX2 backend is on. */
+void ed_sha512_x4(const sha512_parts *in, unsigned char out[4][64]);
+
+/*
+    ed_sha512_x4 continuing from states[i] after prefix_len bytes, a multiple
+    of 128, were already compressed into it, like the padded keys of HMAC.
+*/
+void ed_sha512_x4_from(const uint64_t *const states[4], uint64_t prefix_len, const sha512_parts *in, unsigned char out[4][64]);
+
+/*
+    PBKDF2-HMAC-SHA512 rounds 2 to iterations of one output block, under
+    the HMAC key whose padded key states are inner and outer. t holds U_1 on
+    input and the output block on return. The x4 variant runs four blocks,
+    each under its own key, side by side when the AVX2 backend is on.
+*/
+void ed_sha512_pbkdf2(const uint64_t *inner, const uint64_t *outer, unsigned char t[64], uint32_t iterations);
+void ed_sha512_pbkdf2_x4(const uint64_t *const inner[4], const uint64_t *const outer[4], unsigned char t[4][64], uint32_t iterations);
+
+
+/*
+    Backends, selected at runtime by ed_sha512_enable_ext and
+    ed_sha512_enable_x4 once the CPU is known to support them. Each one has
+    to pass the known answer tests of ed25519_sha512_self_test before it is
+    used.
+
+    ED25519_SHA512_ARM builds the ARMv8.2 SHA512 instruction backend,
+    ED25519_SHA512_AVX2 the four message AVX2 one.
+*/
+
+#ifndef ED25519_SHA512_ARM
+    #if defined(__aarch64__) && (defined(__ARM_FEATURE_SHA512) || (defined(__clang__) && __clang_major__ >= 16) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 10))
+        #define ED25519_SHA512_ARM 1
+    #else
+        #define ED25519_SHA512_ARM 0
+    #endif
+#endif
+
+#ifndef ED25519_SHA512_AVX2
+    #if defined(__x86_64__) || defined(_M_X64)
+        #define ED25519_SHA512_AVX2 1
+    #else
+        #define ED25519_SHA512_AVX2 0
+    #endif
+#endif
+
+int ed_sha512_enable_ext(int enabled);
+int ed_sha512_enable_x4(int enabled);
+
+extern const uint64_t ed_sha512_K[80];
+
+#if ED25519_SHA512_ARM
+void ed_sha512_blocks_arm(uint64_t state[8], const unsigned char *in, size_t blocks);
+#endif
+
+#if ED25519_SHA512_AVX2
+/* state[i][j] is word i of the state of message j. */
+void ed_sha512_x4_block_avx2(uint64_t state[8][4], const unsigned char *const blocks[4]);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
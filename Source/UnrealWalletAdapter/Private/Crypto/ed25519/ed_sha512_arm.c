@@ -0,0 +1,72 @@
+#include "ed_sha512.h"
+
+#if ED25519_SHA512_ARM
+
+#include <arm_neon.h>
+
+/*
+    The SHA-512 compression function on the ARMv8.2 SHA512 instructions,
+    two rounds per SHA512H / SHA512H2 pair. The state is kept as the pairs
+    (a, b), (c, d), (e, f), (g, h), low lane first, the message schedule as
+    eight pairs of words, each updated in place by SHA512SU0 / SHA512SU1.
+*/
+
+#if defined(__ARM_FEATURE_SHA512)
+    #define SHA512_ARM
+#elif defined(__clang__)
+    #define SHA512_ARM __attribute__((target("sha3")))
+#else
+    #define SHA512_ARM __attribute__((target("+sha3")))
+#endif
+
+
+
+SHA512_ARM void ed_sha512_blocks_arm(uint64_t state[8], const unsigned char *in, size_t blocks) {
+    uint64x2_t ab = vld1q_u64(state + 0);
+    uint64x2_t cd = vld1q_u64(state + 2);
+    uint64x2_t ef = vld1q_u64(state + 4);
+    uint64x2_t gh = vld1q_u64(state + 6);
+
+    for (; blocks > 0; --blocks, in += 128) {
+        const uint64x2_t ab0 = ab;
+        const uint64x2_t cd0 = cd;
+        const uint64x2_t ef0 = ef;
+        const uint64x2_t gh0 = gh;
+        uint64x2_t w[8];
+        int k;
+
+        for (k = 0; k < 8; ++k) {
+            w[k] = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(in + 16 * k)));
+        }
+
+        /* Rounds 2k and 2k + 1, with words 2k + 16 and 2k + 17 of the schedule made in place of the ones just used. */
+        for (k = 0; k < 40; ++k) {
+            uint64x2_t kw = vaddq_u64(vld1q_u64(ed_sha512_K + 2 * k), w[k % 8]);
+            uint64x2_t t = vaddq_u64(gh, vextq_u64(kw, kw, 1));
+            uint64x2_t next;
+
+            t = vsha512hq_u64(t, vextq_u64(ef, gh, 1), vextq_u64(cd, ef, 1));
+            next = vsha512h2q_u64(t, cd, ab);
+            gh = ef;
+            ef = vaddq_u64(cd, t);
+            cd = ab;
+            ab = next;
+
+            if (k < 32) {
+                w[k % 8] = vsha512su1q_u64(vsha512su0q_u64(w[k % 8], w[(k + 1) % 8]), w[(k + 7) % 8], vextq_u64(w[(k + 4) % 8], w[(k + 5) % 8], 1));
+            }
+        }
+
+        ab = vaddq_u64(ab, ab0);
+        cd = vaddq_u64(cd, cd0);
+        ef = vaddq_u64(ef, ef0);
+        gh = vaddq_u64(gh, gh0);
+    }
+
+    vst1q_u64(state + 0, ab);
+    vst1q_u64(state + 2, cd);
+    vst1q_u64(state + 4, ef);
+    vst1q_u64(state + 6, gh);
+}
+
+#endif
@@ -0,0 +1,102 @@
+#include "ed_sha512.h"
+
+#if ED25519_SHA512_AVX2
+
+#include <immintrin.h>
+
+/*
+    The SHA-512 compression function on four independent messages, word i
+    of message j in lane j of a 256 bit vector. SHA-512 has no cross lane
+    operations, so every step is the scalar one done four times at once.
+*/
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SHA512_AVX2 __attribute__((target("avx2")))
+#else
+    #define SHA512_AVX2
+#endif
+
+#define ROTR(x, n) _mm256_or_si256(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - (n)))
+#define SHR(x, n) _mm256_srli_epi64(x, n)
+#define XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256(x, y), z)
+#define ADD(x, y) _mm256_add_epi64(x, y)
+
+#define Ch(x, y, z) _mm256_xor_si256(z, _mm256_and_si256(x, _mm256_xor_si256(y, z)))
+#define Maj(x, y, z) _mm256_or_si256(_mm256_and_si256(_mm256_or_si256(x, y), z), _mm256_and_si256(x, y))
+#define Sigma0(x) XOR3(ROTR(x, 28), ROTR(x, 34), ROTR(x, 39))
+#define Sigma1(x) XOR3(ROTR(x, 14), ROTR(x, 18), ROTR(x, 41))
+#define Gamma0(x) XOR3(ROTR(x, 1), ROTR(x, 8), SHR(x, 7))
+#define Gamma1(x) XOR3(ROTR(x, 19), ROTR(x, 61), SHR(x, 6))
+
+
+
+/* Words i to i + 3 of the four blocks, transposed to one vector per word and made big endian. */
+SHA512_AVX2 static void load_words(__m256i *w, const unsigned char *const blocks[4], int i) {
+    const __m256i bswap = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    __m256i a = _mm256_loadu_si256((const __m256i *) (blocks[0] + 8 * i));
+    __m256i b = _mm256_loadu_si256((const __m256i *) (blocks[1] + 8 * i));
+    __m256i c = _mm256_loadu_si256((const __m256i *) (blocks[2] + 8 * i));
+    __m256i d = _mm256_loadu_si256((const __m256i *) (blocks[3] + 8 * i));
+    __m256i ab_lo = _mm256_unpacklo_epi64(a, b);
+    __m256i ab_hi = _mm256_unpackhi_epi64(a, b);
+    __m256i cd_lo = _mm256_unpacklo_epi64(c, d);
+    __m256i cd_hi = _mm256_unpackhi_epi64(c, d);
+
+    w[0] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(ab_lo, cd_lo, 0x20), bswap);
+    w[1] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(ab_hi, cd_hi, 0x20), bswap);
+    w[2] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(ab_lo, cd_lo, 0x31), bswap);
+    w[3] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(ab_hi, cd_hi, 0x31), bswap);
+}
+
+
+
+SHA512_AVX2 void ed_sha512_x4_block_avx2(uint64_t state[8][4], const unsigned char *const blocks[4]) {
+    __m256i S[8];
+    __m256i W[16];
+    __m256i t0;
+    __m256i t1;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        S[i] = _mm256_loadu_si256((const __m256i *) state[i]);
+    }
+
+    for (i = 0; i < 16; i += 4) {
+        load_words(W + i, blocks, i);
+    }
+
+    /* W only keeps the last 16 words of the schedule, word i in W[i % 16]. */
+    #define W(i) W[(i) & 15]
+
+    #define RND(a, b, c, d, e, f, g, h, i) \
+        if ((i) >= 16) { \
+            W(i) = ADD(ADD(Gamma1(W((i) - 2)), W((i) - 7)), ADD(Gamma0(W((i) - 15)), W(i))); \
+        } \
+        t0 = ADD(ADD(ADD(h, Sigma1(e)), ADD(Ch(e, f, g), _mm256_set1_epi64x((long long) ed_sha512_K[i]))), W(i)); \
+        t1 = ADD(Sigma0(a), Maj(a, b, c)); \
+        d = ADD(d, t0); \
+        h = ADD(t0, t1);
+
+    for (i = 0; i < 80; i += 8) {
+        RND(S[0], S[1], S[2], S[3], S[4], S[5], S[6], S[7], i + 0);
+        RND(S[7], S[0], S[1], S[2], S[3], S[4], S[5], S[6], i + 1);
+        RND(S[6], S[7], S[0], S[1], S[2], S[3], S[4], S[5], i + 2);
+        RND(S[5], S[6], S[7], S[0], S[1], S[2], S[3], S[4], i + 3);
+        RND(S[4], S[5], S[6], S[7], S[0], S[1], S[2], S[3], i + 4);
+        RND(S[3], S[4], S[5], S[6], S[7], S[0], S[1], S[2], i + 5);
+        RND(S[2], S[3], S[4], S[5], S[6], S[7], S[0], S[1], i + 6);
+        RND(S[1], S[2], S[3], S[4], S[5], S[6], S[7], S[0], i + 7);
+    }
+
+    #undef RND
+    #undef W
+
+    for (i = 0; i < 8; ++i) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) state[i]);
+        _mm256_storeu_si256((__m256i *) state[i], ADD(v, S[i]));
+    }
+}
+
+#endif
@@ -1,6 +1,28 @@
 #include "fixedint.h"
 #include "fe.h"
 
+#if ED25519_FE64
+    #define fe fe_ref
+    #define fe_0 fe_0_ref
+    #define fe_1 fe_1_ref
+    #define fe_add fe_add_ref
+    #define fe_cmov fe_cmov_ref
+    #define fe_cswap fe_cswap_ref
+    #define fe_copy fe_copy_ref
+    #define fe_frombytes fe_frombytes_ref
+    #define fe_invert fe_invert_ref
+    #define fe_isnegative fe_isnegative_ref
+    #define fe_isnonzero fe_isnonzero_ref
+    #define fe_mul fe_mul_ref
+    #define fe_mul121666 fe_mul121666_ref
+    #define fe_neg fe_neg_ref
+    #define fe_pow22523 fe_pow22523_ref
+    #define fe_sq fe_sq_ref
+    #define fe_sq2 fe_sq2_ref
+    #define fe_sub fe_sub_ref
+    #define fe_tobytes fe_tobytes_ref
+#endif
+
 
 /*
     helper functions
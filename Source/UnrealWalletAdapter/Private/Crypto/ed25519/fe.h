@@ -4,17 +4,48 @@
 #include "fixedint.h"
 
 
+/*
+    ED25519_FE64 selects the radix 2^51 backend in fe64.c, used wherever the
+    compiler gives a 64x64->128 bit multiply. Define it to 0 to force the
+    portable radix 2^25.5 code in fe.c.
+*/
+
+#ifndef ED25519_FE64
+    #if defined(__SIZEOF_INT128__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64)))
+        #define ED25519_FE64 1
+    #else
+        #define ED25519_FE64 0
+    #endif
+#endif
+
+
 /*
     fe means field element.
     Here the field is \Z/(2^255-19).
+*/
+
+#if ED25519_FE64
+
+/*
+    An element t, entries t[0]...t[4], represents the integer
+    t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4].
+    Every fe_* output has t[i] < 2^52.
+*/
+
+typedef uint64_t fe[5];
+
+#else
+
+/*
     An element t, entries t[0]...t[9], represents the integer
     t[0]+2^26 t[1]+2^51 t[2]+2^77 t[3]+2^102 t[4]+...+2^230 t[9].
     Bounds on each t[i] vary depending on context.
 */
 
-
 typedef int32_t fe[10];
 
+#endif
+
 
 void fe_0(fe h);
 void fe_1(fe h);
@@ -38,4 +69,26 @@ void fe_mul121666(fe h, fe f);
 void fe_pow22523(fe out, const fe z);
 void fe_sub(fe h, const fe f, const fe g);
 
+
+#if ED25519_FE64
+
+/*
+    The radix 2^25.5 code of fe.c, built under these names next to fe64.c for
+    ed25519_fe_self_test to compare with.
+*/
+
+typedef int32_t fe_ref[10];
+
+void fe_frombytes_ref(fe_ref h, const unsigned char *s);
+void fe_tobytes_ref(unsigned char *s, const fe_ref h);
+int fe_isnegative_ref(const fe_ref f);
+void fe_add_ref(fe_ref h, const fe_ref f, const fe_ref g);
+void fe_sub_ref(fe_ref h, const fe_ref f, const fe_ref g);
+void fe_mul_ref(fe_ref h, const fe_ref f, const fe_ref g);
+void fe_sq_ref(fe_ref h, const fe_ref f);
+void fe_invert_ref(fe_ref out, const fe_ref z);
+void fe_pow22523_ref(fe_ref out, const fe_ref z);
+
+#endif
+
 #endif
@@ -0,0 +1,700 @@
+#include "fixedint.h"
+#include "ed25519.h"
+#include "fe.h"
+
+#if ED25519_FE64
+
+/*
+    Field arithmetic on five 51 bit limbs, the 64 bit counterpart of fe.c.
+
+    Limbs are unsigned and kept below 2^52 between operations, so the sums of
+    products in fe_mul and fe_sq stay below 2^113 and every addition or
+    subtraction can be fed straight back into a multiplication.
+*/
+
+#define FE_MASK51 ((((uint64_t) 1) << 51) - 1)
+
+
+/*
+    64x64->128 bit multiply and the few operations done on the result.
+*/
+
+#if defined(__SIZEOF_INT128__)
+
+typedef unsigned __int128 fe_uint128;
+
+#define FE_MUL(a, b) ((fe_uint128) (a) * (b))
+#define FE_ADD(x, y) ((x) + (y))
+#define FE_ADD64(x, y) ((x) + (y))
+#define FE_SHL1(x) ((x) << 1)
+#define FE_LO51(x) ((uint64_t) (x) & FE_MASK51)
+#define FE_SHR51(x) ((uint64_t) ((x) >> 51))
+
+#else
+
+#include <intrin.h>
+
+typedef struct {
+    uint64_t lo;
+    uint64_t hi;
+} fe_uint128;
+
+static fe_uint128 fe_mul_wide(uint64_t a, uint64_t b) {
+    fe_uint128 r;
+
+#if defined(_M_ARM64)
+    r.lo = a * b;
+    r.hi = __umulh(a, b);
+#else
+    r.lo = _umul128(a, b, &r.hi);
+#endif
+
+    return r;
+}
+
+static fe_uint128 fe_add_wide(fe_uint128 x, fe_uint128 y) {
+    fe_uint128 r;
+
+    r.lo = x.lo + y.lo;
+    r.hi = x.hi + y.hi + (r.lo < x.lo);
+
+    return r;
+}
+
+static fe_uint128 fe_add64_wide(fe_uint128 x, uint64_t y) {
+    fe_uint128 r;
+
+    r.lo = x.lo + y;
+    r.hi = x.hi + (r.lo < x.lo);
+
+    return r;
+}
+
+static fe_uint128 fe_shl1_wide(fe_uint128 x) {
+    fe_uint128 r;
+
+    r.lo = x.lo << 1;
+    r.hi = (x.hi << 1) | (x.lo >> 63);
+
+    return r;
+}
+
+#define FE_MUL(a, b) fe_mul_wide((a), (b))
+#define FE_ADD(x, y) fe_add_wide((x), (y))
+#define FE_ADD64(x, y) fe_add64_wide((x), (y))
+#define FE_SHL1(x) fe_shl1_wide(x)
+#define FE_LO51(x) ((x).lo & FE_MASK51)
+#define FE_SHR51(x) (((x).lo >> 51) | ((x).hi << 13))
+
+#endif
+
+
+/*
+    helper functions
+*/
+static uint64_t load_8(const unsigned char *in) {
+    uint64_t result;
+
+    result = (uint64_t) in[0];
+    result |= ((uint64_t) in[1]) << 8;
+    result |= ((uint64_t) in[2]) << 16;
+    result |= ((uint64_t) in[3]) << 24;
+    result |= ((uint64_t) in[4]) << 32;
+    result |= ((uint64_t) in[5]) << 40;
+    result |= ((uint64_t) in[6]) << 48;
+    result |= ((uint64_t) in[7]) << 56;
+
+    return result;
+}
+
+static void store_8(unsigned char *out, uint64_t in) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        out[i] = (unsigned char) (in >> (8 * i));
+    }
+}
+
+
+
+/*
+    h = f, with every limb carried below 2^51 except for up to 19 * 2^13 left
+    in h[0] by the wraparound of the top carry.
+*/
+
+static void fe_carry(fe h, uint64_t f0, uint64_t f1, uint64_t f2, uint64_t f3, uint64_t f4) {
+    f1 += f0 >> 51;
+    f0 &= FE_MASK51;
+    f2 += f1 >> 51;
+    f1 &= FE_MASK51;
+    f3 += f2 >> 51;
+    f2 &= FE_MASK51;
+    f4 += f3 >> 51;
+    f3 &= FE_MASK51;
+    f0 += (f4 >> 51) * 19;
+    f4 &= FE_MASK51;
+
+    h[0] = f0;
+    h[1] = f1;
+    h[2] = f2;
+    h[3] = f3;
+    h[4] = f4;
+}
+
+
+
+/*
+    Same as fe_carry for the 128 bit accumulators of fe_mul and fe_sq.
+    r4 never holds a multiple of 19 so its carry still fits 64 bits once
+    multiplied by 19.
+*/
+
+static void fe_carry_wide(fe h, fe_uint128 r0, fe_uint128 r1, fe_uint128 r2, fe_uint128 r3, fe_uint128 r4) {
+    uint64_t h0;
+    uint64_t h1;
+    uint64_t h2;
+    uint64_t h3;
+    uint64_t h4;
+
+    r1 = FE_ADD64(r1, FE_SHR51(r0));
+    h0 = FE_LO51(r0);
+    r2 = FE_ADD64(r2, FE_SHR51(r1));
+    h1 = FE_LO51(r1);
+    r3 = FE_ADD64(r3, FE_SHR51(r2));
+    h2 = FE_LO51(r2);
+    r4 = FE_ADD64(r4, FE_SHR51(r3));
+    h3 = FE_LO51(r3);
+    h0 += FE_SHR51(r4) * 19;
+    h4 = FE_LO51(r4);
+    h1 += h0 >> 51;
+    h0 &= FE_MASK51;
+
+    h[0] = h0;
+    h[1] = h1;
+    h[2] = h2;
+    h[3] = h3;
+    h[4] = h4;
+}
+
+
+
+/*
+    h = 0
+*/
+
+void fe_0(fe h) {
+    h[0] = 0;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+
+
+/*
+    h = 1
+*/
+
+void fe_1(fe h) {
+    h[0] = 1;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+
+
+/*
+    h = f + g
+    Can overlap h with f or g.
+*/
+
+void fe_add(fe h, const fe f, const fe g) {
+    fe_carry(h, f[0] + g[0], f[1] + g[1], f[2] + g[2], f[3] + g[3], f[4] + g[4]);
+}
+
+
+
+/*
+    h = f - g
+    Can overlap h with f or g.
+
+    4p is added first so that no limb goes negative, which holds for any g
+    with limbs below 2^52.
+*/
+
+void fe_sub(fe h, const fe f, const fe g) {
+    fe_carry(h,
+        (f[0] + 0x1FFFFFFFFFFFB4ULL) - g[0],
+        (f[1] + 0x1FFFFFFFFFFFFCULL) - g[1],
+        (f[2] + 0x1FFFFFFFFFFFFCULL) - g[2],
+        (f[3] + 0x1FFFFFFFFFFFFCULL) - g[3],
+        (f[4] + 0x1FFFFFFFFFFFFCULL) - g[4]);
+}
+
+
+
+/*
+    h = -f
+*/
+
+void fe_neg(fe h, const fe f) {
+    fe_carry(h,
+        0x1FFFFFFFFFFFB4ULL - f[0],
+        0x1FFFFFFFFFFFFCULL - f[1],
+        0x1FFFFFFFFFFFFCULL - f[2],
+        0x1FFFFFFFFFFFFCULL - f[3],
+        0x1FFFFFFFFFFFFCULL - f[4]);
+}
+
+
+
+/*
+    h = f
+*/
+
+void fe_copy(fe h, const fe f) {
+    h[0] = f[0];
+    h[1] = f[1];
+    h[2] = f[2];
+    h[3] = f[3];
+    h[4] = f[4];
+}
+
+
+
+/*
+    Replace (f,g) with (g,g) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+
+void fe_cmov(fe f, const fe g, unsigned int b) {
+    const uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+
+    f[0] ^= (f[0] ^ g[0]) & mask;
+    f[1] ^= (f[1] ^ g[1]) & mask;
+    f[2] ^= (f[2] ^ g[2]) & mask;
+    f[3] ^= (f[3] ^ g[3]) & mask;
+    f[4] ^= (f[4] ^ g[4]) & mask;
+}
+
+
+
+/*
+    Replace (f,g) with (g,f) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+
+void fe_cswap(fe f, fe g, unsigned int b) {
+    const uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+    uint64_t x;
+    int i;
+
+    for (i = 0; i < 5; ++i) {
+        x = (f[i] ^ g[i]) & mask;
+        f[i] ^= x;
+        g[i] ^= x;
+    }
+}
+
+
+
+/*
+    Ignores top bit of h.
+*/
+
+void fe_frombytes(fe h, const unsigned char *s) {
+    h[0] = load_8(s) & FE_MASK51;
+    h[1] = (load_8(s + 6) >> 3) & FE_MASK51;
+    h[2] = (load_8(s + 12) >> 6) & FE_MASK51;
+    h[3] = (load_8(s + 19) >> 1) & FE_MASK51;
+    h[4] = (load_8(s + 24) >> 12) & FE_MASK51;
+}
+
+
+
+/*
+    Writes the unique representative of h in [0, p).
+
+    After carrying, h is below 2^255 and h + 19 overflows 2^255 exactly when
+    h >= p. Adding 19, carrying, then adding 2^255 - 19 and dropping bit 255
+    leaves h - p in that case and h otherwise.
+*/
+
+void fe_tobytes(unsigned char *s, const fe h) {
+    fe t;
+
+    fe_carry(t, h[0], h[1], h[2], h[3], h[4]);
+    fe_carry(t, t[0], t[1], t[2], t[3], t[4]);
+    fe_carry(t, t[0] + 19, t[1], t[2], t[3], t[4]);
+
+    t[0] += FE_MASK51 + 1 - 19;
+    t[1] += FE_MASK51;
+    t[2] += FE_MASK51;
+    t[3] += FE_MASK51;
+    t[4] += FE_MASK51;
+
+    t[1] += t[0] >> 51;
+    t[0] &= FE_MASK51;
+    t[2] += t[1] >> 51;
+    t[1] &= FE_MASK51;
+    t[3] += t[2] >> 51;
+    t[2] &= FE_MASK51;
+    t[4] += t[3] >> 51;
+    t[3] &= FE_MASK51;
+    t[4] &= FE_MASK51;
+
+    store_8(s, t[0] | (t[1] << 51));
+    store_8(s + 8, (t[1] >> 13) | (t[2] << 38));
+    store_8(s + 16, (t[2] >> 26) | (t[3] << 25));
+    store_8(s + 24, (t[3] >> 39) | (t[4] << 12));
+}
+
+
+
+/*
+    return 1 if f is in {1,3,5,...,q-2}
+    return 0 if f is in {0,2,4,...,q-1}
+*/
+
+int fe_isnegative(const fe f) {
+    unsigned char s[32];
+
+    fe_tobytes(s, f);
+
+    return s[0] & 1;
+}
+
+
+
+/*
+    return 1 if f == 0
+    return 0 if f != 0
+*/
+
+int fe_isnonzero(const fe f) {
+    unsigned char s[32];
+    unsigned char r = 0;
+    int i;
+
+    fe_tobytes(s, f);
+
+    for (i = 0; i < 32; ++i) {
+        r |= s[i];
+    }
+
+    return r != 0;
+}
+
+
+
+/*
+    h = f * g
+    Can overlap h with f or g.
+
+    Schoolbook multiplication, the limbs of g wrapping past 2^255 are
+    premultiplied by 19.
+*/
+
+void fe_mul(fe h, const fe f, const fe g) {
+    const uint64_t f0 = f[0];
+    const uint64_t f1 = f[1];
+    const uint64_t f2 = f[2];
+    const uint64_t f3 = f[3];
+    const uint64_t f4 = f[4];
+    const uint64_t g0 = g[0];
+    const uint64_t g1 = g[1];
+    const uint64_t g2 = g[2];
+    const uint64_t g3 = g[3];
+    const uint64_t g4 = g[4];
+    const uint64_t g1_19 = 19 * g1;
+    const uint64_t g2_19 = 19 * g2;
+    const uint64_t g3_19 = 19 * g3;
+    const uint64_t g4_19 = 19 * g4;
+    fe_uint128 r0;
+    fe_uint128 r1;
+    fe_uint128 r2;
+    fe_uint128 r3;
+    fe_uint128 r4;
+
+    r0 = FE_ADD(FE_ADD(FE_ADD(FE_ADD(FE_MUL(f0, g0), FE_MUL(f1, g4_19)), FE_MUL(f2, g3_19)), FE_MUL(f3, g2_19)), FE_MUL(f4, g1_19));
+    r1 = FE_ADD(FE_ADD(FE_ADD(FE_ADD(FE_MUL(f0, g1), FE_MUL(f1, g0)), FE_MUL(f2, g4_19)), FE_MUL(f3, g3_19)), FE_MUL(f4, g2_19));
+    r2 = FE_ADD(FE_ADD(FE_ADD(FE_ADD(FE_MUL(f0, g2), FE_MUL(f1, g1)), FE_MUL(f2, g0)), FE_MUL(f3, g4_19)), FE_MUL(f4, g3_19));
+    r3 = FE_ADD(FE_ADD(FE_ADD(FE_ADD(FE_MUL(f0, g3), FE_MUL(f1, g2)), FE_MUL(f2, g1)), FE_MUL(f3, g0)), FE_MUL(f4, g4_19));
+    r4 = FE_ADD(FE_ADD(FE_ADD(FE_ADD(FE_MUL(f0, g4), FE_MUL(f1, g3)), FE_MUL(f2, g2)), FE_MUL(f3, g1)), FE_MUL(f4, g0));
+
+    fe_carry_wide(h, r0, r1, r2, r3, r4);
+}
+
+
+
+/*
+    Accumulators of f * f, shared by fe_sq and fe_sq2.
+*/
+
+#define FE_SQ_TERMS(f) \
+    const uint64_t f0 = f[0]; \
+    const uint64_t f1 = f[1]; \
+    const uint64_t f2 = f[2]; \
+    const uint64_t f3 = f[3]; \
+    const uint64_t f4 = f[4]; \
+    const uint64_t f0_2 = 2 * f0; \
+    const uint64_t f1_2 = 2 * f1; \
+    const uint64_t f3_19 = 19 * f3; \
+    const uint64_t f3_38 = 38 * f3; \
+    const uint64_t f4_19 = 19 * f4; \
+    const uint64_t f4_38 = 38 * f4; \
+    fe_uint128 r0 = FE_ADD(FE_ADD(FE_MUL(f0, f0), FE_MUL(f1, f4_38)), FE_MUL(f2, f3_38)); \
+    fe_uint128 r1 = FE_ADD(FE_ADD(FE_MUL(f0_2, f1), FE_MUL(f2, f4_38)), FE_MUL(f3, f3_19)); \
+    fe_uint128 r2 = FE_ADD(FE_ADD(FE_MUL(f0_2, f2), FE_MUL(f1, f1)), FE_MUL(f3, f4_38)); \
+    fe_uint128 r3 = FE_ADD(FE_ADD(FE_MUL(f0_2, f3), FE_MUL(f1_2, f2)), FE_MUL(f4, f4_19)); \
+    fe_uint128 r4 = FE_ADD(FE_ADD(FE_MUL(f0_2, f4), FE_MUL(f1_2, f3)), FE_MUL(f2, f2))
+
+
+
+/*
+    h = f * f
+    Can overlap h with f.
+*/
+
+void fe_sq(fe h, const fe f) {
+    FE_SQ_TERMS(f);
+
+    fe_carry_wide(h, r0, r1, r2, r3, r4);
+}
+
+
+
+/*
+    h = 2 * f * f
+    Can overlap h with f.
+*/
+
+void fe_sq2(fe h, const fe f) {
+    FE_SQ_TERMS(f);
+
+    fe_carry_wide(h, FE_SHL1(r0), FE_SHL1(r1), FE_SHL1(r2), FE_SHL1(r3), FE_SHL1(r4));
+}
+
+
+
+/*
+    h = f * 121666
+    Can overlap h with f.
+*/
+
+void fe_mul121666(fe h, fe f) {
+    fe_carry_wide(h,
+        FE_MUL(f[0], 121666),
+        FE_MUL(f[1], 121666),
+        FE_MUL(f[2], 121666),
+        FE_MUL(f[3], 121666),
+        FE_MUL(f[4], 121666));
+}
+
+
+
+/*
+    h = f^(2^n), n >= 1
+*/
+
+static void fe_sqn(fe h, const fe f, int n) {
+    int i;
+
+    fe_sq(h, f);
+
+    for (i = 1; i < n; ++i) {
+        fe_sq(h, h);
+    }
+}
+
+
+
+/*
+    out = z^(p-2), the same addition chain as fe.c.
+*/
+
+void fe_invert(fe out, const fe z) {
+    fe t0;
+    fe t1;
+    fe t2;
+    fe t3;
+
+    fe_sq(t0, z);
+    fe_sqn(t1, t0, 2);
+    fe_mul(t1, z, t1);
+    fe_mul(t0, t0, t1);
+    fe_sq(t2, t0);
+    fe_mul(t1, t1, t2);
+    fe_sqn(t2, t1, 5);
+    fe_mul(t1, t2, t1);
+    fe_sqn(t2, t1, 10);
+    fe_mul(t2, t2, t1);
+    fe_sqn(t3, t2, 20);
+    fe_mul(t2, t3, t2);
+    fe_sqn(t2, t2, 10);
+    fe_mul(t1, t2, t1);
+    fe_sqn(t2, t1, 50);
+    fe_mul(t2, t2, t1);
+    fe_sqn(t3, t2, 100);
+    fe_mul(t2, t3, t2);
+    fe_sqn(t2, t2, 50);
+    fe_mul(t1, t2, t1);
+    fe_sqn(t1, t1, 5);
+    fe_mul(out, t1, t0);
+}
+
+
+
+/*
+    out = z^((p-5)/8), the same addition chain as fe.c.
+*/
+
+void fe_pow22523(fe out, const fe z) {
+    fe t0;
+    fe t1;
+    fe t2;
+
+    fe_sq(t0, z);
+    fe_sqn(t1, t0, 2);
+    fe_mul(t1, z, t1);
+    fe_mul(t0, t0, t1);
+    fe_sq(t0, t0);
+    fe_mul(t0, t1, t0);
+    fe_sqn(t1, t0, 5);
+    fe_mul(t0, t1, t0);
+    fe_sqn(t1, t0, 10);
+    fe_mul(t1, t1, t0);
+    fe_sqn(t2, t1, 20);
+    fe_mul(t1, t2, t1);
+    fe_sqn(t1, t1, 10);
+    fe_mul(t0, t1, t0);
+    fe_sqn(t1, t0, 50);
+    fe_mul(t1, t1, t0);
+    fe_sqn(t2, t1, 100);
+    fe_mul(t1, t2, t1);
+    fe_sqn(t1, t1, 50);
+    fe_mul(t0, t1, t0);
+    fe_sqn(t0, t0, 2);
+    fe_mul(out, t0, z);
+}
+
+
+
+/*
+    Whether f and g, one from each backend, encode the same value.
+*/
+
+static int fe_matches(const fe f, const fe_ref g) {
+    unsigned char a[32];
+    unsigned char b[32];
+    int i;
+
+    fe_tobytes(a, f);
+    fe_tobytes_ref(b, g);
+
+    for (i = 0; i < 32; ++i) {
+        if (a[i] != b[i]) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+#endif
+
+
+
+/*
+    Checks the backend in use against the radix 2^25.5 code of fe.c on edge
+    encodings, canonical or not, and on a stream of pseudo-random inputs. With
+    only fe.c built there is nothing to compare.
+*/
+
+int ed25519_fe_self_test(void) {
+#if ED25519_FE64
+    /* first byte, the bytes between, last byte: 0, 1, p - 1, p, p + 1, 2^255 - 1, 2^256 - 1 and 2^255 */
+    static const unsigned char edges[8][3] = {
+        { 0x00, 0x00, 0x00 }, { 0x01, 0x00, 0x00 }, { 0xec, 0xff, 0x7f }, { 0xed, 0xff, 0x7f },
+        { 0xee, 0xff, 0x7f }, { 0xff, 0xff, 0x7f }, { 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x80 }
+    };
+    unsigned char in[2][32];
+    fe f[2];
+    fe_ref g[2];
+    fe h;
+    fe_ref k;
+    uint64_t state = 0x9e3779b97f4a7c15ULL;
+    int round;
+    int i;
+    int j;
+
+    /* the first 64 rounds pair up the edges */
+    for (round = 0; round < 64 + 1024; ++round) {
+        for (i = 0; i < 2; ++i) {
+            const unsigned char *edge = edges[i == 0 ? round / 8 % 8 : round % 8];
+
+            for (j = 0; j < 32; ++j) {
+                if (round < 64) {
+                    in[i][j] = j == 0 ? edge[0] : j == 31 ? edge[2] : edge[1];
+                } else {
+                    /* xorshift64 */
+                    state ^= state << 13;
+                    state ^= state >> 7;
+                    state ^= state << 17;
+                    in[i][j] = (unsigned char) state;
+                }
+            }
+
+            fe_frombytes(f[i], in[i]);
+            fe_frombytes_ref(g[i], in[i]);
+            if (!fe_matches(f[i], g[i]) || fe_isnegative(f[i]) != fe_isnegative_ref(g[i])) {
+                return 0;
+            }
+        }
+
+        fe_mul(h, f[0], f[1]);
+        fe_mul_ref(k, g[0], g[1]);
+        if (!fe_matches(h, k)) {
+            return 0;
+        }
+
+        fe_sq(h, h);
+        fe_sq_ref(k, k);
+        if (!fe_matches(h, k)) {
+            return 0;
+        }
+
+        fe_invert(h, f[0]);
+        fe_invert_ref(k, g[0]);
+        if (!fe_matches(h, k)) {
+            return 0;
+        }
+
+        fe_pow22523(h, f[1]);
+        fe_pow22523_ref(k, g[1]);
+        if (!fe_matches(h, k)) {
+            return 0;
+        }
+
+        /* a sum times a difference, the widest limbs a multiplication is given */
+        fe_add(h, f[0], f[1]);
+        fe_sub(f[1], f[0], f[1]);
+        fe_mul(h, h, f[1]);
+        fe_add_ref(k, g[0], g[1]);
+        fe_sub_ref(g[1], g[0], g[1]);
+        fe_mul_ref(k, k, g[1]);
+        if (!fe_matches(h, k)) {
+            return 0;
+        }
+    }
+#endif
+
+    return 1;
+}
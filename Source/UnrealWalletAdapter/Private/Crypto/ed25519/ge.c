@@ -1,5 +1,10 @@
 #include "ge.h"
+#include "ge_avx2.h"
+#if ED25519_FE64
+#include "precomp_data_51.h"
+#else
 #include "precomp_data.h"
+#endif
 
 
 /*
@@ -22,7 +27,11 @@ void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q) {
 }
 
 
-static void slide(signed char *r, const unsigned char *a) {
+/*
+Signed odd digits of a, at most bound in magnitude and spread out over the 256 positions.
+*/
+
+static void slide(signed char *r, const unsigned char *a, int bound) {
     int i;
     int b;
     int k;
@@ -35,10 +44,10 @@ static void slide(signed char *r, const unsigned char *a) {
         if (r[i]) {
             for (b = 1; b <= 6 && i + b < 256; ++b) {
                 if (r[i + b]) {
-                    if (r[i] + (r[i + b] << b) <= 15) {
+                    if (r[i] + (r[i + b] << b) <= bound) {
                         r[i] += r[i + b] << b;
                         r[i + b] = 0;
-                    } else if (r[i] - (r[i + b] << b) >= -15) {
+                    } else if (r[i] - (r[i + b] << b) >= -bound) {
                         r[i] -= r[i + b] << b;
 
                         for (k = i + b; k < 256; ++k) {
@@ -65,6 +74,14 @@ B is the Ed25519 base point (x,4/5) with x positive.
 */
 
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b) {
+#if ED25519_AVX2
+    ge_double_scalarmult_vartime_on(r, a, A, b, ge_avx2_enabled);
+#else
+    ge_double_scalarmult_vartime_on(r, a, A, b, 0);
+#endif
+}
+
+void ge_double_scalarmult_vartime_on(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b, int avx2) {
     signed char aslide[256];
     signed char bslide[256];
     ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
@@ -72,8 +89,8 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
     ge_p3 u;
     ge_p3 A2;
     int i;
-    slide(aslide, a);
-    slide(bslide, b);
+    slide(aslide, a, 15);
+    slide(bslide, b, 15);
     ge_p3_to_cached(&Ai[0], A);
     ge_p3_dbl(&t, A);
     ge_p1p1_to_p3(&A2, &t);
@@ -98,6 +115,16 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
     ge_add(&t, &A2, &Ai[6]);
     ge_p1p1_to_p3(&u, &t);
     ge_p3_to_cached(&Ai[7], &u);
+
+#if ED25519_AVX2
+    if (avx2) {
+        ge_double_scalarmult_vartime_avx2(r, aslide, Ai, bslide, Bi);
+        return;
+    }
+#else
+    (void) avx2;
+#endif
+
     ge_p2_0(r);
 
     for (i = 255; i >= 0; --i) {
@@ -130,6 +157,15 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
 }
 
 
+#if ED25519_FE64
+static const fe d = {
+    0x34dca135978a3ULL, 0x1a8283b156ebdULL, 0x5e7a26001c029ULL, 0x739c663a03cbbULL, 0x52036cee2b6ffULL
+};
+
+static const fe sqrtm1 = {
+    0x61b274a0ea0b0ULL, 0xd5a5fc8f189dULL, 0x7ef5e9cbd0c60ULL, 0x78595a6804c9eULL, 0x2b8324804fc1dULL
+};
+#else
 static const fe d = {
     -10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116
 };
@@ -137,6 +173,7 @@ static const fe d = {
 static const fe sqrtm1 = {
     -32595792, -7943725, 9377950, 3500415, 12389472, -272473, -25146209, -2005654, 326686, 11406482
 };
+#endif
 
 int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     fe u;
@@ -295,9 +332,15 @@ void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p) {
 r = p
 */
 
+#if ED25519_FE64
+static const fe d2 = {
+    0x69b9426b2f159ULL, 0x35050762add7aULL, 0x3cf44c0038052ULL, 0x6738cc7407977ULL, 0x2406d9dc56dffULL
+};
+#else
 static const fe d2 = {
     -21827239, -5839606, -30745221, 13898782, 229458, 15978800, -12551817, -6495438, 29715968, 9444199
 };
+#endif
 
 void ge_p3_to_cached(ge_cached *r, const ge_p3 *p) {
     fe_add(r->YplusX, p->Y, p->X);
@@ -330,6 +373,51 @@ void ge_p3_tobytes(unsigned char *s, const ge_p3 *h) {
 }
 
 
+/*
+ge_p3_tobytes of count points into 32 bytes each. The points of every
+GE_BATCH_TOBYTES share one inversion: the product of their Z is inverted
+and each 1/Z is peeled off it with two multiplications (Montgomery's trick).
+*/
+
+#define GE_BATCH_TOBYTES 64
+
+void ge_p3_batch_tobytes(unsigned char *s, const ge_p3 *h, size_t count) {
+    fe acc[GE_BATCH_TOBYTES];
+    fe recip;
+    fe z;
+    fe x;
+    fe y;
+    size_t done;
+    size_t n;
+    size_t i;
+
+    for (done = 0; done < count; done += n) {
+        n = count - done < GE_BATCH_TOBYTES ? count - done : GE_BATCH_TOBYTES;
+
+        /* acc[i] = Z_0 * ... * Z_i */
+        fe_copy(acc[0], h[done].Z);
+        for (i = 1; i < n; ++i) {
+            fe_mul(acc[i], acc[i - 1], h[done + i].Z);
+        }
+        fe_invert(recip, acc[n - 1]);
+
+        /* recip = 1 / (Z_0 * ... * Z_i) on entry to each step */
+        for (i = n - 1; i > 0; --i) {
+            fe_mul(z, recip, acc[i - 1]);
+            fe_mul(recip, recip, h[done + i].Z);
+            fe_mul(x, h[done + i].X, z);
+            fe_mul(y, h[done + i].Y, z);
+            fe_tobytes(s + 32 * (done + i), y);
+            s[32 * (done + i) + 31] ^= fe_isnegative(x) << 7;
+        }
+        fe_mul(x, h[done].X, recip);
+        fe_mul(y, h[done].Y, recip);
+        fe_tobytes(s + 32 * done, y);
+        s[32 * done + 31] ^= fe_isnegative(x) << 7;
+    }
+}
+
+
 static unsigned char equal(signed char b, signed char c) {
     unsigned char ub = b;
     unsigned char uc = c;
@@ -353,7 +441,7 @@ static void cmov(ge_precomp *t, const ge_precomp *u, unsigned char b) {
 }
 
 
-static void select(ge_precomp *t, int pos, signed char b) {
+void ge_select_base(ge_precomp *t, int pos, signed char b) {
     ge_precomp minust;
     unsigned char bnegative = negative(b);
     unsigned char babs = b - (((-bnegative) & b) << 1);
@@ -384,6 +472,18 @@ Preconditions:
 */
 
 void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
+    ge_scalarmult_base_with(h, a, ge_base_table_installed());
+}
+
+void ge_scalarmult_base_builtin(ge_p3 *h, const unsigned char *a) {
+#if ED25519_AVX2
+    ge_scalarmult_base_builtin_on(h, a, ge_avx2_enabled);
+#else
+    ge_scalarmult_base_builtin_on(h, a, 0);
+#endif
+}
+
+void ge_scalarmult_base_builtin_on(ge_p3 *h, const unsigned char *a, int avx2) {
     signed char e[64];
     signed char carry;
     ge_p1p1 r;
@@ -409,10 +509,20 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
 
     e[63] += carry;
     /* each e[i] is between -8 and 8 */
+
+#if ED25519_AVX2
+    if (avx2) {
+        ge_scalarmult_base_avx2(h, e);
+        return;
+    }
+#else
+    (void) avx2;
+#endif
+
     ge_p3_0(h);
 
     for (i = 1; i < 64; i += 2) {
-        select(&t, i / 2, e[i]);
+        ge_select_base(&t, i / 2, e[i]);
         ge_madd(&r, h, &t);
         ge_p1p1_to_p3(h, &r);
     }
@@ -427,7 +537,7 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     ge_p1p1_to_p3(h, &r);
 
     for (i = 0; i < 64; i += 2) {
-        select(&t, i / 2, e[i]);
+        ge_select_base(&t, i / 2, e[i]);
         ge_madd(&r, h, &t);
         ge_p1p1_to_p3(h, &r);
     }
@@ -465,3 +575,130 @@ void ge_tobytes(unsigned char *s, const ge_p2 *h) {
     fe_tobytes(s, y);
     s[31] ^= fe_isnegative(x) << 7;
 }
+
+
+
+/*
+r[i][j] = (2j+1)*2^(64i)*A, for ge_double_scalarmult_tables_vartime.
+*/
+
+void ge_precomp_tables(ge_precomp r[4][8], const ge_p3 *A) {
+    ge_p3 p[4][8];
+    fe zs[32];
+    fe inv;
+    fe x;
+    fe y;
+    ge_cached c;
+    ge_p1p1 t;
+    ge_p2 q;
+    ge_p3 A2;
+    ge_p3 u = *A;
+    int i;
+    int j;
+
+    for (i = 0; i < 4; ++i) {
+        p[i][0] = u;
+        ge_p3_dbl(&t, &u);
+        ge_p1p1_to_p3(&A2, &t);
+
+        for (j = 1; j < 8; ++j) {
+            ge_p3_to_cached(&c, &p[i][j - 1]);
+            ge_add(&t, &A2, &c);
+            ge_p1p1_to_p3(&p[i][j], &t);
+        }
+
+        if (i < 3) {
+            ge_p3_to_p2(&q, &u);
+
+            for (j = 1; j < 64; ++j) {
+                ge_p2_dbl(&t, &q);
+                ge_p1p1_to_p2(&q, &t);
+            }
+
+            ge_p2_dbl(&t, &q);
+            ge_p1p1_to_p3(&u, &t);
+        }
+    }
+
+    /* One inversion for all of them: zs[k] = Z_0*...*Z_k, walked back to each 1/Z_k. */
+    fe_copy(zs[0], p[0][0].Z);
+
+    for (i = 1; i < 32; ++i) {
+        fe_mul(zs[i], zs[i - 1], p[i / 8][i % 8].Z);
+    }
+
+    fe_invert(inv, zs[31]);
+
+    for (i = 31; i >= 0; --i) {
+        const ge_p3 *h = &p[i / 8][i % 8];
+        ge_precomp *s = &r[i / 8][i % 8];
+
+        if (i > 0) {
+            fe_mul(zs[i], inv, zs[i - 1]);
+            fe_mul(inv, inv, h->Z);
+        } else {
+            fe_copy(zs[0], inv);
+        }
+
+        fe_mul(x, h->X, zs[i]);
+        fe_mul(y, h->Y, zs[i]);
+        fe_add(s->yplusx, y, x);
+        fe_sub(s->yminusx, y, x);
+        fe_mul(s->xy2d, x, y);
+        fe_mul(s->xy2d, s->xy2d, d2);
+    }
+}
+
+
+
+/*
+r = a * A + b * B, as ge_double_scalarmult_vartime with the tables of A from ge_precomp_tables.
+Both scalars are split in four 64-bit parts sharing 64 doublings, B uses the wider base_wide.
+*/
+
+void ge_double_scalarmult_tables_vartime(ge_p2 *r, const unsigned char *a, const ge_precomp A[4][8], const unsigned char *b) {
+    signed char aslide[256];
+    signed char bslide[256];
+    ge_p1p1 t;
+    ge_p3 u;
+    int i;
+    int j;
+    slide(aslide, a, 15);
+    slide(bslide, b, 63);
+
+    ge_p2_0(r);
+
+    for (i = 63; i >= 0; --i) {
+        if (aslide[i] || aslide[i + 64] || aslide[i + 128] || aslide[i + 192] ||
+            bslide[i] || bslide[i + 64] || bslide[i + 128] || bslide[i + 192]) {
+            break;
+        }
+    }
+
+    for (; i >= 0; --i) {
+        ge_p2_dbl(&t, r);
+
+        for (j = 0; j < 4; ++j) {
+            int ai = aslide[64 * j + i];
+            int bi = bslide[64 * j + i];
+
+            if (ai > 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_madd(&t, &u, &A[j][ai / 2]);
+            } else if (ai < 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_msub(&t, &u, &A[j][(-ai) / 2]);
+            }
+
+            if (bi > 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_madd(&t, &u, &base_wide[j][bi / 2]);
+            } else if (bi < 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_msub(&t, &u, &base_wide[j][(-bi) / 2]);
+            }
+        }
+
+        ge_p1p1_to_p2(r, &t);
+    }
+}
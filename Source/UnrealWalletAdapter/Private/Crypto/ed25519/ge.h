@@ -1,6 +1,8 @@
 #ifndef GE_H
 #define GE_H
 
+#include <stddef.h>
+
 #include "fe.h"
 
 
@@ -52,15 +54,35 @@ typedef struct {
 } ge_cached;
 
 void ge_p3_tobytes(unsigned char *s, const ge_p3 *h);
+void ge_p3_batch_tobytes(unsigned char *s, const ge_p3 *h, size_t count);
 void ge_tobytes(unsigned char *s, const ge_p2 *h);
 int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s);
 
 void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b);
+void ge_precomp_tables(ge_precomp r[4][8], const ge_p3 *A);
+void ge_double_scalarmult_tables_vartime(ge_p2 *r, const unsigned char *a, const ge_precomp A[4][8], const unsigned char *b);
 void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_scalarmult_base(ge_p3 *h, const unsigned char *a);
+void ge_select_base(ge_precomp *t, int pos, signed char b);
+
+/*
+   ge_scalarmult_base over a table of ge_base_table.c, or over the built-in one for NULL. ge_scalarmult_base
+   uses the table ed25519_use_base_window installed.
+*/
+struct ed25519_base_table;
+const struct ed25519_base_table *ge_base_table_installed(void);
+void ge_scalarmult_base_with(ge_p3 *h, const unsigned char *a, const struct ed25519_base_table *table);
+void ge_scalarmult_base_builtin(ge_p3 *h, const unsigned char *a);
+
+/*
+   The same on the portable code, or on the AVX2 code for avx2 in a build that has it, whatever
+   ed25519_enable_avx2 chose. For benchmarks, which must not switch the backend under other threads.
+*/
+void ge_double_scalarmult_vartime_on(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b, int avx2);
+void ge_scalarmult_base_builtin_on(ge_p3 *h, const unsigned char *a, int avx2);
 
 void ge_p1p1_to_p2(ge_p2 *r, const ge_p1p1 *p);
 void ge_p1p1_to_p3(ge_p3 *r, const ge_p1p1 *p);
@@ -0,0 +1,772 @@
+#include "ed25519.h"
+#include "ed_sha512.h"
+#include "ge_avx2.h"
+
+#if ED25519_AVX2
+
+#include <immintrin.h>
+
+/*
+    Four way field arithmetic for the point operations of
+    ge_double_scalarmult_vartime and ge_scalarmult_base.
+
+    An fe4 holds four field elements in radix 2^25.5, limb i of each element
+    in one 64 bit lane of v[i]. Points in extended coordinates keep X, Y, Z, T
+    in the four lanes, so every multiplication in the parallel addition and
+    doubling formulas of Hisil, Wong, Carter and Dawson runs as a single fe4
+    multiplication.
+
+    Limbs are unsigned. Carried limbs are below 2^26 for even and about 2^25
+    for odd positions; fe4_mul and fe4_sq carry their output. Sums of a few
+    carried elements, with 2p added in place of a negation, are still fine as
+    their operands.
+*/
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define GE_AVX2 __attribute__((target("avx2")))
+#else
+    #define GE_AVX2
+#endif
+
+typedef struct {
+    __m256i v[10];
+} fe4;
+
+/* _mm256_blend_epi32 masks selecting whole lanes */
+#define LANE_A 0x03
+#define LANE_B 0x0C
+#define LANE_C 0x30
+#define LANE_D 0xC0
+
+/* (x[a], x[b], x[c], x[d]) */
+#define PERMUTE(x, a, b, c, d) _mm256_permute4x64_epi64(x, _MM_SHUFFLE(d, c, b, a))
+
+/* x, with the lanes in mask taken from y */
+#define BLEND(x, y, mask) _mm256_blend_epi32(x, y, mask)
+
+/* 2p, limb by limb. Subtracting a carried limb from it never goes negative. */
+static const uint64_t fe4_2p[10] = {
+    0x7FFFFDA, 0x3FFFFFE, 0x7FFFFFE, 0x3FFFFFE, 0x7FFFFFE,
+    0x3FFFFFE, 0x7FFFFFE, 0x3FFFFFE, 0x7FFFFFE, 0x3FFFFFE
+};
+
+#define NEG(x, i) _mm256_sub_epi64(_mm256_set1_epi64x((long long) fe4_2p[i]), x)
+
+int ge_avx2_enabled = 0;
+
+
+
+GE_AVX2 static void fe4_0(fe4 *h) {
+    int i;
+
+    for (i = 0; i < 10; ++i) {
+        h->v[i] = _mm256_setzero_si256();
+    }
+}
+
+
+
+/*
+    Carries in the same order as fe_mul in fe.c, two chains at a time.
+*/
+
+#define FE4_CARRY(h, i, bits) do { \
+    const __m256i c_ = _mm256_srli_epi64((h)->v[i], bits); \
+    (h)->v[i] = _mm256_and_si256((h)->v[i], _mm256_set1_epi64x((1 << (bits)) - 1)); \
+    (h)->v[(i) + 1] = _mm256_add_epi64((h)->v[(i) + 1], c_); \
+} while (0)
+
+GE_AVX2 static void fe4_carry(fe4 *h) {
+    __m256i c;
+
+    FE4_CARRY(h, 0, 26);
+    FE4_CARRY(h, 4, 26);
+    FE4_CARRY(h, 1, 25);
+    FE4_CARRY(h, 5, 25);
+    FE4_CARRY(h, 2, 26);
+    FE4_CARRY(h, 6, 26);
+    FE4_CARRY(h, 3, 25);
+    FE4_CARRY(h, 7, 25);
+    FE4_CARRY(h, 4, 26);
+    FE4_CARRY(h, 8, 26);
+
+    /* 2^255 = 19, c * 19 = c * 16 + c * 2 + c */
+    c = _mm256_srli_epi64(h->v[9], 25);
+    h->v[9] = _mm256_and_si256(h->v[9], _mm256_set1_epi64x((1 << 25) - 1));
+    h->v[0] = _mm256_add_epi64(h->v[0], c);
+    h->v[0] = _mm256_add_epi64(h->v[0], _mm256_slli_epi64(c, 1));
+    h->v[0] = _mm256_add_epi64(h->v[0], _mm256_slli_epi64(c, 4));
+
+    FE4_CARRY(h, 0, 26);
+}
+
+
+
+/*
+    h = f * g, lane by lane.
+    Same schoolbook product as fe_mul in fe.c on 32x32->64 bit multiplies,
+    accumulated a limb of f at a time so the ten sums stay in registers.
+*/
+
+GE_AVX2 static void fe4_mul(fe4 *h, const fe4 *f, const fe4 *g) {
+    const __m256i nineteen = _mm256_set1_epi64x(19);
+    __m256i g19[10];
+    __m256i fi;
+    __m256i fi_2;
+    __m256i h0;
+    __m256i h1;
+    __m256i h2;
+    __m256i h3;
+    __m256i h4;
+    __m256i h5;
+    __m256i h6;
+    __m256i h7;
+    __m256i h8;
+    __m256i h9;
+    int i;
+
+    for (i = 1; i < 10; ++i) {
+        g19[i] = _mm256_mul_epu32(g->v[i], nineteen);
+    }
+
+    fi = f->v[0];
+    h0 = _mm256_mul_epu32(fi, g->v[0]);
+    h1 = _mm256_mul_epu32(fi, g->v[1]);
+    h2 = _mm256_mul_epu32(fi, g->v[2]);
+    h3 = _mm256_mul_epu32(fi, g->v[3]);
+    h4 = _mm256_mul_epu32(fi, g->v[4]);
+
+    fi = f->v[1];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_2, g19[9]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g->v[0]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_2, g->v[1]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g->v[2]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_2, g->v[3]));
+
+    fi = f->v[2];
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi, g19[8]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g19[9]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi, g->v[0]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g->v[1]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi, g->v[2]));
+
+    fi = f->v[3];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_2, g19[7]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g19[8]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_2, g19[9]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g->v[0]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_2, g->v[1]));
+
+    fi = f->v[4];
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi, g19[6]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g19[7]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi, g19[8]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g19[9]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi, g->v[0]));
+
+    fi = f->v[5];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_2, g19[5]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g19[6]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_2, g19[7]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g19[8]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_2, g19[9]));
+
+    fi = f->v[6];
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi, g19[4]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g19[5]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi, g19[6]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g19[7]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi, g19[8]));
+
+    fi = f->v[7];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_2, g19[3]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g19[4]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_2, g19[5]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g19[6]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_2, g19[7]));
+
+    fi = f->v[8];
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi, g19[2]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g19[3]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi, g19[4]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g19[5]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi, g19[6]));
+
+    fi = f->v[9];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_2, g19[1]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi, g19[2]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_2, g19[3]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi, g19[4]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_2, g19[5]));
+
+    fi = f->v[0];
+    h5 = _mm256_mul_epu32(fi, g->v[5]);
+    h6 = _mm256_mul_epu32(fi, g->v[6]);
+    h7 = _mm256_mul_epu32(fi, g->v[7]);
+    h8 = _mm256_mul_epu32(fi, g->v[8]);
+    h9 = _mm256_mul_epu32(fi, g->v[9]);
+
+    fi = f->v[1];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g->v[4]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_2, g->v[5]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g->v[6]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_2, g->v[7]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[8]));
+
+    fi = f->v[2];
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g->v[3]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi, g->v[4]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g->v[5]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi, g->v[6]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[7]));
+
+    fi = f->v[3];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g->v[2]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_2, g->v[3]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g->v[4]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_2, g->v[5]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[6]));
+
+    fi = f->v[4];
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g->v[1]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi, g->v[2]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g->v[3]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi, g->v[4]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[5]));
+
+    fi = f->v[5];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g->v[0]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_2, g->v[1]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g->v[2]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_2, g->v[3]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[4]));
+
+    fi = f->v[6];
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g19[9]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi, g->v[0]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g->v[1]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi, g->v[2]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[3]));
+
+    fi = f->v[7];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g19[8]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_2, g19[9]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g->v[0]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_2, g->v[1]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[2]));
+
+    fi = f->v[8];
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g19[7]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi, g19[8]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g19[9]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi, g->v[0]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[1]));
+
+    fi = f->v[9];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi, g19[6]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_2, g19[7]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi, g19[8]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_2, g19[9]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi, g->v[0]));
+
+    h->v[0] = h0;
+    h->v[1] = h1;
+    h->v[2] = h2;
+    h->v[3] = h3;
+    h->v[4] = h4;
+    h->v[5] = h5;
+    h->v[6] = h6;
+    h->v[7] = h7;
+    h->v[8] = h8;
+    h->v[9] = h9;
+    fe4_carry(h);
+}
+
+
+
+/*
+    h = f * f, lane by lane.
+*/
+
+GE_AVX2 static void fe4_sq(fe4 *h, const fe4 *f) {
+    const __m256i nineteen = _mm256_set1_epi64x(19);
+    __m256i f19[10];
+    __m256i fi;
+    __m256i fi_2;
+    __m256i fi_4;
+    __m256i h0;
+    __m256i h1;
+    __m256i h2;
+    __m256i h3;
+    __m256i h4;
+    __m256i h5;
+    __m256i h6;
+    __m256i h7;
+    __m256i h8;
+    __m256i h9;
+    int i;
+
+    for (i = 5; i < 10; ++i) {
+        f19[i] = _mm256_mul_epu32(f->v[i], nineteen);
+    }
+
+    fi = f->v[0];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h0 = _mm256_mul_epu32(fi, f->v[0]);
+    h1 = _mm256_mul_epu32(fi_2, f->v[1]);
+    h2 = _mm256_mul_epu32(fi_2, f->v[2]);
+    h3 = _mm256_mul_epu32(fi_2, f->v[3]);
+    h4 = _mm256_mul_epu32(fi_2, f->v[4]);
+
+    fi = f->v[1];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    fi_4 = _mm256_add_epi64(fi_2, fi_2);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_4, f19[9]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_2, f->v[1]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi_2, f->v[2]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_4, f->v[3]));
+
+    fi = f->v[2];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_2, f19[8]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi_2, f19[9]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi, f->v[2]));
+
+    fi = f->v[3];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    fi_4 = _mm256_add_epi64(fi_2, fi_2);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_4, f19[7]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi_2, f19[8]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_4, f19[9]));
+
+    fi = f->v[4];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_2, f19[6]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi_2, f19[7]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_2, f19[8]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi_2, f19[9]));
+
+    fi = f->v[5];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    fi_4 = _mm256_add_epi64(fi_2, fi_2);
+    h0 = _mm256_add_epi64(h0, _mm256_mul_epu32(fi_2, f19[5]));
+    h1 = _mm256_add_epi64(h1, _mm256_mul_epu32(fi_2, f19[6]));
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi_4, f19[7]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi_2, f19[8]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_4, f19[9]));
+
+    fi = f->v[6];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h2 = _mm256_add_epi64(h2, _mm256_mul_epu32(fi, f19[6]));
+    h3 = _mm256_add_epi64(h3, _mm256_mul_epu32(fi_2, f19[7]));
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_2, f19[8]));
+
+    fi = f->v[7];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h4 = _mm256_add_epi64(h4, _mm256_mul_epu32(fi_2, f19[7]));
+
+    fi = f->v[0];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h5 = _mm256_mul_epu32(fi_2, f->v[5]);
+    h6 = _mm256_mul_epu32(fi_2, f->v[6]);
+    h7 = _mm256_mul_epu32(fi_2, f->v[7]);
+    h8 = _mm256_mul_epu32(fi_2, f->v[8]);
+    h9 = _mm256_mul_epu32(fi_2, f->v[9]);
+
+    fi = f->v[1];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    fi_4 = _mm256_add_epi64(fi_2, fi_2);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi_2, f->v[4]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_4, f->v[5]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi_2, f->v[6]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_4, f->v[7]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi_2, f->v[8]));
+
+    fi = f->v[2];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi_2, f->v[3]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_2, f->v[4]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi_2, f->v[5]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_2, f->v[6]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi_2, f->v[7]));
+
+    fi = f->v[3];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    fi_4 = _mm256_add_epi64(fi_2, fi_2);
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_2, f->v[3]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi_2, f->v[4]));
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_4, f->v[5]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi_2, f->v[6]));
+
+    fi = f->v[4];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi, f->v[4]));
+    h9 = _mm256_add_epi64(h9, _mm256_mul_epu32(fi_2, f->v[5]));
+
+    fi = f->v[6];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi_2, f19[9]));
+
+    fi = f->v[7];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    fi_4 = _mm256_add_epi64(fi_2, fi_2);
+    h5 = _mm256_add_epi64(h5, _mm256_mul_epu32(fi_2, f19[8]));
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi_4, f19[9]));
+
+    fi = f->v[8];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h6 = _mm256_add_epi64(h6, _mm256_mul_epu32(fi, f19[8]));
+    h7 = _mm256_add_epi64(h7, _mm256_mul_epu32(fi_2, f19[9]));
+
+    fi = f->v[9];
+    fi_2 = _mm256_add_epi64(fi, fi);
+    h8 = _mm256_add_epi64(h8, _mm256_mul_epu32(fi_2, f19[9]));
+
+    h->v[0] = h0;
+    h->v[1] = h1;
+    h->v[2] = h2;
+    h->v[3] = h3;
+    h->v[4] = h4;
+    h->v[5] = h5;
+    h->v[6] = h6;
+    h->v[7] = h7;
+    h->v[8] = h8;
+    h->v[9] = h9;
+    fe4_carry(h);
+}
+
+
+
+/*
+    h = (a, b, c, d), splitting each 51 bit limb of fe64.c in two.
+*/
+
+GE_AVX2 static void fe4_pack(fe4 *h, const fe a, const fe b, const fe c, const fe d) {
+    const __m256i mask26 = _mm256_set1_epi64x((1 << 26) - 1);
+    __m256i t;
+    int i;
+
+    for (i = 0; i < 5; ++i) {
+        t = _mm256_set_epi64x((long long) d[i], (long long) c[i], (long long) b[i], (long long) a[i]);
+        h->v[2 * i] = _mm256_and_si256(t, mask26);
+        h->v[2 * i + 1] = _mm256_srli_epi64(t, 26);
+    }
+
+    fe4_carry(h);
+}
+
+
+
+/*
+    (a, b, c, d) = h, any of them can be NULL.
+    h must be carried, which leaves every joined limb below 2^52.
+*/
+
+GE_AVX2 static void fe4_unpack(fe a, fe b, fe c, fe d, const fe4 *h) {
+    uint64_t t[4];
+    int i;
+
+    for (i = 0; i < 5; ++i) {
+        _mm256_storeu_si256((__m256i *) t, _mm256_add_epi64(h->v[2 * i], _mm256_slli_epi64(h->v[2 * i + 1], 26)));
+
+        if (a) {
+            a[i] = t[0];
+        }
+
+        if (b) {
+            b[i] = t[1];
+        }
+
+        if (c) {
+            c[i] = t[2];
+        }
+
+        if (d) {
+            d[i] = t[3];
+        }
+    }
+}
+
+
+
+/*
+    p = (0, 1, 1, 0)
+*/
+
+GE_AVX2 static void ge4_0(fe4 *p) {
+    fe4_0(p);
+    p->v[0] = _mm256_set_epi64x(0, 1, 1, 0);
+}
+
+
+
+/*
+    q = (Y - X, Y + X, 2Z, 2dT) from a ge_cached, or the same for -p if
+    negate is set.
+*/
+
+GE_AVX2 static void ge4_from_cached(fe4 *q, const ge_cached *p, int negate) {
+    fe z2;
+    fe t2d;
+
+    fe_add(z2, p->Z, p->Z);
+
+    if (negate) {
+        fe_neg(t2d, p->T2d);
+        fe4_pack(q, p->YplusX, p->YminusX, z2, t2d);
+    } else {
+        fe4_pack(q, p->YminusX, p->YplusX, z2, p->T2d);
+    }
+}
+
+
+
+/*
+    q = (y - x, y + x, 2, 2dxy) from a ge_precomp, or the same for -p if
+    negate is set.
+*/
+
+GE_AVX2 static void ge4_from_precomp(fe4 *q, const ge_precomp *p, int negate) {
+    fe two;
+    fe xy2d;
+
+    fe_1(two);
+    fe_add(two, two, two);
+
+    if (negate) {
+        fe_neg(xy2d, p->xy2d);
+        fe4_pack(q, p->yplusx, p->yminusx, two, xy2d);
+    } else {
+        fe4_pack(q, p->yminusx, p->yplusx, two, p->xy2d);
+    }
+}
+
+
+
+/*
+    r = p + q, q in the form built by ge4_from_cached.
+
+    A = (Y1 - X1)(Y2 - X2), B = (Y1 + X1)(Y2 + X2), C = 2d T1 T2, D = 2 Z1 Z2
+    E = B - A, F = D - C, G = D + C, H = B + A
+    r = (EF, GH, FG, EH)
+
+    The additions between the multiplications are done limb by limb, each
+    limb staying in a register through all of them.
+*/
+
+GE_AVX2 static void ge4_add(fe4 *r, const fe4 *p, const fe4 *q) {
+    fe4 t;
+    fe4 u;
+    __m256i x;
+    int i;
+
+    /* t = (Y1 - X1, Y1 + X1, Z1, T1) */
+    for (i = 0; i < 10; ++i) {
+        x = p->v[i];
+        t.v[i] = BLEND(_mm256_add_epi64(BLEND(x, NEG(x, i), LANE_A), PERMUTE(x, 1, 0, 3, 2)), x, LANE_C | LANE_D);
+    }
+
+    /* t = (A, B, D, C) */
+    fe4_mul(&t, &t, q);
+
+    /* (B, B, D, D) + (-A, A, -C, C) = (E, H, F, G), t = (E, G, F, E), u = (F, H, G, H) */
+    for (i = 0; i < 10; ++i) {
+        x = PERMUTE(t.v[i], 0, 0, 3, 3);
+        x = _mm256_add_epi64(BLEND(x, NEG(x, i), LANE_A | LANE_C), PERMUTE(t.v[i], 1, 1, 2, 2));
+        t.v[i] = PERMUTE(x, 0, 3, 2, 0);
+        u.v[i] = PERMUTE(x, 2, 1, 3, 1);
+    }
+
+    fe4_mul(r, &t, &u);
+}
+
+
+
+/*
+    r = 2 * p
+
+    A = X1^2, B = Y1^2, C = Z1^2, K = (X1 + Y1)^2
+    E = K - A - B, F = B - A - 2C, G = B - A, H = -A - B
+    r = (-F * -E, -H * -G, -F * -G, -H * -E) = (EF, GH, FG, EH)
+*/
+
+GE_AVX2 static void ge4_dbl(fe4 *r, const fe4 *p) {
+    fe4 t;
+    fe4 u;
+    __m256i x;
+    __m256i n;
+    int i;
+
+    /* t = (X1, Y1, Z1, X1 + Y1) */
+    for (i = 0; i < 10; ++i) {
+        x = p->v[i];
+        t.v[i] = BLEND(x, _mm256_add_epi64(PERMUTE(x, 0, 1, 0, 1), PERMUTE(x, 1, 0, 1, 0)), LANE_D);
+    }
+
+    /* t = (A, B, C, K) */
+    fe4_sq(&t, &t);
+
+    /* t = (A, A, A, A) + (B, -B, -B, B) + (0, 0, 2C, -K) = (-H, -G, -F, -E) */
+    for (i = 0; i < 10; ++i) {
+        x = t.v[i];
+        n = NEG(x, i);
+        t.v[i] = _mm256_add_epi64(
+            _mm256_add_epi64(PERMUTE(x, 0, 0, 0, 0), BLEND(PERMUTE(x, 1, 1, 1, 1), PERMUTE(n, 1, 1, 1, 1), LANE_B | LANE_C)),
+            BLEND(BLEND(_mm256_setzero_si256(), _mm256_add_epi64(x, x), LANE_C), n, LANE_D));
+    }
+
+    /* Up to five carried limbs summed, too many for the factor of 19 in fe4_mul. */
+    fe4_carry(&t);
+
+    for (i = 0; i < 10; ++i) {
+        x = t.v[i];
+        u.v[i] = PERMUTE(x, 2, 0, 2, 0);
+        t.v[i] = PERMUTE(x, 3, 1, 1, 3);
+    }
+
+    fe4_mul(r, &u, &t);
+}
+
+
+
+/*
+    Same as ge_double_scalarmult_vartime in ge.c, from the sliding window
+    digits of a and b and the odd multiples A, 3A, ..., 15A of A.
+*/
+
+GE_AVX2 void ge_double_scalarmult_vartime_avx2(ge_p2 *r, const signed char *aslide, const ge_cached *Ai, const signed char *bslide, const ge_precomp *Bi) {
+    fe4 A4[8];
+    fe4 minusA4[8];
+    fe4 B4[8];
+    fe4 minusB4[8];
+    fe4 p;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        ge4_from_cached(&A4[i], &Ai[i], 0);
+        ge4_from_cached(&minusA4[i], &Ai[i], 1);
+        ge4_from_precomp(&B4[i], &Bi[i], 0);
+        ge4_from_precomp(&minusB4[i], &Bi[i], 1);
+    }
+
+    ge4_0(&p);
+
+    for (i = 255; i >= 0; --i) {
+        if (aslide[i] || bslide[i]) {
+            break;
+        }
+    }
+
+    for (; i >= 0; --i) {
+        ge4_dbl(&p, &p);
+
+        if (aslide[i] > 0) {
+            ge4_add(&p, &p, &A4[aslide[i] / 2]);
+        } else if (aslide[i] < 0) {
+            ge4_add(&p, &p, &minusA4[(-aslide[i]) / 2]);
+        }
+
+        if (bslide[i] > 0) {
+            ge4_add(&p, &p, &B4[bslide[i] / 2]);
+        } else if (bslide[i] < 0) {
+            ge4_add(&p, &p, &minusB4[(-bslide[i]) / 2]);
+        }
+    }
+
+    fe4_unpack(r->X, r->Y, r->Z, NULL, &p);
+}
+
+
+
+/*
+    Same as ge_scalarmult_base in ge.c, from the signed radix 16 digits of a.
+    Table lookups go through ge_select_base and stay constant time.
+*/
+
+GE_AVX2 void ge_scalarmult_base_avx2(ge_p3 *h, const signed char *e) {
+    ge_precomp t;
+    fe4 p;
+    fe4 q;
+    int i;
+
+    ge4_0(&p);
+
+    for (i = 1; i < 64; i += 2) {
+        ge_select_base(&t, i / 2, e[i]);
+        ge4_from_precomp(&q, &t, 0);
+        ge4_add(&p, &p, &q);
+    }
+
+    ge4_dbl(&p, &p);
+    ge4_dbl(&p, &p);
+    ge4_dbl(&p, &p);
+    ge4_dbl(&p, &p);
+
+    for (i = 0; i < 64; i += 2) {
+        ge_select_base(&t, i / 2, e[i]);
+        ge4_from_precomp(&q, &t, 0);
+        ge4_add(&p, &p, &q);
+    }
+
+    fe4_unpack(h->X, h->Y, h->Z, h->T, &p);
+}
+
+#endif
+
+
+
+int ed25519_enable_avx2(int enabled) {
+    int sha512_x4;
+
+#if ED25519_AVX2
+    ge_avx2_enabled = enabled != 0;
+#endif
+
+    /* SHA-512 of four messages at once doesn't depend on the field backend. */
+    sha512_x4 = ed_sha512_enable_x4(enabled);
+
+#if ED25519_AVX2
+    return ge_avx2_enabled || sha512_x4;
+#else
+    return sha512_x4;
+#endif
+}
+
+
+
+int ed25519_scalarmult_base_on(unsigned char *out, const unsigned char *scalar, int avx2) {
+    ge_p3 h;
+
+    if (avx2 && !ED25519_AVX2) {
+        return 0;
+    }
+
+    ge_scalarmult_base_builtin_on(&h, scalar, avx2);
+    ge_p3_tobytes(out, &h);
+    return 1;
+}
+
+
+
+int ed25519_double_scalarmult_on(unsigned char *out, const unsigned char *a, const unsigned char *point, const unsigned char *b, int avx2) {
+    ge_p3 A;
+    ge_p2 r;
+
+    if ((avx2 && !ED25519_AVX2) || ge_frombytes_negate_vartime(&A, point) != 0) {
+        return 0;
+    }
+
+    ge_double_scalarmult_vartime_on(&r, a, &A, b, avx2);
+    ge_tobytes(out, &r);
+    return 1;
+}
@@ -0,0 +1,31 @@
+#ifndef GE_AVX2_H
+#define GE_AVX2_H
+
+#include "ge.h"
+
+
+/*
+    ED25519_AVX2 builds the four way point arithmetic of ge_avx2.c, used by
+    ge_double_scalarmult_vartime and ge_scalarmult_base once
+    ed25519_enable_avx2 has been called on a CPU that has AVX2. It works on
+    the limbs of fe64.c, so it needs ED25519_FE64.
+*/
+
+#ifndef ED25519_AVX2
+    #if ED25519_FE64 && (defined(__x86_64__) || defined(_M_X64))
+        #define ED25519_AVX2 1
+    #else
+        #define ED25519_AVX2 0
+    #endif
+#endif
+
+#if ED25519_AVX2
+
+extern int ge_avx2_enabled;
+
+void ge_double_scalarmult_vartime_avx2(ge_p2 *r, const signed char *aslide, const ge_cached *Ai, const signed char *bslide, const ge_precomp *Bi);
+void ge_scalarmult_base_avx2(ge_p3 *h, const signed char *e);
+
+#endif
+
+#endif
@@ -0,0 +1,277 @@
+#include <stdlib.h>
+
+#include "ed25519.h"
+#include "ge.h"
+
+
+/*
+    Fixed-base multiplication over a table built at runtime.
+
+    The scalar is recoded into signed digits of window bits, and the table
+    holds a row for every digit position i with the multiples 1..2^(window-1)
+    of 2^(window * i) B, so a multiplication is one table lookup and one mixed
+    addition per digit and needs no doublings. The built-in table of ge.c is
+    the same for a window of 4 with every other row, at the price of four
+    doublings.
+
+    Wider windows mean fewer additions but longer rows, and each lookup reads
+    the whole row to stay constant time. ed25519_use_base_window picks the
+    width; the rows take 2^(window-1) * 120 bytes each, from 60KB for 4 bits
+    to 480KB for 8.
+
+    The table it installs is never freed or replaced, so threads may read it
+    without any locking. Tables of other widths, built to compare them, are
+    separate ed25519_base_table objects passed in explicitly.
+*/
+
+#if ED25519_FE64
+typedef uint64_t limb;
+#else
+typedef int32_t limb;
+#endif
+
+#define LIMBS ((int) (sizeof(fe) / sizeof(limb)))
+
+struct ed25519_base_table {
+    ge_precomp *rows;
+    int window;
+    int digits;
+    int entries;
+};
+
+static ed25519_base_table *installed = NULL;
+
+
+
+/*
+    t = b * row[0] in constant time, where row holds 1..entries times a point
+    and |b| <= entries.
+*/
+
+static void select_row(ge_precomp *t, const ge_precomp *row, int entries, int b) {
+    const limb negative = (limb) 0 - (limb) ((uint32_t) b >> 31);
+    const int babs = b - ((b & (int) negative) << 1);
+    fe yplusx;
+    int i;
+    int j;
+
+    fe_1(t->yplusx);
+    fe_1(t->yminusx);
+    fe_0(t->xy2d);
+
+    for (i = 0; i < entries; ++i) {
+        const limb mask = (limb) 0 - (limb) (((uint32_t) (babs ^ (i + 1)) - 1) >> 31);
+
+        for (j = 0; j < LIMBS; ++j) {
+            t->yplusx[j] ^= (t->yplusx[j] ^ row[i].yplusx[j]) & mask;
+            t->yminusx[j] ^= (t->yminusx[j] ^ row[i].yminusx[j]) & mask;
+            t->xy2d[j] ^= (t->xy2d[j] ^ row[i].xy2d[j]) & mask;
+        }
+    }
+
+    /* -P swaps y + x with y - x and negates 2dxy */
+    fe_copy(yplusx, t->yplusx);
+    fe_cmov(t->yplusx, t->yminusx, (unsigned int) negative & 1);
+    fe_cmov(t->yminusx, yplusx, (unsigned int) negative & 1);
+    fe_neg(yplusx, t->xy2d);
+    fe_cmov(t->xy2d, yplusx, (unsigned int) negative & 1);
+}
+
+
+
+/*
+    e[i] such that a = sum e[i] 2^(window * i), each between -2^(window-1)
+    and 2^(window-1). a[31] <= 127 leaves room for the last carry in the
+    last digit.
+*/
+
+static void recode(int *e, const unsigned char *a, int window, int digits) {
+    const int half = 1 << (window - 1);
+    int carry = 0;
+    int i;
+
+    for (i = 0; i < digits; ++i) {
+        const int bit = window * i;
+        const int byte = bit >> 3;
+        uint32_t bits = a[byte];
+
+        if (byte + 1 < 32) {
+            bits |= (uint32_t) a[byte + 1] << 8;
+        }
+        e[i] = (int) ((bits >> (bit & 7)) & ((1u << window) - 1)) + carry;
+        carry = (e[i] + half) >> window;
+        e[i] -= carry << window;
+    }
+
+    /* the last digit keeps its carry, it is at most 2^(window-1) */
+    e[digits - 1] += carry << window;
+}
+
+
+
+void ge_scalarmult_base_with(ge_p3 *h, const unsigned char *a, const ed25519_base_table *table) {
+    int e[64];
+    ge_precomp t;
+    ge_p1p1 r;
+    int i;
+
+    if (table == NULL) {
+        ge_scalarmult_base_builtin(h, a);
+        return;
+    }
+
+    recode(e, a, table->window, table->digits);
+    ge_p3_0(h);
+
+    for (i = 0; i < table->digits; ++i) {
+        select_row(&t, table->rows + i * table->entries, table->entries, e[i]);
+        ge_madd(&r, h, &t);
+        ge_p1p1_to_p3(h, &r);
+    }
+}
+
+
+const ed25519_base_table *ge_base_table_installed(void) {
+    return installed;
+}
+
+
+int ed25519_get_base_window(void) {
+    return installed != NULL ? installed->window : 0;
+}
+
+
+
+/*
+    Builds the rows in extended coordinates, then brings them to affine with
+    one inversion for the lot: x = X/Z, y = Y/Z, and the precomputed form
+    (y + x, y - x, 2dxy) is ge_p3_to_cached of (x, y, 1, xy).
+*/
+
+static ge_precomp *build_table(int window, int digits, int entries) {
+    const size_t count = (size_t) digits * entries;
+    ge_precomp *rows = (ge_precomp *) malloc(count * sizeof(ge_precomp));
+    ge_p3 *points = (ge_p3 *) malloc(count * sizeof(ge_p3));
+    fe *acc = (fe *) malloc(count * sizeof(fe));
+    const unsigned char one[32] = { 1 };
+    ge_p3 base;
+    ge_cached cached;
+    ge_p1p1 r;
+    ge_p2 s;
+    fe recip;
+    fe z;
+    size_t k;
+    int i;
+    int j;
+
+    if (rows == NULL || points == NULL || acc == NULL) {
+        free(rows);
+        free(points);
+        free(acc);
+        return NULL;
+    }
+
+    ge_scalarmult_base(&base, one);
+    for (i = 0; i < digits; ++i) {
+        ge_p3 *row = points + (size_t) i * entries;
+
+        /* row[j] = (j + 1) * 2^(window * i) B */
+        row[0] = base;
+        ge_p3_to_cached(&cached, &base);
+        for (j = 1; j < entries; ++j) {
+            ge_add(&r, &row[j - 1], &cached);
+            ge_p1p1_to_p3(&row[j], &r);
+        }
+
+        /* the next row's point, 2^window times this one */
+        ge_p3_to_p2(&s, &base);
+        for (j = 0; j < window; ++j) {
+            ge_p2_dbl(&r, &s);
+            if (j + 1 < window) {
+                ge_p1p1_to_p2(&s, &r);
+            }
+        }
+        ge_p1p1_to_p3(&base, &r);
+    }
+
+    fe_copy(acc[0], points[0].Z);
+    for (k = 1; k < count; ++k) {
+        fe_mul(acc[k], acc[k - 1], points[k].Z);
+    }
+    fe_invert(recip, acc[count - 1]);
+
+    for (k = count; k-- > 0;) {
+        ge_p3 affine;
+
+        if (k > 0) {
+            fe_mul(z, recip, acc[k - 1]);
+            fe_mul(recip, recip, points[k].Z);
+        } else {
+            fe_copy(z, recip);
+        }
+        fe_mul(affine.X, points[k].X, z);
+        fe_mul(affine.Y, points[k].Y, z);
+        fe_1(affine.Z);
+        fe_mul(affine.T, affine.X, affine.Y);
+
+        ge_p3_to_cached(&cached, &affine);
+        fe_copy(rows[k].yplusx, cached.YplusX);
+        fe_copy(rows[k].yminusx, cached.YminusX);
+        fe_copy(rows[k].xy2d, cached.T2d);
+    }
+
+    free(points);
+    free(acc);
+    return rows;
+}
+
+
+ed25519_base_table *ed25519_base_table_create(int window) {
+    ed25519_base_table *table;
+
+    if (window < 4 || window > 8) {
+        return NULL;
+    }
+
+    table = (ed25519_base_table *) malloc(sizeof(ed25519_base_table));
+    if (table == NULL) {
+        return NULL;
+    }
+
+    table->window = window;
+    table->digits = (256 + window - 1) / window;
+    table->entries = 1 << (window - 1);
+    table->rows = build_table(window, table->digits, table->entries);
+    if (table->rows == NULL) {
+        free(table);
+        return NULL;
+    }
+
+    return table;
+}
+
+
+void ed25519_base_table_free(ed25519_base_table *table) {
+    if (table != NULL) {
+        free(table->rows);
+        free(table);
+    }
+}
+
+
+int ed25519_use_base_window(int window) {
+    ed25519_base_table *table;
+
+    /* a table other threads may be reading is never swapped */
+    if (window == 0 || installed != NULL) {
+        return 0;
+    }
+
+    table = ed25519_base_table_create(window);
+    if (table == NULL) {
+        return 0;
+    }
+
+    installed = table;
+    return 1;
+}
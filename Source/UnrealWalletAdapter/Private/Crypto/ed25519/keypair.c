@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include <string.h>
 
 #include "ed25519.h"
 #include "ed_sha512.h"
@@ -29,3 +30,79 @@ void ed25519_create_keypair(uint8_t *public_key, uint8_t *private_key, const uin
 	    private_key[32 + i] = public_key[i];
     }
 }
+
+
+/* Points computed between encodings, bounding the stack used. */
+#define KEYPAIR_CHUNK 64
+
+void ed25519_create_keypairs(unsigned char *public_keys, unsigned char *private_keys, const unsigned char *seeds, size_t count)
+{
+    ed25519_create_keypairs_with_table(public_keys, private_keys, seeds, count, ge_base_table_installed());
+}
+
+
+void ed25519_create_keypairs_with_table(unsigned char *public_keys, unsigned char *private_keys, const unsigned char *seeds, size_t count, const ed25519_base_table *table)
+{
+    ge_p3 points[KEYPAIR_CHUNK];
+    sha512_parts parts[4];
+    unsigned char hashes[4][64];
+    size_t done;
+    size_t n;
+    size_t i;
+    int j;
+
+    memset(parts, 0, sizeof(parts));
+
+    for (done = 0; done < count; done += n) {
+        n = count - done < KEYPAIR_CHUNK ? count - done : KEYPAIR_CHUNK;
+
+        for (i = 0; i < n; i += 4) {
+            /* lanes past the end hash the last seed again */
+            for (j = 0; j < 4; ++j) {
+                parts[j].parts[0] = seeds + 32 * (done + (i + j < n ? i + j : n - 1));
+                parts[j].lens[0] = 32;
+            }
+            ed_sha512_x4(parts, hashes);
+
+            for (j = 0; j < 4 && i + j < n; ++j) {
+                hashes[j][0] &= 248;
+                hashes[j][31] &= 63;
+                hashes[j][31] |= 64;
+                ge_scalarmult_base_with(&points[i + j], hashes[j], table);
+            }
+        }
+
+        ge_p3_batch_tobytes(public_keys + 32 * done, points, n);
+
+        for (i = done; i < done + n; ++i) {
+            memcpy(private_keys + 64 * i, seeds + 32 * i, 32);
+            memcpy(private_keys + 64 * i + 32, public_keys + 32 * i, 32);
+        }
+    }
+}
+
+
+void ed25519_public_key_run(unsigned char *public_keys, const unsigned char *scalar, size_t count)
+{
+    ge_p3 points[KEYPAIR_CHUNK];
+    ge_p3 next;
+    ge_precomp B;
+    ge_p1p1 sum;
+    size_t done;
+    size_t n;
+    size_t i;
+
+    /* one multiplication for the first key, then an addition of B per key */
+    ge_select_base(&B, 0, 1);
+    ge_scalarmult_base(&next, scalar);
+
+    for (done = 0; done < count; done += n) {
+        n = count - done < KEYPAIR_CHUNK ? count - done : KEYPAIR_CHUNK;
+        for (i = 0; i < n; ++i) {
+            points[i] = next;
+            ge_madd(&sum, &next, &B);
+            ge_p1p1_to_p3(&next, &sum);
+        }
+        ge_p3_batch_tobytes(public_keys + 32 * done, points, n);
+    }
+}
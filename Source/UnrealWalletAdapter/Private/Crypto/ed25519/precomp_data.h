@@ -1389,3 +1389,656 @@ static const ge_precomp base[32][8] = {
         },
     },
 };
+
+
+/* base_wide[i][j] = (2j+1)*2^(64i)*B */
+static const ge_precomp base_wide[4][32] = {
+    {
+        {
+            { 25967493, 19198397, 29566455, 3660896, 54414519, 4014786, 27544626, 21800161, 61029707, 2047604 },
+            { 54563134, 934261, 64385954, 3049989, 66381436, 9406985, 12720692, 5043384, 19500929, 18085054 },
+            { 58370664, 4489569, 9688441, 18769238, 10184608, 21191052, 29287918, 11864899, 42594502, 29115885 },
+        },
+        {
+            { 15636272, 23865875, 24204772, 25642034, 616976, 16869170, 27787599, 18782243, 28944399, 32004408 },
+            { 16568933, 4717097, 55552716, 32452109, 15682895, 21747389, 16354576, 21778470, 7689661, 11199574 },
+            { 30464137, 27578307, 55329429, 17883566, 23220364, 15915852, 7512774, 10017326, 49359771, 23634074 },
+        },
+        {
+            { 10861363, 11473154, 27284546, 1981175, 37044515, 12577860, 32867885, 14515107, 51670560, 10819379 },
+            { 4708026, 6336745, 20377586, 9066809, 55836755, 6594695, 41455196, 12483687, 54440373, 5581305 },
+            { 19563141, 16186464, 37722007, 4097518, 10237984, 29206317, 28542349, 13850243, 43430843, 17738489 },
+        },
+        {
+            { 5153727, 9909285, 1723747, 30776558, 30523604, 5516873, 19480852, 5230134, 43156425, 18378665 },
+            { 36839857, 30090922, 7665485, 10083793, 28475525, 1649722, 20654025, 16520125, 30598449, 7715701 },
+            { 28881826, 14381568, 9657904, 3680757, 46927229, 7843315, 35708204, 1370707, 29794553, 32145132 },
+        },
+        {
+            { 44589871, 26862249, 14201701, 24808930, 43598457, 8844725, 18474211, 32192982, 54046167, 13821876 },
+            { 60653668, 25714560, 3374701, 28813570, 40010246, 22982724, 31655027, 26342105, 18853321, 19333481 },
+            { 4566811, 20590564, 38133974, 21313742, 59506191, 30723862, 58594505, 23123294, 2207752, 30344648 },
+        },
+        {
+            { 41954014, 29368610, 29681143, 7868801, 60254203, 24130566, 54671499, 32891431, 35997400, 17421995 },
+            { 25576264, 30851218, 7349803, 21739588, 16472781, 9300885, 3844789, 15725684, 171356, 6466918 },
+            { 23103977, 13316479, 9739013, 17404951, 817874, 18515490, 8965338, 19466374, 36393951, 16193876 },
+        },
+        {
+            { 33587053, 3180712, 64714734, 14003686, 50205390, 17283591, 17238397, 4729455, 49034351, 9256799 },
+            { 41926547, 29380300, 32336397, 5036987, 45872047, 11360616, 22616405, 9761698, 47281666, 630304 },
+            { 53388152, 2639452, 42871404, 26147950, 9494426, 27780403, 60554312, 17593437, 64659607, 19263131 },
+        },
+        {
+            { 63957664, 28508356, 9282713, 6866145, 35201802, 32691408, 48168288, 15033783, 25105118, 25659556 },
+            { 42782475, 15950225, 35307649, 18961608, 55446126, 28463506, 1573891, 30928545, 2198789, 17749813 },
+            { 64009494, 10324966, 64867251, 7453182, 61661885, 30818928, 53296841, 17317989, 34647629, 21263748 },
+        },
+        {
+            { 17735041, 27114469, 9040472, 7210680, 43325571, 26153544, 26948151, 12350803, 38656901, 28625252 },
+            { 2154119, 14782993, 28737794, 11906199, 36205504, 26488101, 19338132, 16910143, 50209922, 29794297 },
+            { 29935700, 6336041, 20999566, 30405369, 13628497, 24612108, 61639745, 22359641, 56973806, 18684690 },
+        },
+        {
+            { 29792811, 31379227, 46332526, 20675663, 58452680, 20584117, 42892250, 32958636, 31674345, 24275271 },
+            { 7606599, 22131225, 17376912, 15235046, 32822971, 7512882, 30227203, 14344178, 9952094, 8804749 },
+            { 32575079, 3961822, 36404898, 17773250, 67073898, 1319543, 30641032, 7823672, 63309858, 18878784 },
+        },
+        {
+            { 10715079, 19379211, 26572932, 18690221, 42034819, 23989795, 12020708, 19771669, 38888710, 22335074 },
+            { 37146997, 554126, 63326061, 20925660, 49205290, 8620615, 53375504, 25938867, 8752612, 31225894 },
+            { 4529887, 12416158, 60388162, 30157900, 15427957, 27628808, 61150927, 12724463, 23658330, 23690055 },
+        },
+        {
+            { 34934403, 21269183, 45810226, 19657305, 54297192, 7413280, 66851983, 6164080, 25005049, 18002658 },
+            { 5403481, 24654166, 61855580, 13522652, 14989680, 1879017, 43913069, 25724172, 20315901, 421248 },
+            { 34818947, 1705239, 25347020, 7938434, 51632025, 1720023, 54809726, 32655885, 64907986, 5517607 },
+        },
+        {
+            { 21434680, 16557378, 13251023, 30047149, 24494012, 27723949, 62710290, 19153429, 7715737, 28093800 },
+            { 14461032, 6393639, 22681353, 14533514, 52493587, 3544717, 57780998, 24657863, 59891807, 31628125 },
+            { 60864886, 31199953, 18524951, 11247802, 43517645, 21165456, 26204394, 27268421, 63221077, 29979135 },
+        },
+        {
+            { 30382514, 10077556, 27696264, 8918288, 30231380, 17961119, 9092549, 7627898, 41405215, 31798052 },
+            { 13670592, 720327, 7131696, 19360499, 66651570, 16947532, 3061924, 22871019, 39814495, 20141336 },
+            { 44847187, 28379568, 38472030, 23697331, 49441718, 3215393, 1669253, 30451034, 62323912, 29368533 },
+        },
+        {
+            { 7814913, 1690062, 27222385, 30715870, 48444195, 28125622, 48943580, 32330149, 25500368, 1818106 },
+            { 39340596, 15199968, 52787715, 18781603, 18787729, 5464578, 11652644, 8722118, 57056621, 5153960 },
+            { 5733861, 14534448, 59480402, 15892910, 30737296, 188529, 491756, 17646733, 33071791, 15771063 },
+        },
+        {
+            { 18130707, 21331574, 52581845, 30172287, 44350959, 22271792, 1149903, 16209407, 20222151, 32139086 },
+            { 52372801, 13847470, 52690845, 3802477, 48387139, 10595589, 13745896, 3112846, 50361463, 2761905 },
+            { 45982696, 12273933, 15897066, 704320, 31367969, 3120352, 11710867, 16405685, 19410991, 10591627 },
+        },
+        {
+            { 14900005, 885327, 22211023, 15569757, 34309216, 29866047, 13199845, 27738520, 4631001, 13354856 },
+            { 36631997, 23300851, 59535242, 27474493, 59924914, 29067704, 17551261, 13583017, 37580567, 31071178 },
+            { 22641770, 21277083, 10843473, 1582748, 37504588, 634914, 15612385, 18139122, 59415250, 22563863 },
+        },
+        {
+            { 9613009, 19260283, 41722369, 1731435, 53022549, 4700744, 26055020, 27627618, 20854228, 175025 },
+            { 61915349, 11733561, 59403492, 31381562, 29521830, 16845409, 54973419, 26057054, 49464700, 796779 },
+            { 3855018, 8248512, 12652406, 88331, 2948262, 971326, 15614761, 9441028, 29507685, 8583792 },
+        },
+        {
+            { 9860006, 14808585, 9600042, 24095287, 23400176, 24077237, 63783137, 3916687, 56750252, 30681804 },
+            { 33709664, 3740344, 52888604, 25059045, 46197996, 22678812, 45207164, 6431243, 21300862, 27646257 },
+            { 49811511, 9216232, 25043921, 18738174, 29145960, 3024227, 65580502, 530149, 66809973, 22275500 },
+        },
+        {
+            { 23499385, 24936714, 38355445, 2354155, 15431304, 5726449, 46809414, 7589351, 5421941, 16121767 },
+            { 45162189, 23851397, 9380591, 15192763, 36034862, 15525765, 5277811, 25040629, 33286237, 31693326 },
+            { 62424427, 13336013, 49368582, 1581264, 30884213, 15048226, 66823504, 4736577, 53805192, 29608355 },
+        },
+        {
+            { 25190215, 26304748, 58928336, 9111275, 64280343, 5025798, 61299599, 20659504, 30387592, 32519377 },
+            { 14480213, 17057820, 2286692, 32980967, 14693157, 22197912, 49247898, 9909859, 236428, 16857435 },
+            { 7877514, 29872867, 45886243, 25902853, 41998762, 6241604, 35694938, 15657879, 56797932, 8609105 },
+        },
+        {
+            { 54245208, 32562161, 57887697, 19509733, 45323534, 3918114, 27606728, 25974066, 7290094, 11418745 },
+            { 28964163, 20950093, 44929966, 26145892, 34786807, 18058153, 18187179, 27016486, 42438836, 14869174 },
+            { 55703901, 1222455, 64329400, 24533246, 11330890, 9135834, 3589529, 19555234, 53275553, 1207212 },
+        },
+        {
+            { 33323313, 2048733, 12219722, 6017849, 4177481, 23804208, 19535260, 10453936, 55775079, 31816581 },
+            { 64814718, 27217688, 29891310, 4504619, 8548709, 21986323, 62140656, 12555980, 34377058, 21436823 },
+            { 49069441, 9880212, 33350825, 24576421, 24446077, 15616561, 19302117, 9370836, 55172180, 28526191 },
+        },
+        {
+            { 28296070, 26757209, 56755199, 4572840, 2140330, 10029994, 53559056, 8187614, 41167332, 24643278 },
+            { 35101859, 30958612, 66105296, 3168612, 22836264, 10055966, 22893634, 13045780, 28576558, 30704591 },
+            { 59987873, 21166324, 43296694, 15387892, 39447987, 19996270, 5059183, 19972934, 30207804, 29631666 },
+        },
+        {
+            { 335311, 16132893, 21221549, 4369853, 1038992, 24394987, 24372708, 24889161, 62329722, 17157782 },
+            { 56922508, 1347520, 23300731, 27393371, 42651667, 8512932, 27610931, 24436993, 3998295, 3835244 },
+            { 16327050, 22776956, 14746360, 22599650, 23700920, 11727222, 25900154, 21823218, 34907363, 25105813 },
+        },
+        {
+            { 59807886, 12089757, 48515346, 7922406, 480852, 26361581, 4246898, 10714230, 644198, 13128477 },
+            { 7174885, 26592113, 59892333, 6465478, 4145835, 17673606, 38764952, 22293290, 1360980, 25805937 },
+            { 40179568, 6331649, 42386021, 20205884, 15635073, 6103612, 56391180, 6789942, 7597240, 24095312 },
+        },
+        {
+            { 54776568, 3381500, 18757262, 7875103, 106218, 1145711, 19452113, 27649723, 26496795, 19612129 },
+            { 46701540, 24101444, 49515651, 25946994, 45338156, 9941093, 55509371, 31298943, 1347425, 15381335 },
+            { 53576449, 26135856, 17092785, 3684747, 57829121, 27109516, 2987881, 10987137, 52269096, 15465522 },
+        },
+        {
+            { 12924165, 26264317, 5272132, 10039545, 27497072, 30615494, 60406855, 30400829, 53656985, 11746941 },
+            { 35668062, 24246990, 47788280, 25128298, 37456967, 19518969, 43459670, 10724644, 7294162, 4471290 },
+            { 33813988, 3549109, 101112, 21464449, 4858392, 3029943, 59999440, 21424738, 34313875, 1512799 },
+        },
+        {
+            { 29494960, 28240930, 51093230, 28823678, 25682287, 21242363, 10463025, 4241111, 8656993, 10649532 },
+            { 63536751, 7572551, 62249759, 25202639, 32046232, 32318941, 29315141, 15424555, 24706712, 28857648 },
+            { 47618751, 5819839, 19528172, 20715950, 40655763, 20611047, 4960954, 6496879, 2790858, 28045273 },
+        },
+        {
+            { 18065612, 22289470, 44837820, 31021159, 32797785, 15389833, 11230024, 31144773, 15579137, 4915791 },
+            { 49664705, 3638040, 57888693, 19234931, 40104182, 28143840, 28667142, 18386877, 18584835, 3592929 },
+            { 12065039, 18867394, 6430594, 17107159, 1727094, 13096957, 61520237, 27056604, 27026997, 13543966 },
+        },
+        {
+            { 1404081, 4022847, 27586665, 14209107, 28740330, 30038710, 51818051, 20241476, 1871192, 8696643 },
+            { 17325298, 33376175, 65271265, 4931225, 31708266, 6292284, 23064744, 22072792, 43945505, 9236924 },
+            { 51955585, 20268063, 61151838, 26383348, 4766519, 20788033, 21173534, 27030753, 9509140, 7790046 },
+        },
+        {
+            { 24124086, 5364343, 28620391, 10538620, 59433851, 19581010, 60862718, 9945787, 10491858, 32213802 },
+            { 7062127, 13930079, 2259902, 6463144, 32137099, 24748848, 41557343, 29331342, 47345194, 13022814 },
+            { 18921826, 392002, 55817981, 6420686, 8000611, 22415972, 14722962, 26246290, 20604450, 8079345 },
+        },
+    },
+    {
+        {
+            { 64091413, 10058205, 1980837, 3964243, 22160966, 12322533, 60677741, 20936246, 12228556, 26550755 },
+            { 32944382, 14922211, 44263970, 5188527, 21913450, 24834489, 4001464, 13238564, 60994061, 8653814 },
+            { 22865569, 28901697, 27603667, 21009037, 14348957, 8234005, 24808405, 5719875, 28483275, 2841751 },
+        },
+        {
+            { 16650902, 22516500, 66044685, 1570628, 58779118, 7352752, 66806440, 16271224, 43059443, 26862581 },
+            { 45197768, 27626490, 62497547, 27994275, 35364760, 22769138, 24123613, 15193618, 45456747, 16815042 },
+            { 57172930, 29264984, 41829040, 4372841, 2087473, 10399484, 31870908, 14690798, 17361620, 11864968 },
+        },
+        {
+            { 30625386, 28825032, 41552902, 20761565, 46624288, 7695098, 17097188, 17250936, 39109084, 1803631 },
+            { 63555773, 9865098, 61880298, 4272700, 61435032, 16864731, 14911343, 12196514, 45703375, 7047411 },
+            { 20093258, 9920966, 55970670, 28210574, 13161586, 12044805, 34252013, 4124600, 34765036, 23296865 },
+        },
+        {
+            { 17960970, 21778898, 62967895, 23851901, 58232301, 32143814, 54201480, 24894499, 37532563, 1903855 },
+            { 23134274, 19275300, 56426866, 31942495, 20684484, 15770816, 54119114, 3190295, 26955097, 14109738 },
+            { 15308788, 5320727, 36995055, 19235554, 22902007, 7767164, 29425325, 22276870, 31960941, 11934971 },
+        },
+        {
+            { 31254118, 1247520, 56638492, 23373442, 12534958, 28970853, 66585430, 24451521, 60383370, 1591912 },
+            { 10664735, 32173947, 54728115, 8227995, 47858629, 2075899, 61224056, 30136513, 57011003, 19820314 },
+            { 57881498, 14760024, 34448359, 19821882, 41323741, 23451510, 46398205, 14040923, 47357663, 375536 },
+        },
+        {
+            { 26386175, 15886398, 6210213, 24865034, 57735685, 28309883, 61987132, 25272539, 44140267, 450833 },
+            { 45781502, 28872641, 62523285, 2316979, 33472401, 22310431, 47352236, 17859960, 39399155, 21422828 },
+            { 24302215, 31687736, 25077846, 21843473, 4576488, 6205251, 66790496, 24122107, 14983489, 23667881 },
+        },
+        {
+            { 14479701, 2381808, 36560813, 2277485, 33012704, 13943292, 61151209, 32528175, 27749741, 13850694 },
+            { 25966520, 29935467, 52299635, 7457132, 38028618, 32502166, 4133330, 23395153, 32438961, 8439490 },
+            { 39718878, 4486571, 12338909, 13455409, 39801236, 22140515, 28446883, 12884658, 13018871, 32846332 },
+        },
+        {
+            { 21433628, 6625422, 8699590, 10066105, 20194138, 5122663, 2202520, 25519278, 62879418, 6986090 },
+            { 39328095, 22469201, 58705582, 3782864, 25115577, 24182206, 43060233, 2921967, 41070353, 18058371 },
+            { 49052869, 11715196, 19430228, 12171900, 9863652, 30872862, 2615688, 8658395, 26868595, 4633822 },
+        },
+        {
+            { 59162079, 25814639, 52344037, 32268321, 34236145, 10093688, 45805393, 19178234, 56565485, 4839315 },
+            { 3073417, 29287926, 52292815, 12397268, 33351485, 21462666, 28595360, 30753757, 65759924, 7644170 },
+            { 61319700, 25309607, 61392108, 21232776, 39180331, 13139897, 44088618, 7415143, 31139029, 31854606 },
+        },
+        {
+            { 66706848, 12589167, 51909216, 18052944, 52916963, 2258266, 47992822, 5776237, 19674035, 13184124 },
+            { 19300088, 7649012, 50792718, 24693454, 64739012, 26111681, 25624392, 4285442, 1164020, 13829952 },
+            { 1441252, 30972095, 33308585, 1279478, 26797974, 19642332, 21346021, 32776238, 35044978, 4605055 },
+        },
+        {
+            { 62624505, 20161439, 15050546, 2467139, 59714581, 16701045, 44175261, 33173075, 54734742, 17721797 },
+            { 2934644, 9867410, 39416492, 2655383, 34839342, 29524607, 39367076, 2148276, 1398330, 13127633 },
+            { 19880652, 23131092, 57292552, 27960171, 47948993, 27359194, 66190602, 29071211, 32120533, 4380234 },
+        },
+        {
+            { 23152990, 23421717, 26135852, 13362360, 38087140, 13813410, 23094438, 29724329, 8252358, 8909141 },
+            { 44142606, 4486100, 1771069, 4213421, 59587262, 21432927, 37666406, 13545457, 61722920, 29421723 },
+            { 5156879, 15914319, 17130025, 2405563, 15221945, 15793947, 37459457, 22238244, 6548880, 15323806 },
+        },
+        {
+            { 98202, 12526203, 23388091, 19784704, 56564119, 11154436, 47728815, 4827744, 40663395, 24662803 },
+            { 806128, 27927790, 48158559, 22684095, 611713, 15177840, 55219378, 12117501, 18070753, 30395282 },
+            { 37386372, 1649007, 33356684, 19095741, 45769474, 20970611, 6989696, 18719254, 63191602, 3448228 },
+        },
+        {
+            { 28098523, 4590322, 55552278, 16143618, 60693931, 7221474, 37772235, 12433535, 51062635, 17143621 },
+            { 12627852, 7339507, 21087744, 27827987, 2423507, 28551581, 29152297, 4678080, 61537840, 20788966 },
+            { 66070903, 4565502, 42853487, 2175822, 5845017, 33291495, 39582668, 4442103, 58880986, 262979 },
+        },
+        {
+            { 58224486, 5837478, 17167586, 22805884, 53950482, 24546191, 49736802, 10065536, 45194900, 30754153 },
+            { 26097067, 22956421, 65142455, 6205361, 12897871, 28199096, 30389614, 13848171, 15952629, 19363097 },
+            { 6651276, 31293895, 1432723, 9202292, 54340022, 18972289, 42424269, 31439511, 20338883, 23358950 },
+        },
+        {
+            { 30860883, 5219556, 5780784, 9399798, 45812951, 19258898, 32898254, 367728, 9619153, 32407590 },
+            { 14139961, 2235959, 56356867, 21399093, 20371764, 31354842, 65855473, 22316813, 45371559, 8250296 },
+            { 54093792, 26465769, 38441050, 12161720, 36414718, 16110579, 58660859, 12226665, 45138593, 1105014 },
+        },
+        {
+            { 45442679, 11139772, 62751814, 16187117, 24699302, 2423987, 43326100, 28242141, 17501352, 32580538 },
+            { 42263165, 28379013, 13729793, 5792687, 6964, 28284546, 35872052, 22461353, 55313992, 33001742 },
+            { 44644643, 27810783, 19923755, 16255878, 11764052, 2791963, 11458919, 28518559, 10076165, 10374935 },
+        },
+        {
+            { 64317359, 1377282, 51629486, 18871640, 1642293, 8794396, 40573553, 952706, 50498990, 23202223 },
+            { 65766943, 8094072, 50172383, 17856028, 4514268, 2488947, 62683515, 222644, 60285220, 19515642 },
+            { 11007503, 17148576, 20314724, 8406654, 11457373, 17320384, 48638176, 16662895, 63556121, 15589265 },
+        },
+        {
+            { 10942978, 793973, 65416992, 15907757, 65629934, 24140146, 15466686, 32101723, 43051189, 3877507 },
+            { 26071587, 3881462, 22029393, 28135827, 47563413, 8823454, 10670229, 22262595, 23299357, 19357106 },
+            { 54850707, 8107079, 36562474, 12084831, 8147833, 13913728, 27234039, 26532911, 28642836, 16143889 },
+        },
+        {
+            { 774226, 23815727, 36509162, 27220638, 26038721, 10248128, 46066141, 5534604, 37250109, 31041782 },
+            { 64628046, 21599374, 1246286, 9022034, 3893763, 32560180, 51331162, 31312209, 62055479, 14119937 },
+            { 61623312, 4501191, 23540219, 4993818, 9008207, 6510930, 25473625, 20801396, 19206350, 26426116 },
+        },
+        {
+            { 65341693, 6103487, 34781604, 21835349, 50097162, 5930112, 15334942, 2096594, 40489922, 16476579 },
+            { 6857890, 20381891, 66096189, 27716635, 11420031, 23284645, 1364646, 24655752, 40514272, 6276700 },
+            { 43835039, 27329321, 10594471, 24475714, 11296682, 13107477, 38985190, 21440849, 49517627, 31091256 },
+        },
+        {
+            { 26472551, 21175825, 56535315, 22053033, 23491854, 33212502, 63690635, 21870378, 22002364, 25870244 },
+            { 58020383, 24567372, 45612252, 4320616, 55417197, 29664587, 1224859, 26923384, 6208420, 10139768 },
+            { 61053405, 13464155, 59070141, 24249888, 32395601, 14914799, 34839767, 14330873, 19189941, 17865413 },
+        },
+        {
+            { 12559374, 3127981, 3879308, 20948066, 46628774, 27518993, 34311989, 27452081, 44751032, 15561263 },
+            { 50674096, 17367396, 28083214, 14714924, 56541730, 30084557, 44378314, 18542925, 12835513, 4479903 },
+            { 27435334, 31950852, 65440113, 14402381, 54051373, 25487056, 19565073, 21859257, 62200602, 31076114 },
+        },
+        {
+            { 33293455, 21182590, 63208099, 15828173, 62606317, 4055109, 33525869, 21140963, 51299104, 19469731 },
+            { 40184703, 17656470, 64148716, 17727160, 36538725, 4789526, 18053628, 524572, 11927999, 6427867 },
+            { 13411575, 28433372, 50315069, 17880538, 6948806, 31721431, 43305306, 8025299, 29380962, 12890081 },
+        },
+        {
+            { 15670850, 20086137, 30782783, 395178, 62194025, 22424595, 60049322, 32712180, 8087036, 17736379 },
+            { 5854438, 21880413, 45120064, 20519708, 33859257, 33464294, 45981329, 952943, 41671064, 19978683 },
+            { 40237359, 1113149, 53282018, 17121315, 51927647, 30652257, 59340172, 25596648, 54924403, 17029755 },
+        },
+        {
+            { 25126613, 25655182, 52799257, 20732500, 30118225, 33028318, 65443262, 76544, 57774713, 27279041 },
+            { 54035560, 18360569, 14659596, 11827853, 46335167, 32733802, 49793829, 25851211, 21307335, 30643167 },
+            { 54006383, 27575817, 8099492, 10135194, 19836259, 20385059, 22293261, 19099699, 66813529, 25585903 },
+        },
+        {
+            { 48413295, 26334570, 36400030, 28770663, 34533984, 1525457, 52163886, 17186225, 50076529, 14055952 },
+            { 504555, 16300482, 43963743, 12075191, 45908404, 29353331, 16488014, 26529015, 35758441, 25057779 },
+            { 59129609, 14564039, 62918455, 33189399, 20535412, 21097626, 2796929, 25658518, 43990360, 2253179 },
+        },
+        {
+            { 32611171, 9229434, 12879951, 15749642, 7489103, 17756139, 41917122, 33371756, 20941496, 32951427 },
+            { 122785, 15678575, 53272957, 2861095, 41976878, 13381393, 53514940, 6068715, 1305882, 29032139 },
+            { 20903424, 5096133, 32808743, 21937653, 5347620, 11999708, 62144474, 21088283, 52625997, 9384340 },
+        },
+        {
+            { 4054409, 23398094, 50233981, 28398199, 7564672, 22193634, 2965820, 15404623, 7966790, 27253513 },
+            { 28370225, 7850181, 14819840, 24331683, 9444304, 22694111, 49324538, 1456654, 14394590, 19902162 },
+            { 44790522, 11442547, 28000135, 19838928, 9743273, 8651949, 48258338, 16788449, 23394738, 6783834 },
+        },
+        {
+            { 46313467, 19826305, 46601155, 21250361, 41729836, 17854239, 11123914, 27779736, 23510130, 10726520 },
+            { 10636053, 13288792, 45117297, 3212400, 58777457, 7990544, 9970448, 9571624, 31812053, 729822 },
+            { 40438091, 14352859, 352374, 17931075, 66759186, 6464584, 26436328, 4416180, 65872697, 949116 },
+        },
+        {
+            { 60051133, 21146738, 1391545, 1185830, 13622638, 5441171, 60545119, 33375515, 38808354, 25058705 },
+            { 32660938, 11107674, 37584695, 52436, 18741312, 7578157, 8397524, 5374887, 14324259, 30797395 },
+            { 35967272, 22905883, 38728379, 33046308, 4362860, 9107898, 56955874, 14965887, 6636434, 15445880 },
+        },
+        {
+            { 11343904, 13176809, 2887768, 4877111, 54765460, 31485762, 27399029, 9302376, 39114833, 18144692 },
+            { 40663607, 13286905, 67017024, 6622515, 11964431, 14339819, 5386236, 609342, 52191546, 13074165 },
+            { 64971110, 19523496, 39242115, 15803073, 34276170, 32171340, 27013332, 27815028, 63586356, 25926130 },
+        },
+    },
+    {
+        {
+            { 11374242, 12660715, 17861383, 21013599, 10935567, 1099227, 53222788, 24462691, 39381819, 11358503 },
+            { 54378055, 10311866, 1510375, 10778093, 64989409, 24408729, 32676002, 11149336, 40985213, 4985767 },
+            { 48012542, 341146, 60911379, 33315398, 15756972, 24757770, 66125820, 13794113, 47694557, 17933176 },
+        },
+        {
+            { 17747446, 10039260, 19368299, 29503841, 46478228, 17513145, 31992682, 17696456, 37848500, 28042460 },
+            { 31932008, 28568291, 47496481, 16366579, 22023614, 88450, 11371999, 29810185, 4882241, 22927527 },
+            { 29796488, 37186, 19818052, 10115756, 55279832, 3352735, 18551198, 3272828, 61917932, 29392022 },
+        },
+        {
+            { 28425966, 27718999, 66531773, 28857233, 52891308, 6870929, 7921550, 26986645, 26333139, 14267664 },
+            { 56041645, 11871230, 27385719, 22994888, 62522949, 22365119, 10004785, 24844944, 45347639, 8930323 },
+            { 45911060, 17158396, 25654215, 31829035, 12282011, 11008919, 1541940, 4757911, 40617363, 17145491 },
+        },
+        {
+            { 24579768, 3711570, 1342322, 22374306, 40103728, 14124955, 44564335, 14074918, 21964432, 8235257 },
+            { 60580251, 31142934, 9442965, 27628844, 12025639, 32067012, 64127349, 31885225, 13006805, 2355433 },
+            { 50803946, 19949172, 60476436, 28412082, 16974358, 22643349, 27202043, 1719366, 1141648, 20758196 },
+        },
+        {
+            { 37210315, 10468803, 55519480, 9292687, 52808360, 17552182, 21586883, 945403, 11163707, 15669892 },
+            { 31206520, 15824593, 16020985, 1311600, 11901613, 18681950, 17190048, 20972874, 36367312, 16736695 },
+            { 57913035, 17785021, 13803590, 19987782, 53527313, 27679244, 51081104, 8751993, 57229443, 21797682 },
+        },
+        {
+            { 13818433, 33318056, 61724740, 27489984, 64579957, 29864077, 41055840, 6764058, 21868286, 20265729 },
+            { 30168086, 8879691, 8082410, 20908532, 49048412, 1925828, 36719081, 18852706, 45403594, 13481125 },
+            { 20368198, 29299801, 56989850, 18531975, 6143432, 18332713, 22947777, 26680478, 52840559, 5738077 },
+        },
+        {
+            { 63338752, 21992361, 57848361, 10016489, 45383174, 5115819, 23891454, 31807629, 41897809, 9032829 },
+            { 1787335, 11391558, 5886665, 12683293, 60262716, 18956364, 47438617, 31589710, 22825755, 12694491 },
+            { 33951444, 14270088, 4920710, 22678367, 26741607, 22171118, 23619815, 25557760, 19219336, 29816249 },
+        },
+        {
+            { 61220352, 828559, 66089103, 13184163, 25007774, 21496788, 6882751, 29070952, 62931443, 26042728 },
+            { 21329464, 2335990, 20644175, 1930420, 56815309, 32391427, 15310865, 28790024, 54737184, 4184911 },
+            { 26287248, 13875740, 41814500, 13003275, 7041512, 17215295, 42960689, 20033689, 37163595, 12870103 },
+        },
+        {
+            { 1084355, 33339814, 50381793, 8496968, 9084063, 16239221, 12032273, 16542902, 29348189, 344559 },
+            { 24560414, 14945001, 59061724, 26829073, 23182461, 18717946, 56584298, 8818117, 17813773, 20552368 },
+            { 63182233, 6011282, 37889543, 8399715, 51847769, 29593899, 2092783, 7373662, 23171764, 17710703 },
+        },
+        {
+            { 13444911, 9836395, 23682438, 2222404, 18818652, 23529128, 14581960, 23200973, 53645696, 356411 },
+            { 65096205, 1475314, 54929102, 27983414, 44523583, 29294032, 3501931, 13372947, 13208996, 17110041 },
+            { 64000871, 2761261, 5801138, 5962570, 43035492, 15584129, 7363601, 16097392, 1078139, 22776171 },
+        },
+        {
+            { 40600976, 7646720, 38073856, 7592170, 32568209, 23817495, 45078078, 22928132, 30474696, 25997655 },
+            { 2781153, 29712397, 27020591, 19336993, 33059880, 4657864, 28164594, 23935349, 24375165, 11676026 },
+            { 56837570, 28337377, 2926746, 20505276, 37539773, 9598054, 11901939, 598381, 36379162, 15296905 },
+        },
+        {
+            { 46995328, 6754494, 60473594, 15928239, 55901041, 11137389, 29475692, 21523206, 15550952, 5759673 },
+            { 5369604, 25110572, 27571709, 11584708, 47374981, 17929736, 60715320, 718583, 49513265, 6722706 },
+            { 57733, 21623609, 44351609, 1972472, 13986911, 18533088, 47288033, 406994, 26790316, 14261482 },
+        },
+        {
+            { 34663675, 2566355, 23529137, 13003755, 20318355, 22355446, 60959041, 19410968, 27134135, 7575197 },
+            { 23373170, 29635630, 11272593, 28267438, 42719132, 12823366, 35648442, 24477254, 46279733, 17904936 },
+            { 11957902, 26975823, 46146194, 10657190, 19638080, 1803064, 20654157, 20548921, 3185740, 33479098 },
+        },
+        {
+            { 50283917, 15871189, 62497439, 13345484, 15076893, 16442305, 4514483, 13685985, 58414432, 33356771 },
+            { 19209683, 24356479, 65049682, 21531501, 56744610, 25436389, 38918410, 30035332, 11608073, 13154738 },
+            { 33828345, 13840682, 22225567, 10774340, 39885410, 4150556, 22366803, 4481197, 19878688, 31424932 },
+        },
+        {
+            { 46553143, 5236424, 27135912, 31737673, 61802260, 23133297, 1266274, 27751435, 20987135, 14030620 },
+            { 14243923, 22854008, 36070614, 1654216, 52834063, 24822185, 3574227, 15790094, 64864551, 9134566 },
+            { 44476109, 27292813, 23724837, 23969618, 27874245, 18745945, 663316, 7855995, 39509344, 16080188 },
+        },
+        {
+            { 8250230, 25779129, 47994231, 30102561, 19449275, 18508087, 37354831, 12881721, 52443094, 9516828 },
+            { 66651739, 8260339, 19961735, 25951458, 60005972, 6355401, 18584483, 29931146, 57135727, 921837 },
+            { 30104170, 27060986, 16307509, 33539099, 42057945, 27800295, 20081964, 12462670, 44271889, 17833563 },
+        },
+        {
+            { 23241403, 7278380, 49908519, 19067996, 18556522, 24952566, 53282552, 28964003, 20976802, 23040241 },
+            { 32647164, 1420817, 24190147, 10350549, 32809921, 6894923, 64824432, 28102545, 58680763, 25605516 },
+            { 57977988, 30968293, 7367972, 4138199, 7908177, 26571398, 63730661, 29575382, 31018325, 15308767 },
+        },
+        {
+            { 62943393, 16475558, 26063285, 14552550, 17360507, 2058569, 13883158, 31643757, 48788541, 3799579 },
+            { 56075958, 1393937, 12295232, 16431309, 26394598, 13665766, 46201697, 6415747, 18650838, 32327878 },
+            { 784807, 24480169, 66644888, 17875629, 66259715, 26389335, 64055900, 2647502, 1306126, 23654251 },
+        },
+        {
+            { 36969726, 11509050, 7232870, 7162609, 42529862, 10680185, 55517358, 26944779, 59697329, 12105459 },
+            { 43048526, 31748374, 44167750, 11763184, 49871390, 25959575, 59028581, 4677073, 13708090, 9495219 },
+            { 41785112, 17696151, 40615522, 3254808, 42342956, 5200193, 28013286, 9421228, 27588636, 17339599 },
+        },
+        {
+            { 27686856, 19123903, 15498585, 9458378, 4682326, 6289606, 37189790, 10868053, 60844241, 6580585 },
+            { 11527618, 23976286, 14247767, 26471047, 17758654, 29095438, 36970092, 28589382, 12167163, 15585355 },
+            { 15942866, 14798707, 63523191, 6188121, 33624216, 24668448, 9433873, 6436284, 54116773, 18362830 },
+        },
+        {
+            { 15791350, 281385, 65105806, 27938470, 24487274, 12756585, 1706382, 9811577, 31456110, 17704096 },
+            { 11801582, 1314226, 66894287, 22980545, 27703601, 19047530, 41596360, 28685470, 37715547, 4975180 },
+            { 50423393, 21700483, 4699214, 26701965, 56496604, 31127464, 16228456, 23849659, 53026774, 25950524 },
+        },
+        {
+            { 32369563, 24930592, 27616838, 8807182, 38680581, 7569249, 5071897, 30273245, 63220873, 23227458 },
+            { 9088835, 2805536, 47737552, 33018644, 10510925, 30934313, 49432118, 8041469, 19231146, 9809053 },
+            { 34115736, 25175302, 17150343, 33247133, 27739793, 19098327, 4584842, 21379561, 55354309, 7698262 },
+        },
+        {
+            { 23881011, 32254638, 53393241, 22957708, 29847549, 29359055, 50217410, 14880454, 26028940, 19863869 },
+            { 25193315, 33523972, 66800639, 12860474, 56450712, 21553566, 49052401, 1719511, 5659667, 22614350 },
+            { 2911809, 16198940, 20998442, 3089175, 25152772, 27105195, 21966784, 7685256, 28401885, 11652283 },
+        },
+        {
+            { 13663147, 8948528, 39447298, 30747045, 18608838, 27674829, 30755714, 22094530, 19818245, 5683096 },
+            { 39769689, 14249923, 42962975, 15426006, 672629, 26455777, 42470727, 18725616, 25194727, 25633950 },
+            { 59183571, 3365425, 21068135, 32059424, 5589463, 2614683, 65101164, 11137009, 54038242, 2461597 },
+        },
+        {
+            { 31229318, 9015297, 43474352, 30869681, 5468970, 14051402, 26963046, 26036756, 24991658, 26964043 },
+            { 35427521, 26197936, 30354229, 23271699, 33288703, 9623615, 6691012, 2059119, 40889003, 28755974 },
+            { 27342920, 20751908, 14996450, 5797295, 30717687, 13054865, 226771, 27682349, 48095984, 29346363 },
+        },
+        {
+            { 27379050, 4194663, 40022304, 7043399, 23861400, 3811025, 37970859, 24378738, 65886055, 15142357 },
+            { 10217035, 21016207, 34195010, 14487849, 41232611, 28496955, 46022678, 15664757, 21803752, 20094156 },
+            { 53935798, 20699065, 42158539, 23200855, 22903705, 2311002, 16067670, 28061993, 41744952, 10935798 },
+        },
+        {
+            { 54248780, 12142202, 30727739, 33003536, 35522598, 16756821, 473899, 26450320, 25780020, 1960727 },
+            { 11490309, 18528616, 57983294, 9643555, 16219067, 20786358, 63937207, 2914433, 23306259, 6761912 },
+            { 26379367, 13324915, 10844683, 1858502, 38003233, 5215061, 6869041, 4791630, 30392263, 10697757 },
+        },
+        {
+            { 35396728, 8143773, 34028108, 30177714, 23716943, 28400104, 14390686, 16650364, 58008365, 18405788 },
+            { 24113549, 28209454, 25784277, 11960072, 33833233, 13654592, 7723457, 19919661, 17713746, 5191478 },
+            { 4953861, 5794837, 8861628, 2147745, 30270316, 3207516, 53926061, 29539108, 58093888, 26161321 },
+        },
+        {
+            { 66842803, 20633367, 25708168, 9770456, 57674931, 4739328, 21252865, 23644635, 1585018, 2848708 },
+            { 33156288, 5814992, 41992705, 27855948, 41426696, 5903691, 10488928, 30508233, 26522953, 12195090 },
+            { 52552366, 7413773, 56691548, 17293291, 37436115, 18900414, 18728450, 20750426, 10931351, 28017687 },
+        },
+        {
+            { 10232466, 21643619, 35538881, 21583249, 28186435, 17168505, 21597280, 7750870, 63532952, 24985679 },
+            { 5707284, 3380857, 46030300, 23150779, 33460955, 3864642, 35206179, 29839964, 44063029, 22086736 },
+            { 842948, 26141409, 44216907, 4923146, 3726600, 28931331, 52882196, 9582183, 36458817, 6599319 },
+        },
+        {
+            { 37985303, 13798315, 19878731, 5992354, 53945029, 702847, 33563573, 9464937, 14582738, 25161760 },
+            { 58944838, 30793517, 41293886, 20641791, 15327632, 17951896, 27404681, 2976412, 34049395, 13945398 },
+            { 32029034, 33353168, 58802940, 12319599, 24257359, 1780332, 53443432, 24095036, 22515003, 31967896 },
+        },
+        {
+            { 58243953, 413023, 45550832, 7779847, 55326333, 7782698, 42593363, 9819656, 18554526, 27484534 },
+            { 43763452, 32991502, 22104074, 28927102, 7987515, 12405169, 7210918, 24891298, 54452521, 11999455 },
+            { 59281033, 19037506, 7123414, 12174108, 17334422, 9281553, 30699002, 2519320, 64378107, 3278962 },
+        },
+    },
+    {
+        {
+            { 793280, 24323954, 8836301, 27318725, 39747955, 31184838, 33152842, 28669181, 57202663, 32932579 },
+            { 5666214, 525582, 20782575, 25516013, 42570364, 14657739, 16099374, 1468826, 60937436, 18367850 },
+            { 62249590, 29775088, 64191105, 26806412, 7778749, 11688288, 36704511, 23683193, 65549940, 23690785 },
+        },
+        {
+            { 43627235, 4867225, 39861736, 3900520, 29838369, 25342141, 35219464, 23512650, 7340520, 18144364 },
+            { 4646495, 25543308, 44342840, 22021777, 23184552, 8566613, 31366726, 32173371, 52042079, 23179239 },
+            { 49838347, 12723031, 50115803, 14878793, 21619651, 27356856, 27584816, 3093888, 58265170, 3849920 },
+        },
+        {
+            { 49773116, 24447374, 42577584, 9434952, 58636780, 32971069, 54018092, 455840, 20461858, 5491305 },
+            { 13669229, 17458950, 54626889, 23351392, 52539093, 21661233, 42112877, 11293806, 38520660, 24132599 },
+            { 28497909, 6272777, 34085870, 14470569, 8906179, 32328802, 18504673, 19389266, 29867744, 24758489 },
+        },
+        {
+            { 38476072, 12763727, 46662418, 7577503, 33001348, 20536687, 17558841, 25681542, 23896953, 29240187 },
+            { 47103464, 21542479, 31520463, 605201, 2543521, 5991821, 64163800, 7229063, 57189218, 24727572 },
+            { 28816026, 298879, 38943848, 17633493, 19000927, 31888542, 54428030, 30605106, 49057085, 31471516 },
+        },
+        {
+            { 49033867, 30604764, 18508182, 26166427, 67089987, 8802067, 52433338, 29486390, 45591740, 16506630 },
+            { 52215021, 19737297, 17234467, 18659555, 24356872, 15424511, 4255716, 26305154, 59875612, 5880932 },
+            { 32118458, 23656466, 63173388, 18243642, 39829002, 5564342, 34922034, 10932076, 35197474, 5452626 },
+        },
+        {
+            { 42164607, 6156247, 4728227, 2583055, 59565474, 27911367, 28779889, 13407360, 62097003, 17920595 },
+            { 65873588, 29284665, 47704024, 31631120, 42460503, 14524346, 44639049, 8161089, 742813, 13445044 },
+            { 13576582, 12369038, 24572692, 17672008, 7391516, 22667200, 52457363, 18772455, 43737802, 10953320 },
+        },
+        {
+            { 12537000, 9586916, 30794582, 13437793, 61304640, 9417527, 8930996, 27972268, 57996360, 16748978 },
+            { 49790629, 23490317, 22118586, 18462596, 18841425, 20994485, 14812429, 13594971, 56989572, 32150960 },
+            { 49578831, 18617209, 49167014, 17903158, 45212709, 18763940, 31097065, 8701514, 1375133, 17561316 },
+        },
+        {
+            { 55528004, 26487725, 48856645, 22437963, 5236679, 9183541, 9555739, 29336616, 45332190, 16236806 },
+            { 55339741, 19273661, 12010219, 7718535, 25699388, 7081486, 58976950, 21903733, 22999792, 27616316 },
+            { 8261526, 12422694, 52624918, 9652374, 2711069, 8531175, 50424423, 5992277, 12694564, 31043219 },
+        },
+        {
+            { 49467237, 1458757, 54810271, 9044902, 21310639, 9891413, 22789118, 7795935, 6791436, 15346817 },
+            { 31167330, 12923699, 31068254, 2033816, 59510717, 17652911, 63713310, 11106574, 9820037, 20106259 },
+            { 38163614, 12496973, 25094576, 25193760, 54197459, 11211651, 11216120, 21418510, 37651406, 19678499 },
+        },
+        {
+            { 15578374, 17643684, 52427125, 31756559, 50429990, 25011907, 40668047, 27889965, 28622319, 14906364 },
+            { 42831288, 32535152, 45786926, 29074103, 32312998, 17877338, 39811971, 4257411, 31566889, 23026450 },
+            { 45612926, 21516452, 21530351, 19774579, 11283189, 28298795, 4150945, 12197217, 29569769, 27009956 },
+        },
+        {
+            { 33047698, 15431988, 32787807, 19787163, 10729504, 2619328, 12313875, 12561585, 54499598, 18050062 },
+            { 65333780, 3739400, 56390570, 32736143, 27845503, 18504129, 18446553, 18967304, 50289060, 15377621 },
+            { 61210957, 3275644, 9466939, 23722661, 62408734, 21966723, 18174784, 18884786, 8263696, 16819640 },
+        },
+        {
+            { 10163221, 15697881, 17525856, 4737646, 56856048, 14581414, 5530477, 24583473, 22578167, 4415620 },
+            { 9487442, 13492222, 8834459, 24712580, 23504091, 6863313, 42720907, 19336735, 49599191, 23847636 },
+            { 21256938, 9329168, 34436709, 14453337, 39850414, 20280049, 40367029, 8594157, 56885046, 12535721 },
+        },
+        {
+            { 35363885, 10412758, 25504215, 6920559, 6874357, 7241121, 8311690, 18614129, 13358670, 2873840 },
+            { 26181786, 30187369, 10391385, 26255722, 9798036, 16726843, 13697022, 32525307, 50429298, 16780904 },
+            { 37669301, 13106745, 20921171, 19912579, 12262320, 27129196, 44541764, 22698176, 62744103, 14504937 },
+        },
+        {
+            { 33429851, 2153666, 33458510, 23236019, 63024763, 13495571, 19927767, 2941694, 17567318, 32853310 },
+            { 50486830, 28802421, 50605051, 22416178, 39627583, 12116680, 33418611, 22691954, 34009775, 9349266 },
+            { 24200245, 22328142, 26907979, 14399675, 38780121, 3705389, 54890924, 13011639, 39491788, 20258935 },
+        },
+        {
+            { 41537868, 17105373, 17826881, 30951737, 59567568, 7311052, 10542511, 17592418, 4003513, 5030576 },
+            { 16025203, 499743, 26131257, 18851771, 25012916, 21048828, 20858336, 26407592, 42627085, 3548716 },
+            { 37845070, 26197607, 54997039, 24371142, 16384145, 12555499, 62660661, 22499591, 48832414, 8939998 },
+        },
+        {
+            { 13984054, 11119373, 49257490, 19579093, 18225786, 14930027, 1770017, 6594115, 18144796, 2245320 },
+            { 43383263, 29505389, 55340670, 7570615, 22690058, 24609120, 60052478, 8011038, 10219948, 6259143 },
+            { 61085000, 1766392, 4674854, 5960310, 50129095, 22050242, 8159920, 3073870, 47381278, 21160071 },
+        },
+        {
+            { 65314346, 9683262, 41005407, 32853230, 4475372, 22010878, 1231296, 29265495, 56391920, 26590399 },
+            { 16174515, 2210231, 9105878, 31927207, 43375274, 24729015, 1826115, 22716343, 35594755, 20361203 },
+            { 21221110, 28937890, 12116207, 27737981, 54498788, 1887455, 44584749, 23940835, 61367658, 3291830 },
+        },
+        {
+            { 47207697, 689094, 11155117, 23861685, 47293912, 10132135, 6951351, 22648942, 6600693, 33458035 },
+            { 18597858, 29947428, 57917176, 29228226, 59676765, 6100947, 55638505, 30024342, 50105334, 18685394 },
+            { 9747677, 20809716, 44086096, 10582686, 40297579, 12102063, 50405894, 21847526, 46592693, 4240603 },
+        },
+        {
+            { 63984002, 8110455, 1304020, 14790441, 19244697, 6474151, 40251054, 16954502, 14028795, 12497402 },
+            { 8099419, 11123189, 9401446, 9828407, 40338825, 25378966, 20232358, 9104905, 37708409, 17560959 },
+            { 38072350, 24947925, 39034954, 1382195, 49843106, 17519499, 60063253, 28398087, 6069168, 24666431 },
+        },
+        {
+            { 51970479, 9041762, 54927617, 9213617, 45557844, 27407918, 41628705, 22681535, 58126337, 4044229 },
+            { 14411077, 26679941, 34968321, 22420264, 17824615, 2514715, 9194003, 32093034, 54830519, 6267919 },
+            { 19713351, 15844104, 44101168, 12595140, 13699640, 9241529, 49331518, 11674303, 60896276, 26476174 },
+        },
+        {
+            { 8254872, 7089944, 3754392, 7844505, 21157199, 13040948, 3833166, 15292039, 18073178, 27370 },
+            { 7957588, 26870502, 25826038, 1866705, 61643387, 30604756, 48187338, 6762338, 12981776, 21939005 },
+            { 57469541, 5931055, 17498505, 9147610, 35023403, 6617644, 27803361, 28514374, 33014701, 19034934 },
+        },
+        {
+            { 21202175, 32198874, 26098992, 25616793, 24954209, 8737933, 49174914, 9846531, 59395737, 11962191 },
+            { 29483312, 1134961, 17409674, 27634853, 8133714, 29355998, 43844434, 7678506, 24379502, 8168629 },
+            { 21769648, 8310300, 46739695, 25397690, 34126340, 8497034, 58074559, 25816871, 34251467, 23614349 },
+        },
+        {
+            { 12236327, 3085587, 26081272, 25255975, 58060349, 7215158, 60151162, 223955, 7642428, 19711417 },
+            { 46756792, 23639731, 19730974, 13528774, 9588924, 31950019, 58520513, 8777228, 28941532, 2228302 },
+            { 597735, 14062685, 5151735, 28907234, 58503454, 25456171, 26582109, 13626157, 18110531, 1838286 },
+        },
+        {
+            { 50928801, 13373879, 62561873, 29393532, 24353361, 24558300, 59751650, 31115427, 44320637, 8703848 },
+            { 56421714, 6950427, 13645548, 24241058, 31024619, 952004, 58865586, 8574237, 21921225, 9071516 },
+            { 20794344, 32049864, 3349675, 12880513, 55740996, 29088360, 43242858, 10593321, 19241855, 14927627 },
+        },
+        {
+            { 48515993, 7412889, 11981564, 16306276, 36691694, 21345615, 4189542, 14934999, 37829525, 33434987 },
+            { 26112625, 5600745, 17610248, 3737941, 58175104, 25692988, 606817, 18202021, 25163239, 32022993 },
+            { 19788169, 29493304, 41436769, 26856441, 27695721, 30678533, 42338745, 15056729, 25945968, 9628651 },
+        },
+        {
+            { 10202773, 22241276, 18694021, 22791631, 51228110, 11633164, 32073988, 947419, 53870043, 5484332 },
+            { 64072917, 5316563, 5033914, 23637357, 66326873, 11540770, 50118635, 14542093, 31798503, 12732257 },
+            { 58228706, 11683443, 14428557, 4492473, 21385504, 6106380, 4408706, 27366551, 875525, 31611616 },
+        },
+        {
+            { 46485381, 25780075, 52754015, 4530590, 27979269, 23844854, 64506779, 20605802, 51201885, 20005246 },
+            { 21717527, 21983500, 10733684, 20590533, 64191179, 19192800, 56014809, 14967581, 21400483, 30422258 },
+            { 873529, 5277414, 27185951, 22237581, 60587814, 16265912, 53694616, 7618515, 36549530, 11552304 },
+        },
+        {
+            { 65798593, 28632908, 47023538, 19370760, 61483708, 22896748, 22195383, 1936948, 12891342, 10593735 },
+            { 43814221, 30057512, 25040666, 23973865, 62429814, 16202173, 18602943, 1953225, 27406071, 18970592 },
+            { 37525508, 29923625, 54012659, 31198035, 62910900, 17408482, 37456949, 17647992, 48766014, 12668294 },
+        },
+        {
+            { 20840953, 25577066, 9621080, 2790308, 58619469, 20919463, 42258875, 6281208, 52625116, 7635511 },
+            { 15241089, 31037793, 65874318, 32419937, 32441927, 27139540, 9801821, 8626109, 15568526, 30231239 },
+            { 3493269, 550470, 24120483, 9113200, 62556272, 4057451, 34275441, 27482476, 2760914, 2591845 },
+        },
+        {
+            { 12428209, 17804525, 50093490, 19105110, 53037765, 17939412, 37945036, 16579241, 11516957, 15239857 },
+            { 37087518, 17411362, 31074321, 14056152, 53285346, 25981457, 32217393, 8967734, 29438891, 33016715 },
+            { 27007252, 21851693, 17053376, 31560544, 35950845, 24296343, 7180697, 5582348, 34884721, 31681540 },
+        },
+        {
+            { 22342968, 5905551, 10383644, 31189701, 9055207, 30637275, 48962442, 30321408, 25812845, 19636289 },
+            { 9614402, 835528, 45712061, 32742643, 48739071, 15138382, 65157914, 29787508, 7327714, 29495608 },
+            { 24928707, 15836251, 12238746, 4178219, 60560290, 31558330, 23516662, 27828874, 15545804, 29181169 },
+        },
+        {
+            { 7109124, 20825664, 14204597, 32005370, 44277212, 9858859, 29659593, 30498701, 13211883, 5818616 },
+            { 21468740, 16671375, 33431100, 773905, 65829167, 12266027, 14669068, 14270641, 33668121, 21000292 },
+            { 1314697, 5765039, 59389287, 26537496, 23438676, 6420552, 48601685, 316822, 5367898, 15923805 },
+        },
+    },
+};
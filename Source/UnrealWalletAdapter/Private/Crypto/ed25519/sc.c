@@ -1,6 +1,11 @@
 #include "fixedint.h"
 #include "sc.h"
 
+#if ED25519_SC64
+    #define sc_reduce sc_reduce_ref
+    #define sc_muladd sc_muladd_ref
+#endif
+
 static uint64_t load_3(const unsigned char *in) {
     uint64_t result;
 
@@ -1,6 +1,25 @@
 #ifndef SC_H
 #define SC_H
 
+
+/*
+    ED25519_SC64 selects the 64 bit limb code in sc64.c, used wherever the
+    compiler gives a 64x64->128 bit multiply. Define it to 0 to force the
+    portable 21 bit limb code in sc.c.
+*/
+
+#ifndef ED25519_SC64
+    #if defined(__SIZEOF_INT128__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64)))
+        #define ED25519_SC64 1
+    #else
+        #define ED25519_SC64 0
+    #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*
 The set of scalars is \Z/l
 where l = 2^252 + 27742317777372353535851937790883648493.
@@ -9,4 +28,14 @@ where l = 2^252 + 27742317777372353535851937790883648493.
 void sc_reduce(unsigned char *s);
 void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b, const unsigned char *c);
 
+#if ED25519_SC64
+/* The code of sc.c, built under these names next to sc64.c for ed25519_sc_self_test to compare with. */
+void sc_reduce_ref(unsigned char *s);
+void sc_muladd_ref(unsigned char *s, const unsigned char *a, const unsigned char *b, const unsigned char *c);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
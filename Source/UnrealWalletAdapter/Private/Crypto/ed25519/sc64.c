@@ -0,0 +1,292 @@
+#include "fixedint.h"
+#include "ed25519.h"
+#include "sc.h"
+
+#if ED25519_SC64
+
+/*
+    Scalar arithmetic on four 64 bit limbs, the counterpart of sc.c.
+
+    Products are taken whole, up to 512 bits, and brought below l by Barrett
+    reduction, shaped by l = 2^252 + delta with delta below 2^125: with
+    mu = 2^512 / l = 2^260 - epsilon, epsilon odd and 133 bits long, the
+    quotient estimate for x is q1 - ceil(q1 epsilon / 2^260) for q1 = x >> 252,
+    at most two short of x / l. x - q l is then below 3l, so only its low 256
+    bits are needed, and q l takes seven products since l has two nonzero low
+    limbs and a single top bit. Loops have fixed bounds and subtractions are
+    masked, so the time taken does not depend on the values.
+*/
+
+static const uint64_t sc_l[4] = {
+    0x5812631a5cf5d3edULL, 0x14def9dea2f79cd6ULL, 0x0000000000000000ULL, 0x1000000000000000ULL
+};
+
+/* 2^260 - 2^512 / l, the latter rounded down. */
+static const uint64_t sc_epsilon[3] = {
+    0x12631a5cf5d3ece5ULL, 0xdef9dea2f79cd658ULL, 0x0000000000000014ULL
+};
+
+
+/*
+    a * b + c + d, which always fits in 128 bits. Returns the low half and
+    leaves the high half in hi.
+*/
+
+#if defined(__SIZEOF_INT128__)
+
+static uint64_t sc_mac(uint64_t *hi, uint64_t a, uint64_t b, uint64_t c, uint64_t d) {
+    const unsigned __int128 t = (unsigned __int128) a * b + c + d;
+
+    *hi = (uint64_t) (t >> 64);
+    return (uint64_t) t;
+}
+
+#else
+
+#include <intrin.h>
+
+static uint64_t sc_mac(uint64_t *hi, uint64_t a, uint64_t b, uint64_t c, uint64_t d) {
+    uint64_t lo;
+    uint64_t h;
+
+#if defined(_M_ARM64)
+    lo = a * b;
+    h = __umulh(a, b);
+#else
+    lo = _umul128(a, b, &h);
+#endif
+
+    lo += c;
+    h += lo < c;
+    lo += d;
+    h += lo < d;
+
+    *hi = h;
+    return lo;
+}
+
+#endif
+
+
+
+static uint64_t sc_load(const unsigned char *in) {
+    return (uint64_t) in[0] | ((uint64_t) in[1] << 8) | ((uint64_t) in[2] << 16) | ((uint64_t) in[3] << 24) |
+        ((uint64_t) in[4] << 32) | ((uint64_t) in[5] << 40) | ((uint64_t) in[6] << 48) | ((uint64_t) in[7] << 56);
+}
+
+
+static void sc_store(unsigned char *out, const uint64_t *a) {
+    int i;
+    int j;
+
+    for (i = 0; i < 4; ++i) {
+        for (j = 0; j < 8; ++j) {
+            out[8 * i + j] = (unsigned char) (a[i] >> (8 * j));
+        }
+    }
+}
+
+
+/* r = a * b, na + nb limbs. */
+static void sc_mul(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb) {
+    uint64_t carry;
+    int i;
+    int j;
+
+    for (j = 0; j < na; ++j) {
+        r[j] = 0;
+    }
+
+    for (i = 0; i < nb; ++i) {
+        carry = 0;
+        for (j = 0; j < na; ++j) {
+            r[i + j] = sc_mac(&carry, a[j], b[i], r[i + j], carry);
+        }
+        r[i + na] = carry;
+    }
+}
+
+
+/* r = a - b modulo 2^256, returns the borrow out. */
+static uint64_t sc_sub(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    uint64_t borrow = 0;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        const uint64_t d = a[i] - b[i];
+        const uint64_t under = a[i] < b[i];
+
+        r[i] = d - borrow;
+        borrow = under | (d < borrow);
+    }
+
+    return borrow;
+}
+
+
+
+/* r = x mod l for a 512 bit x. */
+static void sc_barrett(uint64_t *r, const uint64_t *x) {
+    uint64_t q1[5];
+    uint64_t t[8];
+    uint64_t c[4];
+    uint64_t q[4];
+    uint64_t ql[4];
+    uint64_t sub[4];
+    uint64_t carry;
+    uint64_t mask;
+    int i;
+    int k;
+
+    /* q1 = x >> 252 */
+    for (i = 0; i < 4; ++i) {
+        q1[i] = (x[i + 3] >> 60) | (x[i + 4] << 4);
+    }
+    q1[4] = x[7] >> 60;
+
+    /* c = ceil(q1 epsilon / 2^260): epsilon is odd, so the product has low bits set unless q1 is 0 */
+    sc_mul(t, q1, 5, sc_epsilon, 3);
+    carry = q1[0] | q1[1] | q1[2] | q1[3] | q1[4];
+    carry = (carry | (0 - carry)) >> 63;
+    for (i = 0; i < 4; ++i) {
+        c[i] = (t[i + 4] >> 4) | (i < 3 ? t[i + 5] << 60 : 0);
+        c[i] += carry;
+        carry = c[i] < carry;
+    }
+
+    /* q = q1 - c, of which the low 256 bits are enough for q l modulo 2^256 */
+    sc_sub(q, q1, c);
+
+    /* l = l0 + 2^64 l1 + 2^252 */
+    ql[0] = sc_mac(&carry, q[0], sc_l[0], 0, 0);
+    ql[1] = sc_mac(&carry, q[0], sc_l[1], carry, 0);
+    ql[2] = sc_mac(&carry, q[1], sc_l[1], carry, 0);
+    ql[3] = sc_mac(&carry, q[2], sc_l[1], carry, 0);
+    ql[3] += q[3] * sc_l[0];
+    ql[1] = sc_mac(&carry, q[1], sc_l[0], ql[1], 0);
+    ql[2] = sc_mac(&carry, q[2], sc_l[0], ql[2], carry);
+    ql[3] += carry;
+    ql[3] += q[0] << 60;
+
+    /* x - q l is below 3l */
+    sc_sub(r, x, ql);
+    for (k = 0; k < 2; ++k) {
+        mask = sc_sub(sub, r, sc_l) - 1;
+        for (i = 0; i < 4; ++i) {
+            r[i] ^= (r[i] ^ sub[i]) & mask;
+        }
+    }
+}
+
+
+
+void sc_reduce(unsigned char *s) {
+    uint64_t x[8];
+    uint64_t r[4];
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        x[i] = sc_load(s + 8 * i);
+    }
+    sc_barrett(r, x);
+    sc_store(s, r);
+}
+
+
+void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b, const unsigned char *c) {
+    uint64_t al[4];
+    uint64_t bl[4];
+    uint64_t x[8];
+    uint64_t r[4];
+    uint64_t carry = 0;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        al[i] = sc_load(a + 8 * i);
+        bl[i] = sc_load(b + 8 * i);
+    }
+    sc_mul(x, al, 4, bl, 4);
+
+    /* ab + c stays below 2^512 */
+    for (i = 0; i < 8; ++i) {
+        const uint64_t addend = i < 4 ? sc_load(c + 8 * i) : 0;
+
+        x[i] += addend;
+        x[i] += carry;
+        carry = (x[i] < addend) | (x[i] < carry);
+    }
+
+    sc_barrett(r, x);
+    sc_store(s, r);
+}
+
+#endif
+
+
+
+/*
+    Checks the backend in use against the 21 bit limb code of sc.c on edge
+    cases around l and 2^256 and on a stream of pseudo-random inputs. With
+    only sc.c built there is nothing to compare.
+*/
+
+int ed25519_sc_self_test(void) {
+#if ED25519_SC64
+    static const unsigned char l_bytes[32] = {
+        0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+    };
+    unsigned char in[3][64];
+    unsigned char expected[64];
+    unsigned char actual[64];
+    uint64_t state = 0x9e3779b97f4a7c15ULL;
+    int round;
+    int i;
+    int j;
+
+    for (round = 0; round < 4096; ++round) {
+        for (i = 0; i < 3; ++i) {
+            for (j = 0; j < 64; ++j) {
+                /* xorshift64 */
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                in[i][j] = (unsigned char) state;
+            }
+        }
+
+        /* the first rounds sit on the edges: 0, all ones, then l - 2 to l + 3 */
+        if (round < 8) {
+            for (i = 0; i < 3; ++i) {
+                for (j = 0; j < 64; ++j) {
+                    in[i][j] = round == 0 ? 0 : round == 1 ? 0xff : j < 32 ? l_bytes[j] : 0;
+                }
+                if (round >= 2) {
+                    in[i][0] += (unsigned char) (round - 4);
+                }
+            }
+        }
+
+        for (j = 0; j < 64; ++j) {
+            expected[j] = actual[j] = in[0][j];
+        }
+        sc_reduce_ref(expected);
+        sc_reduce(actual);
+        for (j = 0; j < 32; ++j) {
+            if (expected[j] != actual[j]) {
+                return 0;
+            }
+        }
+
+        sc_muladd_ref(expected, in[0], in[1], in[2]);
+        sc_muladd(actual, in[0], in[1], in[2]);
+        for (j = 0; j < 32; ++j) {
+            if (expected[j] != actual[j]) {
+                return 0;
+            }
+        }
+    }
+#endif
+
+    return 1;
+}
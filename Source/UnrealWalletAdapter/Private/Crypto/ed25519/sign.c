@@ -3,22 +3,22 @@
 #include "ge.h"
 #include "sc.h"
 
-void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *private_key) {
+void ed25519_expand_private_key(unsigned char *expanded, const unsigned char *private_key) {
+    ed_sha512(private_key, 32, expanded);
+    expanded[0] &= 248;
+    expanded[31] &= 127;
+    expanded[31] |= 64;
+}
+
+
+void ed25519_sign_expanded(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *expanded) {
     sha512_context hash;
-    unsigned char az[64];
     unsigned char hram[64];
     unsigned char r[64];
     ge_p3 R;
 
     ed_sha512_init(&hash);
-    ed_sha512_update(&hash, private_key, 32);
-    ed_sha512_final(&hash, az);
-    az[0] &= 248;
-    az[31] &= 127;
-    az[31] |= 64;
-    
-    ed_sha512_init(&hash);
-    ed_sha512_update(&hash, az + 32, 32);
+    ed_sha512_update(&hash, expanded + 32, 32);
     ed_sha512_update(&hash, message, message_len);
     ed_sha512_final(&hash, r);
 
@@ -28,10 +28,71 @@ void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t
     
     ed_sha512_init(&hash);
     ed_sha512_update(&hash, signature, 32);
-    ed_sha512_update(&hash, private_key + 32, 32);
+    ed_sha512_update(&hash, public_key, 32);
     ed_sha512_update(&hash, message, message_len);
     ed_sha512_final(&hash, hram);
 
     sc_reduce(hram);
-    sc_muladd(signature + 32, hram, az, r);
+    sc_muladd(signature + 32, hram, expanded, r);
+}
+
+
+/*
+Hashes for four signatures at once: the nonces r_i = SHA-512(prefix || M_i), the R_i from them,
+then h_i = SHA-512(R_i || A || M_i), the same for the rest done one by one.
+*/
+
+void ed25519_sign_expanded_many(unsigned char *signatures, const unsigned char *const *messages, const size_t *message_lens, size_t count, const unsigned char *public_key, const unsigned char *expanded) {
+    sha512_parts parts[4];
+    unsigned char r[4][64];
+    unsigned char hram[4][64];
+    ge_p3 R;
+    size_t i = 0;
+    int j;
+
+    for (; i + 4 <= count; i += 4) {
+        for (j = 0; j < 4; ++j) {
+            parts[j].parts[0] = expanded + 32;
+            parts[j].lens[0] = 32;
+            parts[j].parts[1] = messages[i + j];
+            parts[j].lens[1] = message_lens[i + j];
+            parts[j].parts[2] = NULL;
+            parts[j].lens[2] = 0;
+        }
+
+        ed_sha512_x4(parts, r);
+
+        for (j = 0; j < 4; ++j) {
+            unsigned char *signature = signatures + 64 * (i + j);
+
+            sc_reduce(r[j]);
+            ge_scalarmult_base(&R, r[j]);
+            ge_p3_tobytes(signature, &R);
+
+            parts[j].parts[0] = signature;
+            parts[j].parts[1] = public_key;
+            parts[j].lens[1] = 32;
+            parts[j].parts[2] = messages[i + j];
+            parts[j].lens[2] = message_lens[i + j];
+        }
+
+        ed_sha512_x4(parts, hram);
+
+        for (j = 0; j < 4; ++j) {
+            sc_reduce(hram[j]);
+            sc_muladd(signatures + 64 * (i + j) + 32, hram[j], expanded, r[j]);
+        }
+    }
+
+    for (; i < count; ++i) {
+        ed25519_sign_expanded(signatures + 64 * i, messages[i], message_lens[i], public_key, expanded);
+    }
+}
+
+
+void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *private_key) {
+    unsigned char az[64];
+
+    ed25519_expand_private_key(az, private_key);
+    ed25519_sign_expanded(signature, message, message_len, private_key + 32, az);
 }
@@ -0,0 +1,124 @@
+#include <string.h>
+
+#include "ed25519.h"
+#include "ed_sha512.h"
+#include "ge.h"
+#include "sc.h"
+
+
+/*
+    Feeds a streamed message into one hash state, or two at once, in the
+    pieces read hands out. Returns 0 if a read fails.
+*/
+
+static int hash_stream(sha512_context *first, sha512_context *second, ed25519_read_chunk read, void *context) {
+    unsigned long long offset = 0;
+    const unsigned char *chunk;
+    size_t chunk_len;
+
+    for (;;) {
+        if (!read(context, offset, &chunk, &chunk_len)) {
+            return 0;
+        }
+
+        if (chunk_len == 0) {
+            return 1;
+        }
+
+        ed_sha512_update(first, chunk, chunk_len);
+        if (second != NULL) {
+            ed_sha512_update(second, chunk, chunk_len);
+        }
+        offset += chunk_len;
+    }
+}
+
+
+
+/*
+    The nonce hash SHA-512(prefix || M) takes the first read of the message,
+    h = SHA-512(R || A || M) the second. The second read derives the nonce
+    again: were the message to change in between, one nonce would sign two
+    messages and give the key away, so that fails instead.
+*/
+
+int ed25519_sign_expanded_stream(unsigned char *signature, ed25519_read_chunk read, void *context, const unsigned char *public_key, const unsigned char *expanded) {
+    sha512_context hash;
+    sha512_context nonce_hash;
+    unsigned char nonce[64];
+    unsigned char nonce_again[64];
+    unsigned char hram[64];
+    unsigned char r[64];
+    ge_p3 R;
+
+    ed_sha512_init(&nonce_hash);
+    ed_sha512_update(&nonce_hash, expanded + 32, 32);
+    if (!hash_stream(&nonce_hash, NULL, read, context)) {
+        return 0;
+    }
+    ed_sha512_final(&nonce_hash, nonce);
+
+    memcpy(r, nonce, 64);
+    sc_reduce(r);
+    ge_scalarmult_base(&R, r);
+    ge_p3_tobytes(signature, &R);
+
+    ed_sha512_init(&hash);
+    ed_sha512_update(&hash, signature, 32);
+    ed_sha512_update(&hash, public_key, 32);
+    ed_sha512_init(&nonce_hash);
+    ed_sha512_update(&nonce_hash, expanded + 32, 32);
+    if (!hash_stream(&hash, &nonce_hash, read, context)) {
+        memset(signature, 0, 64);
+        return 0;
+    }
+    ed_sha512_final(&hash, hram);
+    ed_sha512_final(&nonce_hash, nonce_again);
+
+    if (memcmp(nonce, nonce_again, 64) != 0) {
+        memset(signature, 0, 64);
+        return 0;
+    }
+
+    sc_reduce(hram);
+    sc_muladd(signature + 32, hram, expanded, r);
+    return 1;
+}
+
+
+
+int ed25519_verify_stream(const unsigned char *signature, ed25519_read_chunk read, void *context, const unsigned char *public_key) {
+    unsigned char h[64];
+    unsigned char checker[32];
+    unsigned char diff = 0;
+    sha512_context hash;
+    ge_p3 A;
+    ge_p2 R;
+    int i;
+
+    if (signature[63] & 224) {
+        return 0;
+    }
+
+    if (ge_frombytes_negate_vartime(&A, public_key) != 0) {
+        return 0;
+    }
+
+    ed_sha512_init(&hash);
+    ed_sha512_update(&hash, signature, 32);
+    ed_sha512_update(&hash, public_key, 32);
+    if (!hash_stream(&hash, NULL, read, context)) {
+        return 0;
+    }
+    ed_sha512_final(&hash, h);
+
+    sc_reduce(h);
+    ge_double_scalarmult_vartime(&R, h, &A, signature + 32);
+    ge_tobytes(checker, &R);
+
+    for (i = 0; i < 32; ++i) {
+        diff |= checker[i] ^ signature[i];
+    }
+
+    return diff == 0;
+}
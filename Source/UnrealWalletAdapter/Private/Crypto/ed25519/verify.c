@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include "ed25519.h"
 #include "ed_sha512.h"
 #include "ge.h"
@@ -75,3 +77,57 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
 
     return 1;
 }
+
+
+
+/* The tables are stored as bytes in ed25519_prepared_key, which has to have room for them. */
+typedef char prepared_key_tables_fit[sizeof(((ed25519_prepared_key *) 0)->tables) == sizeof(ge_precomp[4][8]) ? 1 : -1];
+
+int ed25519_prepare_key(ed25519_prepared_key *key, const unsigned char *public_key) {
+    ge_p3 A;
+
+    if (ge_frombytes_negate_vartime(&A, public_key) != 0) {
+        return 0;
+    }
+
+    memcpy(key->public_key, public_key, 32);
+    ge_precomp_tables((ge_precomp (*)[8]) key->tables, &A);
+    return 1;
+}
+
+
+
+int ed25519_verify_prepared(const unsigned char *signature, const unsigned char *message, size_t message_len, const ed25519_prepared_key *key) {
+    unsigned char h[64];
+    unsigned char checker[32];
+    sha512_context hash;
+    ge_p2 R;
+
+    if (signature[63] & 224) {
+        return 0;
+    }
+
+    ed_sha512_init(&hash);
+    ed_sha512_update(&hash, signature, 32);
+    ed_sha512_update(&hash, key->public_key, 32);
+    ed_sha512_update(&hash, message, message_len);
+    ed_sha512_final(&hash, h);
+
+    sc_reduce(h);
+    ge_double_scalarmult_tables_vartime(&R, h, (const ge_precomp (*)[8]) key->tables, signature + 32);
+    ge_tobytes(checker, &R);
+
+    if (!consttime_equal(checker, signature)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+
+
+int ed25519_is_on_curve(const unsigned char *point) {
+    ge_p3 A;
+
+    return ge_frombytes_negate_vartime(&A, point) == 0;
+}
@@ -0,0 +1,413 @@
+#include <string.h>
+
+#include "ed25519.h"
+#include "ed_sha512.h"
+#include "ge.h"
+#include "sc.h"
+
+/*
+A batch is checked as one random linear combination of its verification equations,
+
+  8 * ((sum z_i s_i) B - sum z_i R_i - sum (z_i h_i) A_i) = 0
+
+with 128-bit weights z_i the signers can't predict. The sum is a single multi-scalar
+multiplication, done with Pippenger's bucket method over signed radix 2^c digits. Signatures
+sharing a public key share its point, so messages from one wallet cost little more than their R.
+
+A signature is valid when s < 2^253, R is the canonical encoding of a point, neither R nor A is of
+small order, and 8 * (s B - R - h A) = 0. The cofactored equation holds for every signature whose
+points are torsion free and ed25519_verify accepts, but also for some with mixed order points that
+ed25519_verify refuses. Chunks too small to batch and chunks that fail are checked one signature at
+a time against the same equation, so the result of a signature doesn't depend on the rest of the
+batch.
+*/
+
+#define BATCH_MAX 64
+#define BATCH_MIN 8
+#define POINTS_MAX (2 * BATCH_MAX + 1)
+#define WINDOW_MIN 4
+#define WINDOW_MAX 6
+#define DIGITS_MAX (253 / WINDOW_MIN + 1)
+
+static const unsigned char basepoint[32] = {
+    0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66
+};
+
+
+
+/*
+Window width minimizing the additions, about one per point and two per bucket in each window.
+Points only have nonzero digits in the windows their scalar reaches, weights stop at 128 bits.
+*/
+
+static int window_bits(int wide_points, int narrow_points) {
+    int best = WINDOW_MIN;
+    int best_cost = 0;
+    int c;
+
+    for (c = WINDOW_MIN; c <= WINDOW_MAX; ++c) {
+        int windows = 253 / c + 1;
+        int cost = windows * (wide_points + (1 << c)) + (128 / c + 1) * narrow_points;
+
+        if (c == WINDOW_MIN || cost < best_cost) {
+            best = c;
+            best_cost = cost;
+        }
+    }
+
+    return best;
+}
+
+
+
+/*
+Input:
+  s[0]+256*s[1]+...+256^31*s[31] = s, with s < 2^253
+
+Output:
+  r[0]+2^c*r[1]+...+2^(c*(windows-1))*r[windows-1] = s,
+  with -2^(c-1) <= r[i] < 2^(c-1)
+*/
+
+static void recode(signed char *r, const unsigned char *s, int c, int windows) {
+    int carry = 0;
+    int i;
+
+    for (i = 0; i < windows; ++i) {
+        int pos = i * c;
+        int byte = pos >> 3;
+        int v = 0;
+
+        if (byte < 32) {
+            v = s[byte];
+        }
+
+        if (byte + 1 < 32) {
+            v |= s[byte + 1] << 8;
+        }
+
+        v = ((v >> (pos & 7)) & ((1 << c) - 1)) + carry;
+        carry = (v + (1 << (c - 1))) >> c;
+        r[i] = (signed char) (v - (carry << c));
+    }
+}
+
+
+
+static void p3_add(ge_p3 *r, const ge_p3 *p) {
+    ge_cached q;
+    ge_p1p1 t;
+
+    ge_p3_to_cached(&q, p);
+    ge_add(&t, r, &q);
+    ge_p1p1_to_p3(r, &t);
+}
+
+
+
+/*
+r = sum a_i P_i, from the digits of each a_i as returned by recode.
+*/
+
+static void multiscalar_mul(ge_p3 *r, const ge_cached *points, signed char digits[][DIGITS_MAX], int count, int c, int windows) {
+    ge_p3 buckets[1 << (WINDOW_MAX - 1)];
+    unsigned char used[1 << (WINDOW_MAX - 1)];
+    const int bucket_count = 1 << (c - 1);
+    int started = 0;
+    int w;
+    int i;
+    int j;
+
+    ge_p3_0(r);
+
+    for (w = windows - 1; w >= 0; --w) {
+        ge_p3 running;
+        ge_p3 sum;
+        int running_used = 0;
+        int sum_used = 0;
+        ge_p1p1 t;
+
+        if (started) {
+            ge_p2 q;
+
+            ge_p3_to_p2(&q, r);
+
+            for (j = 1; j < c; ++j) {
+                ge_p2_dbl(&t, &q);
+                ge_p1p1_to_p2(&q, &t);
+            }
+
+            ge_p2_dbl(&t, &q);
+            ge_p1p1_to_p3(r, &t);
+        }
+
+        memset(used, 0, bucket_count);
+
+        for (i = 0; i < count; ++i) {
+            int d = digits[i][w];
+            int b = (d > 0 ? d : -d) - 1;
+
+            if (d == 0) {
+                continue;
+            }
+
+            if (!used[b]) {
+                ge_p3_0(&buckets[b]);
+                used[b] = 1;
+            }
+
+            if (d > 0) {
+                ge_add(&t, &buckets[b], &points[i]);
+            } else {
+                ge_sub(&t, &buckets[b], &points[i]);
+            }
+
+            ge_p1p1_to_p3(&buckets[b], &t);
+        }
+
+        /* sum = sum (b + 1) * buckets[b], as a running sum from the top bucket down. */
+        for (j = bucket_count - 1; j >= 0; --j) {
+            if (used[j]) {
+                if (running_used) {
+                    p3_add(&running, &buckets[j]);
+                } else {
+                    running = buckets[j];
+                    running_used = 1;
+                }
+            }
+
+            if (running_used) {
+                if (sum_used) {
+                    p3_add(&sum, &running);
+                } else {
+                    sum = running;
+                    sum_used = 1;
+                }
+            }
+        }
+
+        if (sum_used) {
+            if (started) {
+                p3_add(r, &sum);
+            } else {
+                *r = sum;
+                started = 1;
+            }
+        }
+    }
+}
+
+
+
+/*
+Decoded R has to be the canonical encoding ed25519_verify compares against.
+*/
+
+static int is_canonical(const ge_p3 *p, const unsigned char *s) {
+    unsigned char y[32];
+
+    fe_tobytes(y, p->Y);
+
+    if (memcmp(y, s, 31) != 0 || y[31] != (s[31] & 127)) {
+        return 0;
+    }
+
+    return fe_isnonzero(p->X) || !(s[31] >> 7);
+}
+
+
+
+/*
+8 * p is the neutral element.
+*/
+
+static int is_small_order(const ge_p3 *p) {
+    ge_p3 q = *p;
+    ge_p1p1 t;
+    fe y;
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        ge_p3_dbl(&t, &q);
+        ge_p1p1_to_p3(&q, &t);
+    }
+
+    fe_sub(y, q.Y, q.Z);
+    return !fe_isnonzero(q.X) && !fe_isnonzero(y);
+}
+
+
+
+/*
+h_i = SHA-512(R_i || A_i || M_i), four at a time.
+*/
+
+static void hash_chunk(unsigned char h[][64], const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, int count) {
+    sha512_parts parts[4];
+    sha512_context hash;
+    int i = 0;
+    int j;
+
+    for (; i + 4 <= count; i += 4) {
+        for (j = 0; j < 4; ++j) {
+            parts[j].parts[0] = signatures[i + j];
+            parts[j].lens[0] = 32;
+            parts[j].parts[1] = public_keys[i + j];
+            parts[j].lens[1] = 32;
+            parts[j].parts[2] = messages[i + j];
+            parts[j].lens[2] = message_lens[i + j];
+        }
+
+        ed_sha512_x4(parts, h + i);
+    }
+
+    for (; i < count; ++i) {
+        ed_sha512_init(&hash);
+        ed_sha512_update(&hash, signatures[i], 32);
+        ed_sha512_update(&hash, public_keys[i], 32);
+        ed_sha512_update(&hash, messages[i], message_lens[i]);
+        ed_sha512_final(&hash, h[i]);
+    }
+}
+
+
+
+static int verify_chunk(const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, int count, const unsigned char *random) {
+    ge_cached points[POINTS_MAX];
+    unsigned char scalars[POINTS_MAX][32];
+    signed char digits[POINTS_MAX][DIGITS_MAX];
+    const unsigned char *keys[BATCH_MAX];
+    int key_points[BATCH_MAX];
+    int key_count = 0;
+    int point_count = 1;
+    unsigned char h[BATCH_MAX][64];
+    unsigned char z[32];
+    ge_p3 p;
+    ge_p1p1 t;
+    int c;
+    int windows;
+    int i;
+    int j;
+
+    /* B, with the sum of z_i s_i. */
+    ge_frombytes_negate_vartime(&p, basepoint);
+    fe_neg(p.X, p.X);
+    fe_neg(p.T, p.T);
+    ge_p3_to_cached(&points[0], &p);
+    memset(scalars[0], 0, 32);
+    memset(z + 16, 0, 16);
+
+    hash_chunk(h, signatures, messages, message_lens, public_keys, count);
+
+    for (i = 0; i < count; ++i) {
+        const unsigned char *signature = signatures[i];
+        const unsigned char *public_key = public_keys[i];
+        int key = -1;
+
+        if (signature[63] & 224) {
+            return 0;
+        }
+
+        /* -R_i, with z_i. */
+        if (ge_frombytes_negate_vartime(&p, signature) != 0 || !is_canonical(&p, signature) || is_small_order(&p)) {
+            return 0;
+        }
+
+        memcpy(z, random + 16 * i, 16);
+        ge_p3_to_cached(&points[point_count], &p);
+        memcpy(scalars[point_count], z, 32);
+        ++point_count;
+
+        /* -A_i, with z_i h_i summed over the signatures it made. */
+        for (j = 0; j < key_count; ++j) {
+            if (memcmp(keys[j], public_key, 32) == 0) {
+                key = key_points[j];
+                break;
+            }
+        }
+
+        if (key < 0) {
+            if (ge_frombytes_negate_vartime(&p, public_key) != 0 || is_small_order(&p)) {
+                return 0;
+            }
+
+            key = point_count++;
+            keys[key_count] = public_key;
+            key_points[key_count] = key;
+            ++key_count;
+            ge_p3_to_cached(&points[key], &p);
+            memset(scalars[key], 0, 32);
+        }
+
+        sc_reduce(h[i]);
+        sc_muladd(scalars[key], z, h[i], scalars[key]);
+        sc_muladd(scalars[0], z, signature + 32, scalars[0]);
+    }
+
+    c = window_bits(1 + key_count, count);
+    windows = 253 / c + 1;
+
+    for (i = 0; i < point_count; ++i) {
+        recode(digits[i], scalars[i], c, windows);
+    }
+
+    multiscalar_mul(&p, points, digits, point_count, c, windows);
+
+    for (i = 0; i < 3; ++i) {
+        ge_p3_dbl(&t, &p);
+        ge_p1p1_to_p3(&p, &t);
+    }
+
+    fe_sub(p.Y, p.Y, p.Z);
+    return !fe_isnonzero(p.X) && !fe_isnonzero(p.Y);
+}
+
+
+
+int ed25519_verify_cofactored(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    static const unsigned char weight[16] = { 1 };
+
+    return verify_chunk(&signature, &message, &message_len, &public_key, 1, weight);
+}
+
+
+
+int ed25519_verify_batch(const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, size_t count, const unsigned char *random, int *valid) {
+    size_t chunks = (count + BATCH_MAX - 1) / BATCH_MAX;
+    size_t start = 0;
+    int all = 1;
+
+    while (start < count) {
+        /* Chunks of even size, rather than a full one and a small rest. */
+        int n = (int) ((count - start + chunks - 1) / chunks);
+        int i;
+
+        --chunks;
+
+        if (n >= BATCH_MIN && verify_chunk(signatures + start, messages + start, message_lens + start, public_keys + start, n, random + 16 * start)) {
+            if (valid) {
+                for (i = 0; i < n; ++i) {
+                    valid[start + i] = 1;
+                }
+            }
+        } else {
+            /* Small chunks, or one holding an invalid signature, which is found by checking each. */
+            for (i = 0; i < n; ++i) {
+                int ok = ed25519_verify_cofactored(signatures[start + i], messages[start + i], message_lens[start + i], public_keys[start + i]);
+
+                if (valid) {
+                    valid[start + i] = ok;
+                } else if (!ok) {
+                    return 0;
+                }
+
+                all &= ok;
+            }
+        }
+
+        start += n;
+    }
+
+    return all;
+}
@@ -11,6 +11,7 @@
 #include "Crypto/CryptoUtils.h"
 #include "Network/RequestManager.h"
 #include "Network/RequestUtils.h"
+#include "Network/SlotClock.h"
 
 DEFINE_LOG_CATEGORY(LogWalletAdapterUseCase);
 
@@ -64,16 +65,16 @@ TArray<uint8> CreateMemoTransactionLegacy(const TArray<uint8>& PublicKey, const
 {
 	checkf(PublicKey.Num() == ACCOUNT_PUBLIC_KEY_LEN, TEXT("Invalid public key length for a Solana transaction"));
 
-	TArray<uint8> LatestBlockHash;
-	LatestBlockHash.Append((const uint8*)TCHAR_TO_ANSI(*LatestBlockHash58), LatestBlockHash58.Len());
-	LatestBlockHash = FBase58::DecodeBase58(LatestBlockHash);
+	uint8 LatestBlockHash[BLOCKHASH_LEN];
+	const auto LatestBlockHashAnsi = StringCast<ANSICHAR>(*LatestBlockHash58, LatestBlockHash58.Len());
+	const bool bValidBlockHash = FBase58::DecodeFixed<BLOCKHASH_LEN>(MakeArrayView(LatestBlockHashAnsi.Get(), LatestBlockHashAnsi.Length()), LatestBlockHash);
 	
-	checkf(LatestBlockHash.Num() == BLOCKHASH_LEN, TEXT("Invalid blockhash length for a Solana transaction"));	
+	checkf(bValidBlockHash, TEXT("Invalid blockhash length for a Solana transaction"));	
 
 	TArray<uint8> Transaction;
 	Transaction.Append(MEMO_TRANSACTION_TEMPLATE, sizeof(MEMO_TRANSACTION_TEMPLATE));
 	FMemory::Memcpy(Transaction.GetData() + ACCOUNT_PUBLIC_KEY_OFFSET, PublicKey.GetData(), PublicKey.Num());
-	FMemory::Memcpy(Transaction.GetData() + BLOCKHASH_OFFSET, LatestBlockHash.GetData(), LatestBlockHash.Num());
+	FMemory::Memcpy(Transaction.GetData() + BLOCKHASH_OFFSET, LatestBlockHash, BLOCKHASH_LEN);
 	
 	for (int32 I = 0; I < SUFFIX_DIGITS_LEN; I++)	
 		Transaction.GetData()[SUFFIX_DIGITS_OFFSET + I] = '0' + FMath::RandHelper(10);
@@ -120,7 +121,7 @@ bool VerifyMemoTransactionLegacy(const TArray<uint8>& PublicKey, const TArray<ui
 	TArray<uint8> Message = SignedTransaction;
 	Message.RemoveAt(0, HEADER_OFFSET);
 	
-	bool bVerified = FCryptoUtils::VerifyMessage(Signature, Message, PublicKey);
+	bool bVerified = FCryptoUtils::VerifyMessageCached(Signature, Message, PublicKey);
 	if (!bVerified)
 	{
 		UE_LOG(LogWalletAdapterUseCase, Warning, TEXT("Transaction signature is invalid"));
@@ -131,22 +132,43 @@ bool VerifyMemoTransactionLegacy(const TArray<uint8>& PublicKey, const TArray<ui
 	return true;
 }
 
-bool VerifyMessage(const TArray<uint8>& SignedMessage, const TArray<uint8>& Signature, const TArray<uint8>& PublicKey, const TArray<uint8>& OriginalMessage)
+bool VerifyMessages(const TArray<FSignedMessage>& SignedMessages, const TArray<uint8>& PublicKey, const TArray<FByteArray>& OriginalMessages)
 {
-	if (SignedMessage != OriginalMessage)
+	TArray<TArray<uint8>> Signatures;
+	TArray<TArray<uint8>> Messages;
+	TArray<TArray<uint8>> PublicKeys;
+	Signatures.Reserve(SignedMessages.Num());
+	Messages.Reserve(SignedMessages.Num());
+	PublicKeys.Init(PublicKey, SignedMessages.Num());
+
+	for (int32 MessageIndex = 0; MessageIndex < SignedMessages.Num(); MessageIndex++)
 	{
-		UE_LOG(LogWalletAdapterUseCase, Warning, TEXT("Signed message differs from original message. Verifying provided signature on signed message."));
-		return false;
+		const FSignedMessage& SignedMessage = SignedMessages[MessageIndex];
+		if (SignedMessage.Message != OriginalMessages[MessageIndex].Data)
+		{
+			UE_LOG(LogWalletAdapterUseCase, Warning, TEXT("Signed message %d differs from original message"), MessageIndex);
+			return false;
+		}
+
+		Signatures.Add(SignedMessage.Signatures.Num() > 0 ? SignedMessage.Signatures[0].Data : TArray<uint8>());
+		Messages.Add(SignedMessage.Message);
 	}
-	
-	bool bVerified = FCryptoUtils::VerifyMessage(Signature, SignedMessage, PublicKey);
-	if (!bVerified)
+
+	// All signatures are checked together, each one is only looked at again to report a failure.
+	TArray<bool> Valid;
+	if (!FCryptoUtils::VerifyBatch(Signatures, Messages, PublicKeys, &Valid))
 	{
-		UE_LOG(LogWalletAdapterUseCase, Warning, TEXT("Message signature is invalid"));
+		for (int32 MessageIndex = 0; MessageIndex < Valid.Num(); MessageIndex++)
+		{
+			if (!Valid[MessageIndex])
+			{
+				UE_LOG(LogWalletAdapterUseCase, Warning, TEXT("Message %d signature is invalid"), MessageIndex);
+			}
+		}
 		return false;
 	}
 	
-	UE_LOG(LogWalletAdapterUseCase, Log, TEXT("Successfully verified message signature"));
+	UE_LOG(LogWalletAdapterUseCase, Log, TEXT("Successfully verified %d message signatures"), SignedMessages.Num());
 	
 	return true;
 }
@@ -215,7 +237,8 @@ void UMobileWalletAdapterUseCase::SignAndSendTransaction(
 	Request->Callback.BindLambda([Client, Success, Failure](FJsonObject& ResponseJsonObject)
 	{
 		FString BlockHash = FRequestUtils::ParseBlockHashResponse(ResponseJsonObject);
-		int32 Slot = FRequestUtils::ParseBlockHashResponseContextSlot(ResponseJsonObject);
+		// The slot clock has already been synced from this response and never goes below its context slot.
+		int32 Slot = static_cast<int32>(FSlotClock::GetLastObservedSlot());
 		UE_LOG(LogWalletAdapterUseCase, Log, TEXT("Block Hash = %s, Slot = %d"), *BlockHash, Slot);
 		
 		TArray<FByteArray> Transactions;
@@ -290,14 +313,10 @@ void UMobileWalletAdapterUseCase::SignMessages(
 					return;
 				}
 				
-				for (int32 MessageIndex = 0; MessageIndex < Messages.Num(); MessageIndex++)
+				if (!VerifyMessages(SignedMessages, Client->PublicKey, Messages))
 				{
-					auto SignedMessage = SignedMessages[MessageIndex];
-					if (!VerifyMessage(SignedMessage.Message, SignedMessage.Signatures[0].Data, Client->PublicKey, Messages[MessageIndex].Data))
-					{
-						Failure.ExecuteIfBound("Failed to verify the signed message");
-						return;	
-					}
+					Failure.ExecuteIfBound("Failed to verify the signed message");
+					return;	
 				}
 				
 				Success.ExecuteIfBound(SignedMessages);
@@ -0,0 +1,415 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Network/JsonScanner.h"
+
+#include "Network/RawResponse.h"
+
+static bool IsWhitespace(UTF8CHAR Char)
+{
+	return Char == ' ' || Char == '\n' || Char == '\r' || Char == '\t';
+}
+
+static bool IsDelimiter(UTF8CHAR Char)
+{
+	return IsWhitespace(Char) || Char == ',' || Char == ':' || Char == '"'
+		|| Char == '{' || Char == '}' || Char == '[' || Char == ']';
+}
+
+static int32 ReadHex4(const UTF8CHAR* Src)
+{
+	int32 Value = 0;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		const UTF8CHAR Char = Src[Index];
+		const int32 Digit =
+			Char >= '0' && Char <= '9' ? Char - '0' :
+			Char >= 'a' && Char <= 'f' ? Char - 'a' + 10 :
+			Char >= 'A' && Char <= 'F' ? Char - 'A' + 10 : -1;
+		if (Digit < 0)
+			return -1;
+
+		Value = (Value << 4) | Digit;
+	}
+	return Value;
+}
+
+static UTF8CHAR* WriteUtf8(UTF8CHAR* Dest, uint32 CodePoint)
+{
+	if (CodePoint < 0x80)
+	{
+		*Dest++ = static_cast<UTF8CHAR>(CodePoint);
+	}
+	else if (CodePoint < 0x800)
+	{
+		*Dest++ = static_cast<UTF8CHAR>(0xC0 | (CodePoint >> 6));
+		*Dest++ = static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F));
+	}
+	else if (CodePoint < 0x10000)
+	{
+		*Dest++ = static_cast<UTF8CHAR>(0xE0 | (CodePoint >> 12));
+		*Dest++ = static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F));
+		*Dest++ = static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F));
+	}
+	else
+	{
+		*Dest++ = static_cast<UTF8CHAR>(0xF0 | (CodePoint >> 18));
+		*Dest++ = static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 12) & 0x3F));
+		*Dest++ = static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F));
+		*Dest++ = static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F));
+	}
+	return Dest;
+}
+
+FJsonScanner::FJsonScanner(FUtf8StringView Text)
+	: Cur(Text.GetData())
+	, End(Text.GetData() + Text.Len())
+{
+}
+
+void FJsonScanner::SkipWhitespace()
+{
+	while (Cur < End && IsWhitespace(*Cur))
+	{
+		++Cur;
+	}
+}
+
+bool FJsonScanner::Fail()
+{
+	bError = true;
+	Cur = End;
+	return false;
+}
+
+bool FJsonScanner::Peek(UTF8CHAR Char)
+{
+	SkipWhitespace();
+	return Cur < End && *Cur == Char;
+}
+
+bool FJsonScanner::Expect(UTF8CHAR Char)
+{
+	if (!Peek(Char))
+		return Fail();
+
+	++Cur;
+	return true;
+}
+
+bool FJsonScanner::IsObject()
+{
+	return Peek('{');
+}
+
+bool FJsonScanner::IsArray()
+{
+	return Peek('[');
+}
+
+bool FJsonScanner::IsNull()
+{
+	SkipWhitespace();
+	if (End - Cur < 4 || FMemory::Memcmp(Cur, "null", 4) != 0 || (End - Cur > 4 && !IsDelimiter(Cur[4])))
+		return false;
+
+	Cur += 4;
+	return true;
+}
+
+bool FJsonScanner::BeginObject()
+{
+	bAfterOpen = Expect('{');
+	return bAfterOpen;
+}
+
+bool FJsonScanner::BeginArray()
+{
+	bAfterOpen = Expect('[');
+	return bAfterOpen;
+}
+
+bool FJsonScanner::NextMember(UTF8CHAR Close)
+{
+	// Only the first member after the opening bracket goes without a separator.
+	const bool bFirst = bAfterOpen;
+	bAfterOpen = false;
+
+	SkipWhitespace();
+	if (Cur >= End)
+		return Fail();
+
+	if (*Cur == Close)
+	{
+		++Cur;
+		return false;
+	}
+
+	return bFirst || Expect(',');
+}
+
+bool FJsonScanner::NextKey(FUtf8StringView& OutKey)
+{
+	if (!NextMember('}'))
+		return false;
+
+	if (!Peek('"'))
+		return Fail();
+
+	// Keys are compared as written, RPC responses don't escape them.
+	const UTF8CHAR* Start = Cur + 1;
+	bool bEscaped;
+	if (!SkipString(bEscaped))
+		return false;
+
+	OutKey = FUtf8StringView(Start, static_cast<int32>(Cur - 1 - Start));
+	return Expect(':');
+}
+
+bool FJsonScanner::NextElement()
+{
+	return NextMember(']');
+}
+
+bool FJsonScanner::SkipString(bool& bOutEscaped)
+{
+	bOutEscaped = false;
+	for (++Cur; Cur < End; ++Cur)
+	{
+		if (*Cur == '"')
+		{
+			++Cur;
+			return true;
+		}
+
+		if (*Cur == '\\')
+		{
+			bOutEscaped = true;
+			if (++Cur == End)
+				break;
+		}
+	}
+	return Fail();
+}
+
+bool FJsonScanner::Unescape(FResponseArena& Arena, const UTF8CHAR* Src, int32 Len, FUtf8StringView& OutValue)
+{
+	// An escape sequence never decodes to more bytes than it takes up.
+	UTF8CHAR* const Dest = static_cast<UTF8CHAR*>(Arena.Allocate(Len, alignof(UTF8CHAR)));
+	UTF8CHAR* Out = Dest;
+
+	const UTF8CHAR* const SrcEnd = Src + Len;
+	while (Src < SrcEnd)
+	{
+		if (*Src != '\\')
+		{
+			*Out++ = *Src++;
+			continue;
+		}
+
+		if (SrcEnd - Src < 2)
+			return Fail();
+
+		const UTF8CHAR Escape = Src[1];
+		Src += 2;
+
+		switch (Escape)
+		{
+		case '"':
+		case '\\':
+		case '/':
+			*Out++ = Escape;
+			break;
+		case 'b': *Out++ = '\b'; break;
+		case 'f': *Out++ = '\f'; break;
+		case 'n': *Out++ = '\n'; break;
+		case 'r': *Out++ = '\r'; break;
+		case 't': *Out++ = '\t'; break;
+		case 'u':
+		{
+			int32 CodePoint = SrcEnd - Src >= 4 ? ReadHex4(Src) : -1;
+			if (CodePoint < 0)
+				return Fail();
+
+			Src += 4;
+
+			// Combine a surrogate pair, a lone surrogate is kept as is.
+			if (CodePoint >= 0xD800 && CodePoint < 0xDC00 && SrcEnd - Src >= 6 && Src[0] == '\\' && Src[1] == 'u')
+			{
+				const int32 Low = ReadHex4(Src + 2);
+				if (Low >= 0xDC00 && Low < 0xE000)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+					Src += 6;
+				}
+			}
+
+			Out = WriteUtf8(Out, CodePoint);
+			break;
+		}
+		default:
+			return Fail();
+		}
+	}
+
+	OutValue = FUtf8StringView(Dest, static_cast<int32>(Out - Dest));
+	return true;
+}
+
+bool FJsonScanner::ReadString(FResponseArena& Arena, FUtf8StringView& OutValue)
+{
+	if (IsNull())
+	{
+		OutValue = FUtf8StringView();
+		return true;
+	}
+
+	if (!Peek('"'))
+		return Fail();
+
+	const UTF8CHAR* Start = Cur + 1;
+	bool bEscaped;
+	if (!SkipString(bEscaped))
+		return false;
+
+	const int32 Len = static_cast<int32>(Cur - 1 - Start);
+	if (bEscaped)
+		return Unescape(Arena, Start, Len, OutValue);
+
+	OutValue = FUtf8StringView(Start, Len);
+	return true;
+}
+
+FUtf8StringView FJsonScanner::ReadToken()
+{
+	SkipWhitespace();
+	const UTF8CHAR* Start = Cur;
+	while (Cur < End && !IsDelimiter(*Cur))
+	{
+		++Cur;
+	}
+	return FUtf8StringView(Start, static_cast<int32>(Cur - Start));
+}
+
+bool FJsonScanner::ReadDouble(double& OutValue)
+{
+	if (IsNull())
+	{
+		OutValue = 0.0;
+		return true;
+	}
+
+	const FUtf8StringView Token = ReadToken();
+
+	ANSICHAR Buffer[64];
+	if (Token.IsEmpty() || Token.Len() >= UE_ARRAY_COUNT(Buffer) || !(Token[0] == '-' || (Token[0] >= '0' && Token[0] <= '9')))
+		return Fail();
+
+	FMemory::Memcpy(Buffer, Token.GetData(), Token.Len());
+	Buffer[Token.Len()] = '\0';
+
+	OutValue = FCStringAnsi::Atod(Buffer);
+	return true;
+}
+
+bool FJsonScanner::ReadUInt64(uint64& OutValue)
+{
+	if (IsNull())
+	{
+		OutValue = 0;
+		return true;
+	}
+
+	const UTF8CHAR* Start = Cur;
+	const FUtf8StringView Token = ReadToken();
+	if (Token.IsEmpty())
+		return Fail();
+
+	uint64 Value = 0;
+	for (const UTF8CHAR Char : Token)
+	{
+		if (Char < '0' || Char > '9')
+		{
+			// Integral value written with a fraction or an exponent.
+			Cur = Start;
+			double Double;
+			if (!ReadDouble(Double) || Double < 0.0)
+				return Fail();
+
+			OutValue = static_cast<uint64>(Double);
+			return true;
+		}
+
+		Value = Value * 10 + (Char - '0');
+	}
+
+	OutValue = Value;
+	return true;
+}
+
+bool FJsonScanner::ReadBool(bool& OutValue)
+{
+	const FUtf8StringView Token = ReadToken();
+	if (Token.Equals(UTF8TEXTVIEW("true"), ESearchCase::CaseSensitive))
+	{
+		OutValue = true;
+		return true;
+	}
+
+	if (Token.Equals(UTF8TEXTVIEW("false"), ESearchCase::CaseSensitive))
+	{
+		OutValue = false;
+		return true;
+	}
+
+	return Fail();
+}
+
+bool FJsonScanner::SkipValue()
+{
+	int32 Depth = 0;
+	do
+	{
+		SkipWhitespace();
+		if (Cur >= End)
+			return Fail();
+
+		switch (*Cur)
+		{
+		case '"':
+		{
+			bool bEscaped;
+			if (!SkipString(bEscaped))
+				return false;
+			break;
+		}
+		case '{':
+		case '[':
+			++Depth;
+			++Cur;
+			break;
+		case '}':
+		case ']':
+			if (Depth == 0)
+				return Fail();
+			--Depth;
+			++Cur;
+			break;
+		case ',':
+		case ':':
+			if (Depth == 0)
+				return Fail();
+			++Cur;
+			break;
+		default:
+			// Numbers and literals, not validated since nothing reads them.
+			if (ReadToken().IsEmpty())
+				return Fail();
+			break;
+		}
+	}
+	while (Depth > 0);
+
+	return true;
+}
@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FResponseArena;
+
+/**
+ * Forward-only reader over UTF-8 JSON that hands out views into the source text.
+ *
+ * Only strings containing escape sequences are copied, into the arena of the response. Values the
+ * caller isn't interested in are skipped without being decoded. Malformed input puts the scanner in an
+ * error state in which every read fails, so decoding loops simply run out.
+ */
+class FJsonScanner
+{
+public:
+	explicit FJsonScanner(FUtf8StringView Text);
+
+	bool HasError() const { return bError; }
+
+	void SkipWhitespace();
+	const UTF8CHAR* GetCursor() const { return Cur; }
+
+	bool IsObject();
+	bool IsArray();
+	/** Consumes a null literal if that is the next value. */
+	bool IsNull();
+
+	/** Enters an object, its members are then visited with NextKey until it returns false. */
+	bool BeginObject();
+	bool NextKey(FUtf8StringView& OutKey);
+	/** Compares a key from NextKey to a name, case sensitive like JSON itself. */
+	static bool IsKey(FUtf8StringView Key, FUtf8StringView Name) { return Key.Equals(Name, ESearchCase::CaseSensitive); }
+
+	/** Enters an array, each NextElement returning true must be followed by reading or skipping the value. */
+	bool BeginArray();
+	bool NextElement();
+
+	/** Reads a string, or null as an empty view. */
+	bool ReadString(FResponseArena& Arena, FUtf8StringView& OutValue);
+	bool ReadUInt64(uint64& OutValue);
+	bool ReadDouble(double& OutValue);
+	bool ReadBool(bool& OutValue);
+	bool SkipValue();
+
+private:
+	bool Fail();
+	bool Peek(UTF8CHAR Char);
+	bool Expect(UTF8CHAR Char);
+	bool NextMember(UTF8CHAR Close);
+	bool SkipString(bool& bOutEscaped);
+	bool Unescape(FResponseArena& Arena, const UTF8CHAR* Src, int32 Len, FUtf8StringView& OutValue);
+	FUtf8StringView ReadToken();
+
+	const UTF8CHAR* Cur;
+	const UTF8CHAR* End;
+	bool bAfterOpen = false;
+	bool bError = false;
+};
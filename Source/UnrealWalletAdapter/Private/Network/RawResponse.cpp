@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Network/RawResponse.h"
+
+#include "Interfaces/IHttpResponse.h"
+
+FResponseArena::FResponseArena(SIZE_T InBlockSize)
+	: BlockSize(InBlockSize)
+{
+}
+
+FResponseArena::~FResponseArena()
+{
+	while (Blocks)
+	{
+		FBlock* Next = Blocks->Next;
+		FMemory::Free(Blocks);
+		Blocks = Next;
+	}
+}
+
+void* FResponseArena::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	uint8* Aligned = Cursor ? Align(Cursor, Alignment) : nullptr;
+	if (!Aligned || Aligned + Size > Limit)
+	{
+		// Requests larger than a block get a block of their own.
+		const SIZE_T DataSize = FMath::Max(BlockSize, Size + Alignment);
+		FBlock* Block = static_cast<FBlock*>(FMemory::Malloc(sizeof(FBlock) + DataSize));
+		Block->Next = Blocks;
+		Blocks = Block;
+		AllocatedSize += DataSize;
+
+		Cursor = reinterpret_cast<uint8*>(Block + 1);
+		Limit = Cursor + DataSize;
+		Aligned = Align(Cursor, Alignment);
+	}
+
+	Cursor = Aligned + Size;
+	return Aligned;
+}
+
+// Decoded views take roughly half the size of the JSON they come from, so one block usually does.
+static SIZE_T GetArenaBlockSize(const FHttpResponsePtr& Response, const TArray<UTF8CHAR>& Inflated)
+{
+	const SIZE_T BodySize = Inflated.Num() > 0 ? Inflated.Num() : Response->GetContent().Num();
+	return FMath::Max<SIZE_T>(4 * 1024, BodySize / 2);
+}
+
+FRawResponse::FRawResponse(FHttpResponsePtr InResponse, TArray<UTF8CHAR>&& InInflated)
+	: Arena(GetArenaBlockSize(InResponse, InInflated))
+	, Response(MoveTemp(InResponse))
+	, Inflated(MoveTemp(InInflated))
+{
+	if (Inflated.Num() > 0)
+	{
+		Body = FUtf8StringView(Inflated.GetData(), Inflated.Num());
+	}
+	else
+	{
+		const TArray<uint8>& Content = Response->GetContent();
+		Body = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Content.GetData()), Content.Num());
+	}
+}
@@ -18,10 +18,18 @@ Contributers: Daniele Calanna, Riccardo Torrisi
 */
 
 #include "Network/RequestManager.h"
+#include "Network/JsonScanner.h"
+#include "Network/RawResponse.h"
 #include "Network/RequestUtils.h"
+#include "Network/ResponseStream.h"
+#include "Network/SlotClock.h"
 
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/CoreDelegates.h"
 
 DECLARE_LOG_CATEGORY_CLASS(RequestManager, Log, All);
 
@@ -32,6 +40,58 @@ static TArray<FRequestData*> PendingRequests;
 // "https://api.mainnet-beta.solana.com";
 FString ClusterRPCUrl = "https://api.testnet.solana.com";
 
+static const TCHAR* ConfigSection = TEXT("/Script/UnrealWalletAdapter.RequestManager");
+
+// Seconds without traffic after which a health ping keeps the pooled connection open. 0 disables pings.
+static float KeepAliveInterval = 20.f;
+static double LastRequestTime = 0.0;
+static FTSTicker::FDelegateHandle KeepAliveHandle;
+static FDelegateHandle PostEngineInitHandle;
+
+// Responses with a body at least this large on the wire are decoded on a worker thread.
+static constexpr int32 AsyncParseThreshold = 64 * 1024;
+
+
+static void SendHealthPing()
+{
+	FRequestData* Request = FRequestUtils::RequestHealth();
+	Request->ErrorCallback.BindLambda([](const FText& FailureReason)
+	{
+		UE_LOG(RequestManager, Verbose, TEXT("Health ping failed: %s"), *FailureReason.ToString());
+	});
+	FRequestManager::SendRequest(Request);
+}
+
+void FRequestManager::Initialize()
+{
+	GConfig->GetString(ConfigSection, TEXT("ClusterRPCUrl"), ClusterRPCUrl, GGameIni);
+	GConfig->GetFloat(ConfigSection, TEXT("KeepAliveInterval"), KeepAliveInterval, GGameIni);
+	
+	if (IsRunningCommandlet())
+		return;
+
+	// Resolve, connect and handshake with the cluster up front, so the first real request (usually the
+	// blockhash right before the wallet prompt) goes out on a pooled connection.
+	PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddStatic(&SendHealthPing);
+
+	if (KeepAliveInterval > 0.f)
+	{
+		KeepAliveHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+		{
+			if (FPlatformTime::Seconds() - LastRequestTime >= KeepAliveInterval)
+			{
+				SendHealthPing();
+			}
+			return true;
+		}), KeepAliveInterval);
+	}
+}
+
+void FRequestManager::Shutdown()
+{
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(KeepAliveHandle);
+}
 
 int64 FRequestManager::GetNextMessageID()
 {
@@ -50,49 +110,84 @@ void FRequestManager::SendRequest(FRequestData* RequestData)
 	Request->SetURL(ClusterRPCUrl);
 	Request->SetVerb("POST");
 	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	Request->SetHeader(TEXT("Accept-Encoding"), TEXT("gzip, deflate"));
 	Request->SetContentAsString(RequestData->Body);
 
-	Request->OnProcessRequestComplete().BindStatic(&FRequestManager::OnResponse);
+	Request->OnProcessRequestComplete().BindStatic(&FRequestManager::OnResponse, RequestData->Id);
 	Request->ProcessRequest();
 
 	PendingRequests.Push(RequestData);
+	LastRequestTime = FPlatformTime::Seconds();
+}
+
+static FRequestData* FindPendingRequest(int64 Id)
+{
+	FRequestData** Found = PendingRequests.FindByPredicate([&](FRequestData* Data) { return Data->Id == Id; });
+	return Found ? *Found : nullptr;
+}
+
+static FRequestData* TakePendingRequest(int64 Id)
+{
+	FRequestData* RequestData = FindPendingRequest(Id);
+	PendingRequests.Remove(RequestData);
+	return RequestData;
 }
 
-void FRequestManager::OnResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+static void DispatchError(FRequestData* RequestData, const FString& ErrorMessage)
 {
-	FString ResponseString = Response->GetContentAsString();
-	if (!bSuccess)
+	if (RequestData && RequestData->ErrorCallback.IsBound())
 	{
-		FRequestUtils::DisplayError("Http Request Failed");
-		return;
+		RequestData->ErrorCallback.Execute(FText::FromString(ErrorMessage));
+	}
+	else
+	{
+		FRequestUtils::DisplayError(ErrorMessage);
 	}
+}
 
+static TSharedPtr<FJsonObject> ParseResponse(const FHttpResponsePtr& Response)
+{
+	const uint32 StartCycles = FPlatformTime::Cycles();
+	
+	// The transport may already have decoded the body, so trust the bytes rather than the header.
+	const TArray<uint8>& Content = Response->GetContent();
+	FResponseStream Stream(Content, FResponseStream::IsCompressed(Content));
+	
 	TSharedPtr<FJsonObject> ParsedJSON;
-	FString ContentString = Response.Get()->GetContentAsString();
-	TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<>::Create(ContentString);
+	TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(&Stream);
+	if (!FJsonSerializer::Deserialize(Reader, ParsedJSON) || Stream.IsError())
+	{
+		ParsedJSON.Reset();
+	}
+	
+	UE_LOG(RequestManager, Verbose, TEXT("Response: %d bytes on wire, %lld bytes decoded, parsed in %.2f ms"),
+		Content.Num(), Stream.GetDecodedSize(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - StartCycles));
+	
+	return ParsedJSON;
+}
 
-	if (FJsonSerializer::Deserialize(Reader, ParsedJSON))
+static void DispatchResponse(const TSharedPtr<FJsonObject>& ParsedJSON)
+{
+	if (ParsedJSON.IsValid())
 	{
+		FRequestData* RequestData = TakePendingRequest(ParsedJSON->GetIntegerField("id"));
+		
 		const TSharedPtr<FJsonObject>* OutObject;
 		if (!ParsedJSON->TryGetObjectField("error", OutObject))
 		{
-			int Id = ParsedJSON->GetIntegerField("id");
-            if (PendingRequests.Num() > 0)
-            {
-            	FRequestData* RequestData = *PendingRequests.FindByPredicate([&](FRequestData* data) { return data->Id == Id; });
-            	if(RequestData)
-            	{
-            		RequestData->Callback.Execute(*ParsedJSON);
-            		PendingRequests.Remove(RequestData);
-            		delete RequestData;
-            	}
-            }
+			FSlotClock::SyncFromResponse(*ParsedJSON);
+			
+			if (RequestData)
+			{
+				RequestData->Callback.ExecuteIfBound(*ParsedJSON);
+			}
 		}
 		else
 		{
-			const TSharedPtr<FJsonObject> ErrorObject = ParsedJSON->GetObjectField("error");
-			FRequestUtils::DisplayError(ErrorObject->GetStringField("message"));
+			DispatchError(RequestData, (*OutObject)->GetStringField("message"));
 		}
+		
+		delete RequestData;
 	}
 	else
 	{
@@ -100,11 +195,182 @@ void FRequestManager::OnResponse(FHttpRequestPtr Request, FHttpResponsePtr Respo
 	}
 }
 
+// Reads the envelope of a response that is handed over undecoded, the result is left to the caller.
+static TSharedPtr<FRawResponse> ScanResponse(const FHttpResponsePtr& Response)
+{
+	const uint32 StartCycles = FPlatformTime::Cycles();
+
+	const TArray<uint8>& Content = Response->GetContent();
+	TArray<UTF8CHAR> Inflated;
+	if (FResponseStream::IsCompressed(Content))
+	{
+		FResponseStream Stream(Content, true);
+		if (!Stream.ReadAllUtf8(Inflated))
+			return nullptr;
+	}
+
+	const TSharedRef<FRawResponse> RawResponse = MakeShared<FRawResponse>(Response, MoveTemp(Inflated));
+	FJsonScanner Scanner(RawResponse->Body);
+
+	FUtf8StringView Key;
+	Scanner.BeginObject();
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("result")))
+		{
+			Scanner.SkipWhitespace();
+			const UTF8CHAR* Start = Scanner.GetCursor();
+
+			if (Scanner.IsObject())
+			{
+				FUtf8StringView ResultKey;
+				Scanner.BeginObject();
+				while (Scanner.NextKey(ResultKey))
+				{
+					if (FJsonScanner::IsKey(ResultKey, UTF8TEXTVIEW("context")) && Scanner.BeginObject())
+					{
+						FUtf8StringView ContextKey;
+						while (Scanner.NextKey(ContextKey))
+						{
+							if (FJsonScanner::IsKey(ContextKey, UTF8TEXTVIEW("slot")))
+							{
+								Scanner.ReadUInt64(RawResponse->ContextSlot);
+							}
+							else
+							{
+								Scanner.SkipValue();
+							}
+						}
+					}
+					else
+					{
+						Scanner.SkipValue();
+					}
+				}
+			}
+			else
+			{
+				Scanner.SkipValue();
+			}
+
+			RawResponse->Result = FUtf8StringView(Start, static_cast<int32>(Scanner.GetCursor() - Start));
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("error")) && Scanner.BeginObject())
+		{
+			RawResponse->bIsError = true;
+
+			FUtf8StringView ErrorKey;
+			while (Scanner.NextKey(ErrorKey))
+			{
+				if (FJsonScanner::IsKey(ErrorKey, UTF8TEXTVIEW("message")))
+				{
+					Scanner.ReadString(RawResponse->Arena, RawResponse->ErrorMessage);
+				}
+				else
+				{
+					Scanner.SkipValue();
+				}
+			}
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+
+	UE_LOG(RequestManager, Verbose, TEXT("Raw response: %d bytes on wire, %d bytes decoded, scanned in %.2f ms"),
+		Content.Num(), RawResponse->Body.Len(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - StartCycles));
+
+	if (Scanner.HasError())
+		return nullptr;
+
+	return RawResponse;
+}
+
+static void DispatchRawResponse(uint32 RequestId, const TSharedPtr<FRawResponse>& RawResponse)
+{
+	FRequestData* RequestData = TakePendingRequest(RequestId);
+
+	if (!RawResponse.IsValid())
+	{
+		DispatchError(RequestData, "Failed to parse Response from the server");
+	}
+	else if (RawResponse->bIsError)
+	{
+		const FUtf8StringView Message = RawResponse->ErrorMessage;
+		DispatchError(RequestData, FString(Message.Len(), Message.GetData()));
+	}
+	else
+	{
+		if (RawResponse->ContextSlot > 0)
+		{
+			FSlotClock::SyncSlot(RawResponse->ContextSlot);
+		}
+
+		if (RequestData)
+		{
+			RequestData->RawCallback.ExecuteIfBound(RawResponse.ToSharedRef());
+		}
+	}
+
+	delete RequestData;
+}
+
+void FRequestManager::OnResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, uint32 RequestId)
+{
+	if (!bSuccess || !Response.IsValid())
+	{
+		FRequestData* RequestData = TakePendingRequest(RequestId);
+		DispatchError(RequestData, "Http Request Failed");
+		delete RequestData;
+		return;
+	}
+
+	const FRequestData* RequestData = FindPendingRequest(RequestId);
+	if (RequestData && RequestData->RawCallback.IsBound())
+	{
+		if (Response->GetContent().Num() < AsyncParseThreshold)
+		{
+			DispatchRawResponse(RequestId, ScanResponse(Response));
+			return;
+		}
+
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Response, RequestId]
+		{
+			TSharedPtr<FRawResponse> RawResponse = ScanResponse(Response);
+			AsyncTask(ENamedThreads::GameThread, [RequestId, RawResponse]
+			{
+				DispatchRawResponse(RequestId, RawResponse);
+			});
+		});
+		return;
+	}
+
+	// Small responses are handled inline. The sign flows rely on that: they flush the HTTP manager and
+	// expect their callback to have run before the wallet takes over the game thread.
+	if (Response->GetContent().Num() < AsyncParseThreshold)
+	{
+		DispatchResponse(ParseResponse(Response));
+		return;
+	}
+
+	// Large account listings are inflated and parsed on a worker, callbacks still run on the game thread.
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Response]
+	{
+		TSharedPtr<FJsonObject> ParsedJSON = ParseResponse(Response);
+		AsyncTask(ENamedThreads::GameThread, [ParsedJSON]
+		{
+			DispatchResponse(ParsedJSON);
+		});
+	});
+}
+
 void FRequestManager::CancelRequest(FRequestData* RequestData)
 {
 	if (RequestData)
 	{
 		RequestData->Callback.Unbind();
+		RequestData->RawCallback.Unbind();
 		RequestData->ErrorCallback.Unbind();
 	}
 }
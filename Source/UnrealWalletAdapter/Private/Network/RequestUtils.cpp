@@ -17,7 +17,10 @@ Author: Jon Sawler
 */
 
 #include "Network/RequestUtils.h"
+#include "Network/JsonScanner.h"
+#include "Network/RawResponse.h"
 #include "Network/RequestManager.h"
+#include "Network/ResponseViews.h"
 #include "SolanaUtils/Utils/Types.h"
 
 #include "JsonObjectConverter.h"
@@ -125,6 +128,361 @@ FTokenAccountArrayJson FRequestUtils::ParseAllTokenAccountsResponse(const FJsonO
 	return JSONData;
 }
 
+static void ScanTokenAmount(FJsonScanner& Scanner, FResponseArena& Arena, FTokenUIBalanceView& Out)
+{
+	if (Scanner.IsNull() || !Scanner.BeginObject())
+		return;
+
+	FUtf8StringView Key;
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("amount")))
+		{
+			Scanner.ReadString(Arena, Out.Amount);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("decimals")))
+		{
+			uint64 Decimals;
+			Scanner.ReadUInt64(Decimals);
+			Out.Decimals = static_cast<uint8>(Decimals);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("uiAmount")))
+		{
+			Scanner.ReadDouble(Out.UiAmount);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("uiAmountString")))
+		{
+			Scanner.ReadString(Arena, Out.UiAmountString);
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+}
+
+static void ScanTokenInfo(FJsonScanner& Scanner, FResponseArena& Arena, FTokenBalanceView& Out)
+{
+	if (!Scanner.BeginObject())
+		return;
+
+	FUtf8StringView Key;
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("mint")))
+		{
+			Scanner.ReadString(Arena, Out.Mint);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("owner")))
+		{
+			Scanner.ReadString(Arena, Out.Owner);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("state")))
+		{
+			Scanner.ReadString(Arena, Out.State);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("delegate")))
+		{
+			Scanner.ReadString(Arena, Out.Delegate);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("isNative")))
+		{
+			Scanner.ReadBool(Out.bIsNative);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("tokenAmount")))
+		{
+			ScanTokenAmount(Scanner, Arena, Out.TokenAmount);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("delegatedAmount")))
+		{
+			ScanTokenAmount(Scanner, Arena, Out.DelegatedAmount);
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+}
+
+static void ScanTokenData(FJsonScanner& Scanner, FResponseArena& Arena, FTokenBalanceView& Out)
+{
+	// Accounts the node couldn't parse come back as a [data, encoding] pair.
+	if (!Scanner.IsObject())
+	{
+		Scanner.SkipValue();
+		return;
+	}
+
+	Scanner.BeginObject();
+
+	FUtf8StringView Key;
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("program")))
+		{
+			Scanner.ReadString(Arena, Out.Program);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("space")))
+		{
+			Scanner.ReadDouble(Out.Space);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("parsed")) && Scanner.BeginObject())
+		{
+			FUtf8StringView ParsedKey;
+			while (Scanner.NextKey(ParsedKey))
+			{
+				if (FJsonScanner::IsKey(ParsedKey, UTF8TEXTVIEW("type")))
+				{
+					Scanner.ReadString(Arena, Out.AccountType);
+				}
+				else if (FJsonScanner::IsKey(ParsedKey, UTF8TEXTVIEW("info")))
+				{
+					ScanTokenInfo(Scanner, Arena, Out);
+				}
+				else
+				{
+					Scanner.SkipValue();
+				}
+			}
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+}
+
+static void ScanTokenBalance(FJsonScanner& Scanner, FResponseArena& Arena, FTokenBalanceView& Out)
+{
+	if (!Scanner.BeginObject())
+		return;
+
+	FUtf8StringView Key;
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("pubkey")))
+		{
+			Scanner.ReadString(Arena, Out.Pubkey);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("account")) && Scanner.BeginObject())
+		{
+			FUtf8StringView AccountKey;
+			while (Scanner.NextKey(AccountKey))
+			{
+				if (FJsonScanner::IsKey(AccountKey, UTF8TEXTVIEW("data")))
+				{
+					ScanTokenData(Scanner, Arena, Out);
+				}
+				else if (FJsonScanner::IsKey(AccountKey, UTF8TEXTVIEW("owner")))
+				{
+					Scanner.ReadString(Arena, Out.AccountOwner);
+				}
+				else if (FJsonScanner::IsKey(AccountKey, UTF8TEXTVIEW("lamports")))
+				{
+					Scanner.ReadUInt64(Out.Lamports);
+				}
+				else if (FJsonScanner::IsKey(AccountKey, UTF8TEXTVIEW("executable")))
+				{
+					Scanner.ReadBool(Out.bExecutable);
+				}
+				else if (FJsonScanner::IsKey(AccountKey, UTF8TEXTVIEW("rentEpoch")))
+				{
+					Scanner.ReadDouble(Out.RentEpoch);
+				}
+				else
+				{
+					Scanner.SkipValue();
+				}
+			}
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+}
+
+// Moves the scanner into the "value" array of a result.
+static bool BeginResultValue(FJsonScanner& Scanner)
+{
+	if (!Scanner.BeginObject())
+		return false;
+
+	FUtf8StringView Key;
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("value")))
+			return Scanner.BeginArray();
+
+		Scanner.SkipValue();
+	}
+	return false;
+}
+
+// Moves the scanner into a result that is an array itself.
+static bool BeginResultArray(FJsonScanner& Scanner)
+{
+	return Scanner.BeginArray();
+}
+
+// Decodes every element of the array BeginArray enters into a view allocated from the arena of the response.
+template<typename ViewType>
+static TArrayView<const ViewType> ScanViews(FRawResponse& Response, bool (*BeginArray)(FJsonScanner&),
+	void (*Scan)(FJsonScanner&, FResponseArena&, ViewType&))
+{
+	// Count the elements first, so the views take a single allocation from the arena.
+	int32 Num = 0;
+	{
+		FJsonScanner Scanner(Response.Result);
+		if (BeginArray(Scanner))
+		{
+			while (Scanner.NextElement() && Scanner.SkipValue())
+			{
+				++Num;
+			}
+		}
+
+		if (Scanner.HasError())
+			return {};
+	}
+
+	const TArrayView<ViewType> Views = Response.Arena.AllocateArray<ViewType>(Num);
+
+	FJsonScanner Scanner(Response.Result);
+	BeginArray(Scanner);
+	for (ViewType& View : Views)
+	{
+		Scanner.NextElement();
+		Scan(Scanner, Response.Arena, View);
+	}
+
+	if (Scanner.HasError())
+		return {};
+
+	return Views;
+}
+
+TArrayView<const FTokenBalanceView> FRequestUtils::ParseAllTokenAccountsResponse(FRawResponse& Response)
+{
+	return ScanViews<FTokenBalanceView>(Response, &BeginResultValue, &ScanTokenBalance);
+}
+
+static void ScanAccountData(FJsonScanner& Scanner, FResponseArena& Arena, FAccountInfoView& Out)
+{
+	// jsonParsed layouts differ per program, they are left to the FJsonObject parsers.
+	if (Scanner.IsObject())
+	{
+		Scanner.SkipValue();
+		return;
+	}
+
+	if (!Scanner.IsArray())
+	{
+		Scanner.ReadString(Arena, Out.Data);
+		return;
+	}
+
+	Scanner.BeginArray();
+	for (int32 Index = 0; Scanner.NextElement(); ++Index)
+	{
+		if (Index == 0)
+		{
+			Scanner.ReadString(Arena, Out.Data);
+		}
+		else if (Index == 1)
+		{
+			Scanner.ReadString(Arena, Out.Encoding);
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+}
+
+static void ScanAccount(FJsonScanner& Scanner, FResponseArena& Arena, FAccountInfoView& Out)
+{
+	// Keys that have no account come back as null.
+	if (Scanner.IsNull() || !Scanner.BeginObject())
+		return;
+
+	FUtf8StringView Key;
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("data")))
+		{
+			ScanAccountData(Scanner, Arena, Out);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("owner")))
+		{
+			Scanner.ReadString(Arena, Out.Owner);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("lamports")))
+		{
+			Scanner.ReadUInt64(Out.Lamports);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("executable")))
+		{
+			Scanner.ReadBool(Out.bExecutable);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("rentEpoch")))
+		{
+			Scanner.ReadDouble(Out.RentEpoch);
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+}
+
+static void ScanProgramAccount(FJsonScanner& Scanner, FResponseArena& Arena, FProgramAccountView& Out)
+{
+	if (!Scanner.BeginObject())
+		return;
+
+	FUtf8StringView Key;
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("pubkey")))
+		{
+			Scanner.ReadString(Arena, Out.Pubkey);
+		}
+		else if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("account")))
+		{
+			ScanAccount(Scanner, Arena, Out.Account);
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+}
+
+bool FRequestUtils::ParseAccountInfoResponse(FRawResponse& Response, FAccountInfoView& OutAccount)
+{
+	FJsonScanner Scanner(Response.Result);
+	if (!Scanner.BeginObject())
+		return false;
+
+	bool bFound = false;
+	FUtf8StringView Key;
+	while (Scanner.NextKey(Key))
+	{
+		if (FJsonScanner::IsKey(Key, UTF8TEXTVIEW("value")))
+		{
+			bFound = Scanner.IsObject();
+			ScanAccount(Scanner, Response.Arena, OutAccount);
+		}
+		else
+		{
+			Scanner.SkipValue();
+		}
+	}
+
+	return bFound && !Scanner.HasError();
+}
+
 FRequestData* FRequestUtils::RequestProgramAccounts(const FString& ProgramID, const uint32& Size, const FString& PublicKey)
 {
 	FRequestData* Request = new FRequestData(FRequestManager::GetNextMessageID());
@@ -155,6 +513,11 @@ TArray<FProgramAccountJson> FRequestUtils::ParseProgramAccountsResponse(const FJ
 	return List;
 }
 
+TArrayView<const FProgramAccountView> FRequestUtils::ParseProgramAccountsResponse(FRawResponse& Response)
+{
+	return ScanViews<FProgramAccountView>(Response, &BeginResultArray, &ScanProgramAccount);
+}
+
 FRequestData* FRequestUtils::RequestMultipleAccounts(const TArray<FString>& PublicKey)
 {
 	FRequestData* Request = new FRequestData(FRequestManager::GetNextMessageID());
@@ -187,6 +550,11 @@ TArray<FAccountInfoJson> FRequestUtils::ParseMultipleAccountsResponse(const FJso
 	return JSONData;
 }
 
+TArrayView<const FAccountInfoView> FRequestUtils::ParseMultipleAccountsResponse(FRawResponse& Response)
+{
+	return ScanViews<FAccountInfoView>(Response, &BeginResultValue, &ScanAccount);
+}
+
 FRequestData* FRequestUtils::SendTransaction(const FString& Transaction)
 {
 	FRequestData* Request = new FRequestData(FRequestManager::GetNextMessageID());
@@ -208,7 +576,7 @@ FRequestData* FRequestUtils::RequestBlockHash()
 	FRequestData* Request = new FRequestData(FRequestManager::GetNextMessageID());
 	
 	Request->Body =
-		FString::Printf(TEXT(R"({"id":%d,"jsonrpc":"2.0","method":"getRecentBlockhash","params":[{"commitment":"processed"}]})")
+		FString::Printf(TEXT(R"({"id":%d,"jsonrpc":"2.0","method":"getLatestBlockhash","params":[{"commitment":"processed"}]})")
 				,Request->Id );
 	
 	return Request;
@@ -236,6 +604,19 @@ int32 FRequestUtils::ParseBlockHashResponseContextSlot(const FJsonObject& Data)
 	return Slot;
 }
 
+uint64 FRequestUtils::ParseBlockHashResponseLastValidBlockHeight(const FJsonObject& Data)
+{
+	const TSharedPtr<FJsonObject>* Result;
+	const TSharedPtr<FJsonObject>* Value;
+	double LastValidBlockHeight;
+	if (!Data.TryGetObjectField("result", Result) || !(*Result)->TryGetObjectField("value", Value)
+		|| !(*Value)->TryGetNumberField("lastValidBlockHeight", LastValidBlockHeight) || LastValidBlockHeight < 0)
+	{
+		return 0;
+	}
+	return static_cast<uint64>(LastValidBlockHeight);
+}
+
 FRequestData* FRequestUtils::GetTransactionFeeAmount(const FString& Transaction)
 {
 	FRequestData* Request = new FRequestData(FRequestManager::GetNextMessageID());
@@ -258,6 +639,24 @@ int FRequestUtils::ParseTransactionFeeAmountResponse(const FJsonObject& Data)
 	return Fee;
 }
 
+FRequestData* FRequestUtils::RequestMinimumBalanceForRentExemption(uint32 DataSize)
+{
+	FRequestData* Request = new FRequestData(FRequestManager::GetNextMessageID());
+	
+	Request->Body =
+		FString::Printf(TEXT(R"({"jsonrpc":"2.0","id":%d,"method":"getMinimumBalanceForRentExemption","params":[%u]})")
+			,Request->Id, DataSize );
+	
+	return Request;
+}
+
+uint64 FRequestUtils::ParseMinimumBalanceForRentExemptionResponse(const FJsonObject& Data)
+{
+	double Lamports = 0;
+	Data.TryGetNumberField("result", Lamports);
+	return static_cast<uint64>(Lamports);
+}
+
 FRequestData* FRequestUtils::RequestAirDrop(const FString& PublicKey)
 {
 	FRequestData* Request = new FRequestData(FRequestManager::GetNextMessageID());
@@ -269,6 +668,17 @@ FRequestData* FRequestUtils::RequestAirDrop(const FString& PublicKey)
 	return Request;
 }
 
+FRequestData* FRequestUtils::RequestHealth()
+{
+	FRequestData* Request = new FRequestData(FRequestManager::GetNextMessageID());
+	
+	Request->Body =
+		FString::Printf(TEXT(R"({"jsonrpc":"2.0","id":%d,"method":"getHealth"})")
+				,Request->Id );
+	
+	return Request;
+}
+
 void FRequestUtils::DisplayError(const FString& Error)
 {
 	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Error), &ErrorTitle);
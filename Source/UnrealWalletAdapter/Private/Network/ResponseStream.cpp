@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Network/ResponseStream.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+// Number of UTF-8 bytes decoded per refill.
+static constexpr int32 ChunkSize = 16 * 1024;
+
+// Returns the length of the prefix that ends on a complete UTF-8 sequence.
+static int32 CompleteUtf8Length(const UTF8CHAR* Data, int32 Num)
+{
+	int32 Lead = Num - 1;
+	while (Lead >= 0 && Num - Lead < 4 && (Data[Lead] & 0xC0) == 0x80)
+	{
+		--Lead;
+	}
+
+	if (Lead < 0)
+		return Num;
+
+	const uint8 Byte = Data[Lead];
+	const int32 SequenceLength = Byte >= 0xF0 ? 4 : Byte >= 0xE0 ? 3 : Byte >= 0xC0 ? 2 : 1;
+	return Num - Lead >= SequenceLength ? Num : Lead;
+}
+
+FResponseStream::FResponseStream(TConstArrayView<uint8> InContent, bool bInCompressed)
+	: Content(InContent)
+	, bCompressed(bInCompressed)
+{
+	SetIsLoading(true);
+
+	if (bCompressed)
+	{
+		ZStream = new z_stream;
+		FMemory::Memzero(*ZStream);
+
+		// 15 window bits + 32 detects both gzip and zlib headers.
+		if (inflateInit2(ZStream, 15 + 32) != Z_OK)
+		{
+			SetError();
+			bSourceDone = true;
+		}
+
+		ZStream->next_in = const_cast<Bytef*>(Content.GetData());
+		ZStream->avail_in = Content.Num();
+		ContentOffset = Content.Num();
+	}
+}
+
+FResponseStream::~FResponseStream()
+{
+	if (ZStream)
+	{
+		inflateEnd(ZStream);
+		delete ZStream;
+	}
+}
+
+bool FResponseStream::IsCompressed(TConstArrayView<uint8> Content)
+{
+	if (Content.Num() < 2)
+		return false;
+
+	const bool bGzip = Content[0] == 0x1f && Content[1] == 0x8b;
+	const bool bZlib = (Content[0] & 0x0f) == Z_DEFLATED && ((Content[0] << 8) | Content[1]) % 31 == 0;
+	return bGzip || bZlib;
+}
+
+int32 FResponseStream::ReadUtf8(UTF8CHAR* Dest, int32 Capacity)
+{
+	if (!bCompressed)
+	{
+		const int32 Num = FMath::Min<int64>(Capacity, Content.Num() - ContentOffset);
+		FMemory::Memcpy(Dest, Content.GetData() + ContentOffset, Num);
+		ContentOffset += Num;
+		bSourceDone = ContentOffset >= Content.Num();
+		return Num;
+	}
+
+	ZStream->next_out = reinterpret_cast<Bytef*>(Dest);
+	ZStream->avail_out = Capacity;
+
+	while (ZStream->avail_out > 0)
+	{
+		const int Result = inflate(ZStream, Z_NO_FLUSH);
+		if (Result == Z_STREAM_END)
+		{
+			bSourceDone = true;
+			break;
+		}
+
+		// Z_BUF_ERROR here means the body ended before the compressed stream did.
+		if (Result != Z_OK)
+		{
+			SetError();
+			bSourceDone = true;
+			break;
+		}
+	}
+
+	return Capacity - ZStream->avail_out;
+}
+
+bool FResponseStream::ReadAllUtf8(TArray<UTF8CHAR>& Out)
+{
+	while (!bSourceDone)
+	{
+		const int32 Num = Out.Num();
+		Out.SetNumUninitialized(Num + ChunkSize, false);
+		const int32 Read = ReadUtf8(Out.GetData() + Num, ChunkSize);
+		Out.SetNum(Num + Read, false);
+		DecodedSize += Read;
+	}
+	return !IsError();
+}
+
+bool FResponseStream::Refill()
+{
+	Chars.Reset();
+	CharOffset = 0;
+
+	for (;;)
+	{
+		if (!bSourceDone)
+		{
+			const int32 Pending = Utf8.Num();
+			Utf8.SetNumUninitialized(Pending + ChunkSize, false);
+			const int32 Read = ReadUtf8(Utf8.GetData() + Pending, ChunkSize);
+			Utf8.SetNum(Pending + Read, false);
+			DecodedSize += Read;
+		}
+
+		// Hold back a sequence split across chunks until the rest of it arrives.
+		const int32 Complete = bSourceDone ? Utf8.Num() : CompleteUtf8Length(Utf8.GetData(), Utf8.Num());
+		if (Complete > 0)
+		{
+			const auto Converted = StringCast<TCHAR>(Utf8.GetData(), Complete);
+			Chars.Append(Converted.Get(), Converted.Length());
+			Utf8.RemoveAt(0, Complete, false);
+		}
+
+		if (Chars.Num() > 0)
+			return true;
+
+		if (bSourceDone)
+			return false;
+	}
+}
+
+void FResponseStream::Serialize(void* Data, int64 Num)
+{
+	check(Num % sizeof(TCHAR) == 0);
+
+	TCHAR* Dest = static_cast<TCHAR*>(Data);
+	int64 Remaining = Num / sizeof(TCHAR);
+
+	while (Remaining > 0)
+	{
+		if (CharOffset >= Chars.Num() && !Refill())
+		{
+			SetError();
+			FMemory::Memzero(Dest, Remaining * sizeof(TCHAR));
+			return;
+		}
+
+		const int64 Count = FMath::Min<int64>(Remaining, Chars.Num() - CharOffset);
+		FMemory::Memcpy(Dest, Chars.GetData() + CharOffset, Count * sizeof(TCHAR));
+		CharOffset += Count;
+		Dest += Count;
+		Remaining -= Count;
+	}
+}
+
+bool FResponseStream::AtEnd()
+{
+	return CharOffset >= Chars.Num() && !Refill();
+}
@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+
+/**
+ * Archive that serves the body of an RPC response to TJsonReader<TCHAR> in small chunks.
+ *
+ * gzip or zlib encoded bodies are inflated chunk by chunk and UTF-8 is converted to TCHAR per chunk,
+ * so neither the decompressed body nor a full FString copy of it is ever held in memory.
+ */
+class FResponseStream : public FArchive
+{
+public:
+	FResponseStream(TConstArrayView<uint8> InContent, bool bInCompressed);
+	virtual ~FResponseStream() override;
+
+	/** Returns true if the body starts with a gzip or zlib header. */
+	static bool IsCompressed(TConstArrayView<uint8> Content);
+
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual bool AtEnd() override;
+	virtual FString GetArchiveName() const override { return TEXT("FResponseStream"); }
+
+	/** Reads the rest of the body as UTF-8 without converting it, returns false if it is corrupt. */
+	bool ReadAllUtf8(TArray<UTF8CHAR>& Out);
+
+	/** Number of UTF-8 bytes produced so far. */
+	int64 GetDecodedSize() const { return DecodedSize; }
+
+private:
+	bool Refill();
+	int32 ReadUtf8(UTF8CHAR* Dest, int32 Capacity);
+
+	TConstArrayView<uint8> Content;
+	int64 ContentOffset = 0;
+	int64 DecodedSize = 0;
+
+	bool bCompressed;
+	bool bSourceDone = false;
+	struct z_stream_s* ZStream = nullptr;
+
+	TArray<UTF8CHAR> Utf8;
+	TArray<TCHAR> Chars;
+	int32 CharOffset = 0;
+};
@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Network/ResponseViews.h"
+
+static FString ToString(FUtf8StringView View)
+{
+	return FString(View.Len(), View.GetData());
+}
+
+FTokenUIBalanceJson FTokenUIBalanceView::Retain() const
+{
+	FTokenUIBalanceJson Balance;
+	Balance.amount = ToString(Amount);
+	Balance.decimals = Decimals;
+	Balance.uiAmount = UiAmount;
+	Balance.uiAmountString = ToString(UiAmountString);
+	return Balance;
+}
+
+FTokenBalanceDataJson FTokenBalanceView::Retain() const
+{
+	FTokenBalanceDataJson Balance;
+	Balance.pubkey = ToString(Pubkey);
+
+	FTokenAccountDataJson& Account = Balance.account;
+	Account.executable = bExecutable;
+	Account.lamports = Lamports;
+	Account.owner = ToString(AccountOwner);
+	Account.rentEpoch = RentEpoch;
+
+	Account.data.program = ToString(Program);
+	Account.data.space = Space;
+	Account.data.parsed.accountType = ToString(AccountType);
+
+	FTokenInfoJson& Info = Account.data.parsed.info;
+	Info.tokenAmount = TokenAmount.Retain();
+	Info.delegate = ToString(Delegate);
+	Info.delegatedAmount = DelegatedAmount.Retain();
+	Info.state = ToString(State);
+	Info.isNative = bIsNative;
+	Info.mint = ToString(Mint);
+	Info.owner = ToString(Owner);
+
+	return Balance;
+}
+
+FAccountInfoJson FAccountInfoView::Retain() const
+{
+	FAccountInfoJson Account;
+	Account.data.Add(ToString(Data));
+	if (!Encoding.IsEmpty())
+	{
+		Account.data.Add(ToString(Encoding));
+	}
+	Account.executable = bExecutable;
+	Account.lamports = Lamports;
+	Account.owner = ToString(Owner);
+	// Accounts exempt from rent report u64::MAX, which doesn't fit the int32 of the struct.
+	Account.rentEpoch = static_cast<int32>(FMath::Min(RentEpoch, static_cast<double>(MAX_int32)));
+	return Account;
+}
+
+FProgramAccountJson FProgramAccountView::Retain() const
+{
+	FProgramAccountJson Entry;
+	Entry.data = ToString(Account.Data);
+	Entry.executable = Account.bExecutable;
+	Entry.lamports = Account.Lamports;
+	Entry.owner = ToString(Account.Owner);
+	Entry.rentEpoch = Account.RentEpoch;
+	return Entry;
+}
@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Network/SlotClock.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+// Nominal slot duration of the cluster.
+static constexpr double DefaultSlotDuration = 0.4;
+// Bounds for the measured slot duration so a burst of delayed responses can't skew the estimate.
+static constexpr double MinSlotDuration = 0.25;
+static constexpr double MaxSlotDuration = 1.0;
+// Number of slots that must elapse between two samples before the slot rate is re-measured.
+static constexpr uint64 RateSampleSlots = 25;
+// Weight of a new rate measurement in the slot duration estimate.
+static constexpr double RateSmoothing = 0.25;
+// Blocks after which a blockhash is no longer accepted (MAX_PROCESSING_AGE on the validator side).
+static constexpr uint64 BlockhashValidBlocks = 150;
+
+static FCriticalSection ClockLock;
+
+static bool bSynced = false;
+static uint64 AnchorSlot = 0;
+static double AnchorTime = 0.0;
+static uint64 LastObservedSlot = 0;
+static double SlotDuration = DefaultSlotDuration;
+
+static uint64 RateSampleSlot = 0;
+static double RateSampleTime = 0.0;
+
+static bool bBlockHeightSynced = false;
+static uint64 BlockHeightSampleSlot = 0;
+static uint64 BlockHeightSlotOffset = 0;
+
+void FSlotClock::SyncSlot(uint64 Slot)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FScopeLock Lock(&ClockLock);
+
+	if (!bSynced)
+	{
+		bSynced = true;
+		AnchorSlot = LastObservedSlot = RateSampleSlot = Slot;
+		AnchorTime = RateSampleTime = Now;
+		return;
+	}
+
+	// Responses can arrive out of order or from a lagging node, only move forward.
+	if (Slot <= LastObservedSlot)
+		return;
+
+	LastObservedSlot = Slot;
+
+	// Correct the rate from the slots observed over a long enough window to average out response latency.
+	if (Slot - RateSampleSlot >= RateSampleSlots)
+	{
+		const double MeasuredDuration = (Now - RateSampleTime) / (Slot - RateSampleSlot);
+		SlotDuration += (FMath::Clamp(MeasuredDuration, MinSlotDuration, MaxSlotDuration) - SlotDuration) * RateSmoothing;
+		RateSampleSlot = Slot;
+		RateSampleTime = Now;
+	}
+
+	// Correct the offset by re-anchoring on the observed slot.
+	AnchorSlot = Slot;
+	AnchorTime = Now;
+}
+
+void FSlotClock::SyncBlockHeight(uint64 Slot, uint64 BlockHeight)
+{
+	if (BlockHeight > Slot)
+		return;
+
+	SyncSlot(Slot);
+
+	FScopeLock Lock(&ClockLock);
+
+	// Re-anchor on the latest sample, a late response from before it is older news.
+	if (bBlockHeightSynced && Slot < BlockHeightSampleSlot)
+		return;
+
+	BlockHeightSampleSlot = Slot;
+	BlockHeightSlotOffset = Slot - BlockHeight;
+	bBlockHeightSynced = true;
+}
+
+void FSlotClock::SyncFromResponse(const FJsonObject& Data)
+{
+	const TSharedPtr<FJsonObject>* Result;
+	if (!Data.TryGetObjectField("result", Result))
+		return;
+
+	const TSharedPtr<FJsonObject>* Context;
+	double Slot;
+	if (!(*Result)->TryGetObjectField("context", Context) || !(*Context)->TryGetNumberField("slot", Slot))
+		return;
+
+	double LastValidBlockHeight;
+	const TSharedPtr<FJsonObject>* Value;
+	if ((*Result)->TryGetObjectField("value", Value) && (*Value)->TryGetNumberField("lastValidBlockHeight", LastValidBlockHeight)
+		&& LastValidBlockHeight >= BlockhashValidBlocks)
+	{
+		SyncBlockHeight(static_cast<uint64>(Slot), static_cast<uint64>(LastValidBlockHeight) - BlockhashValidBlocks);
+	}
+	else
+	{
+		SyncSlot(static_cast<uint64>(Slot));
+	}
+}
+
+bool FSlotClock::IsSynced()
+{
+	FScopeLock Lock(&ClockLock);
+	return bSynced;
+}
+
+bool FSlotClock::IsBlockHeightSynced()
+{
+	FScopeLock Lock(&ClockLock);
+	return bBlockHeightSynced;
+}
+
+uint64 FSlotClock::GetCurrentSlot()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FScopeLock Lock(&ClockLock);
+
+	if (!bSynced)
+		return 0;
+
+	return AnchorSlot + static_cast<uint64>(FMath::Max(Now - AnchorTime, 0.0) / SlotDuration);
+}
+
+uint64 FSlotClock::GetCurrentBlockHeight()
+{
+	const uint64 Slot = GetCurrentSlot();
+
+	FScopeLock Lock(&ClockLock);
+
+	if (!bBlockHeightSynced)
+		return 0;
+
+	// One block per slot since the sample. Slots skipped since then make this run ahead of the cluster, by a
+	// few percent of the slots elapsed, so a blockhash may be reported expired a little early but never late.
+	return Slot - BlockHeightSlotOffset;
+}
+
+uint64 FSlotClock::GetLastObservedSlot()
+{
+	FScopeLock Lock(&ClockLock);
+	return LastObservedSlot;
+}
+
+double FSlotClock::GetSlotDuration()
+{
+	FScopeLock Lock(&ClockLock);
+	return SlotDuration;
+}
+
+bool FSlotClock::IsBlockhashExpired(uint64 LastValidBlockHeight)
+{
+	// Without a block height we can't tell, let the cluster decide.
+	if (!IsBlockHeightSynced())
+		return false;
+
+	return GetCurrentBlockHeight() > LastValidBlockHeight;
+}
+
+void FSlotClock::Reset()
+{
+	FScopeLock Lock(&ClockLock);
+
+	bSynced = false;
+	AnchorSlot = LastObservedSlot = RateSampleSlot = 0;
+	AnchorTime = RateSampleTime = 0.0;
+	SlotDuration = DefaultSlotDuration;
+	bBlockHeightSynced = false;
+	BlockHeightSampleSlot = 0;
+	BlockHeightSlotOffset = 0;
+}
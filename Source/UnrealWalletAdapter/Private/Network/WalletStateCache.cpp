@@ -0,0 +1,206 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#include "Network/WalletStateCache.h"
+
+#include "Crypto/Base58.h"
+#include "Network/RawResponse.h"
+#include "Network/RequestManager.h"
+#include "Network/RequestUtils.h"
+#include "Network/ResponseViews.h"
+#include "Network/SlotClock.h"
+#include "WalletAdapterClient.h"
+
+DECLARE_LOG_CATEGORY_CLASS(LogWalletStateCache, Log, All);
+
+template<typename ValueType>
+struct TCachedValue
+{
+	ValueType Value;
+	double FetchTime = 0.0;
+
+	bool IsFresh(double MaxAge) const { return FPlatformTime::Seconds() - FetchTime <= MaxAge; }
+};
+
+// Only touched from the game thread, like the request manager itself.
+static FWalletPrefetchPolicy PrefetchPolicy;
+static FDelegateHandle AuthorizedHandle;
+
+static TMap<FString, TCachedValue<double>> Balances;
+// Token accounts stay undecoded in their response, which is released when the entry is replaced.
+struct FTokenAccountViews
+{
+	TSharedPtr<FRawResponse> Response;
+	TArrayView<const FTokenBalanceView> Views;
+};
+static TMap<FString, TCachedValue<FTokenAccountViews>> TokenAccounts;
+static TCachedValue<TPair<FString, uint64>> LatestBlockhash;
+static TMap<uint32, uint64> RentExemptions;
+
+FWalletStateCache::FUpdatedDelegate FWalletStateCache::OnUpdated;
+
+static void OnPrefetchFailed(const FText& FailureReason)
+{
+	// Prefetching is opportunistic, the game falls back to regular requests on a cache miss.
+	UE_LOG(LogWalletStateCache, Warning, TEXT("Prefetch failed: %s"), *FailureReason.ToString());
+}
+
+static void OnClientAuthorized(UWalletAdapterClient* Client)
+{
+	check(IsInGameThread());
+
+	if (PrefetchPolicy.Items == EWalletPrefetch::None || Client->PublicKey.IsEmpty())
+		return;
+
+	const TArray<uint8> Encoded = FBase58::EncodeBase58(Client->PublicKey);
+	FWalletStateCache::Prefetch(FString(Encoded.Num(), reinterpret_cast<const ANSICHAR*>(Encoded.GetData())));
+}
+
+void FWalletStateCache::SetPrefetchPolicy(const FWalletPrefetchPolicy& Policy)
+{
+	check(IsInGameThread());
+
+	PrefetchPolicy = Policy;
+
+	if (!AuthorizedHandle.IsValid())
+	{
+		AuthorizedHandle = UWalletAdapterClient::OnAuthorized.AddStatic(&OnClientAuthorized);
+	}
+}
+
+const FWalletPrefetchPolicy& FWalletStateCache::GetPrefetchPolicy()
+{
+	return PrefetchPolicy;
+}
+
+void FWalletStateCache::Prefetch(const FString& PublicKey)
+{
+	check(IsInGameThread());
+
+	const EWalletPrefetch Items = PrefetchPolicy.Items;
+	UE_LOG(LogWalletStateCache, Log, TEXT("Prefetching wallet state for %s"), *PublicKey);
+
+	// Every request is sent before any response is handled, so the reads overlap on the wire.
+
+	if (EnumHasAnyFlags(Items, EWalletPrefetch::Balance))
+	{
+		FRequestData* Request = FRequestUtils::RequestAccountBalance(PublicKey);
+		Request->Callback.BindLambda([PublicKey](FJsonObject& Data)
+		{
+			Balances.Add(PublicKey, { FRequestUtils::ParseAccountBalanceResponse(Data), FPlatformTime::Seconds() });
+			OnUpdated.Broadcast(EWalletPrefetch::Balance);
+		});
+		Request->ErrorCallback.BindStatic(&OnPrefetchFailed);
+		FRequestManager::SendRequest(Request);
+	}
+
+	if (EnumHasAnyFlags(Items, EWalletPrefetch::TokenAccounts))
+	{
+		FRequestData* Request = FRequestUtils::RequestAllTokenAccounts(PublicKey, PrefetchPolicy.TokenProgram);
+		Request->RawCallback.BindLambda([PublicKey](const TSharedRef<FRawResponse>& Response)
+		{
+			const FTokenAccountViews Accounts { Response, FRequestUtils::ParseAllTokenAccountsResponse(*Response) };
+			TokenAccounts.Add(PublicKey, { Accounts, FPlatformTime::Seconds() });
+			OnUpdated.Broadcast(EWalletPrefetch::TokenAccounts);
+		});
+		Request->ErrorCallback.BindStatic(&OnPrefetchFailed);
+		FRequestManager::SendRequest(Request);
+	}
+
+	if (EnumHasAnyFlags(Items, EWalletPrefetch::LatestBlockhash))
+	{
+		FRequestData* Request = FRequestUtils::RequestBlockHash();
+		Request->Callback.BindLambda([](FJsonObject& Data)
+		{
+			LatestBlockhash.Value.Key = FRequestUtils::ParseBlockHashResponse(Data);
+			LatestBlockhash.Value.Value = FRequestUtils::ParseBlockHashResponseLastValidBlockHeight(Data);
+			LatestBlockhash.FetchTime = FPlatformTime::Seconds();
+			OnUpdated.Broadcast(EWalletPrefetch::LatestBlockhash);
+		});
+		Request->ErrorCallback.BindStatic(&OnPrefetchFailed);
+		FRequestManager::SendRequest(Request);
+	}
+
+	if (EnumHasAnyFlags(Items, EWalletPrefetch::RentExemption))
+	{
+		for (uint32 DataSize : PrefetchPolicy.RentExemptionSizes)
+		{
+			// Rent parameters only change with a feature activation, values are kept for the session.
+			if (RentExemptions.Contains(DataSize))
+				continue;
+
+			FRequestData* Request = FRequestUtils::RequestMinimumBalanceForRentExemption(DataSize);
+			Request->Callback.BindLambda([DataSize](FJsonObject& Data)
+			{
+				RentExemptions.Add(DataSize, FRequestUtils::ParseMinimumBalanceForRentExemptionResponse(Data));
+				OnUpdated.Broadcast(EWalletPrefetch::RentExemption);
+			});
+			Request->ErrorCallback.BindStatic(&OnPrefetchFailed);
+			FRequestManager::SendRequest(Request);
+		}
+	}
+}
+
+bool FWalletStateCache::TryGetBalance(const FString& PublicKey, double& OutLamports, double MaxAge)
+{
+	const TCachedValue<double>* Cached = Balances.Find(PublicKey);
+	if (!Cached || !Cached->IsFresh(MaxAge))
+		return false;
+
+	OutLamports = Cached->Value;
+	return true;
+}
+
+bool FWalletStateCache::TryGetTokenAccounts(const FString& PublicKey, FTokenAccountArrayJson& OutAccounts, double MaxAge)
+{
+	const TCachedValue<FTokenAccountViews>* Cached = TokenAccounts.Find(PublicKey);
+	if (!Cached || !Cached->IsFresh(MaxAge))
+		return false;
+
+	OutAccounts.value.Reset(Cached->Value.Views.Num());
+	for (const FTokenBalanceView& View : Cached->Value.Views)
+	{
+		OutAccounts.value.Add(View.Retain());
+	}
+	return true;
+}
+
+bool FWalletStateCache::TryGetTokenAccountViews(const FString& PublicKey, TArrayView<const FTokenBalanceView>& OutViews, TSharedPtr<FRawResponse>& OutResponse, double MaxAge)
+{
+	const TCachedValue<FTokenAccountViews>* Cached = TokenAccounts.Find(PublicKey);
+	if (!Cached || !Cached->IsFresh(MaxAge))
+		return false;
+
+	OutViews = Cached->Value.Views;
+	OutResponse = Cached->Value.Response;
+	return true;
+}
+
+bool FWalletStateCache::TryGetLatestBlockhash(FString& OutBlockhash, uint64& OutLastValidBlockHeight, double MaxAge)
+{
+	const auto& [Blockhash, LastValidBlockHeight] = LatestBlockhash.Value;
+	if (Blockhash.IsEmpty() || !LatestBlockhash.IsFresh(MaxAge) || FSlotClock::IsBlockhashExpired(LastValidBlockHeight))
+		return false;
+
+	OutBlockhash = Blockhash;
+	OutLastValidBlockHeight = LastValidBlockHeight;
+	return true;
+}
+
+bool FWalletStateCache::TryGetRentExemption(uint32 DataSize, uint64& OutLamports)
+{
+	const uint64* Cached = RentExemptions.Find(DataSize);
+	if (!Cached)
+		return false;
+
+	OutLamports = *Cached;
+	return true;
+}
+
+void FWalletStateCache::Invalidate()
+{
+	Balances.Empty();
+	TokenAccounts.Empty();
+	LatestBlockhash = {};
+}
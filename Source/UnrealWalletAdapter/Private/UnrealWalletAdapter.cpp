@@ -4,6 +4,18 @@
 //
 
 #include "UnrealWalletAdapter.h"
-#include "Modules/ModuleManager.h"
+#include "Crypto/CryptoDispatch.h"
+#include "Network/RequestManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, UnrealWalletAdapter, "UnrealWalletAdapter" );
\ No newline at end of file
+void FUnrealWalletAdapterModule::StartupModule()
+{
+	FCryptoDispatch::Initialize();
+	FRequestManager::Initialize();
+}
+
+void FUnrealWalletAdapterModule::ShutdownModule()
+{
+	FRequestManager::Shutdown();
+}
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FUnrealWalletAdapterModule, UnrealWalletAdapter, "UnrealWalletAdapter" );
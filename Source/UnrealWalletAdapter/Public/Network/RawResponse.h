@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+/**
+ * Linear allocator for data decoded out of a single response.
+ *
+ * Allocations are bump-pointer sub-ranges of a few large blocks and are never freed one by one,
+ * everything goes away together with the arena. Destructors of allocated objects are never run.
+ */
+class UNREALWALLETADAPTER_API FResponseArena : public FNoncopyable
+{
+public:
+	explicit FResponseArena(SIZE_T InBlockSize = 16 * 1024);
+	~FResponseArena();
+
+	void* Allocate(SIZE_T Size, SIZE_T Alignment);
+
+	template<typename ElementType>
+	TArrayView<ElementType> AllocateArray(int32 Num)
+	{
+		static_assert(std::is_trivially_destructible_v<ElementType>, "The arena never runs destructors.");
+
+		ElementType* Data = static_cast<ElementType*>(Allocate(Num * sizeof(ElementType), alignof(ElementType)));
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			new (Data + Index) ElementType();
+		}
+		return TArrayView<ElementType>(Data, Num);
+	}
+
+	/** Total size of the blocks held by the arena. */
+	SIZE_T GetAllocatedSize() const { return AllocatedSize; }
+
+private:
+	struct FBlock
+	{
+		FBlock* Next;
+	};
+
+	FBlock* Blocks = nullptr;
+	uint8* Cursor = nullptr;
+	uint8* Limit = nullptr;
+	SIZE_T BlockSize;
+	SIZE_T AllocatedSize = 0;
+};
+
+/**
+ * RPC response handed over undecoded, for requests that bind FRequestData::RawCallback.
+ *
+ * Decoders such as FRequestUtils::ParseAllTokenAccountsResponse return views into Body, or into Arena
+ * for the few strings that had to be unescaped. The views stay valid as long as the response is
+ * referenced, releasing the last reference frees the body and everything decoded from it at once.
+ */
+struct UNREALWALLETADAPTER_API FRawResponse : public FNoncopyable
+{
+	FRawResponse(FHttpResponsePtr InResponse, TArray<UTF8CHAR>&& InInflated);
+
+	/** Whole UTF-8 body, inflated if it was sent compressed. */
+	FUtf8StringView Body;
+	/** The "result" member of the response. */
+	FUtf8StringView Result;
+	/** The "error" message of the response, if bIsError is set. */
+	FUtf8StringView ErrorMessage;
+	bool bIsError = false;
+	/** "context.slot" of the result, 0 if the method doesn't report one. */
+	uint64 ContextSlot = 0;
+
+	FResponseArena Arena;
+
+private:
+	FHttpResponsePtr Response;
+	TArray<UTF8CHAR> Inflated;
+};
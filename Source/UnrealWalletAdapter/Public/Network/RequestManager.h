@@ -23,7 +23,10 @@ Contributers: Daniele Calanna, Riccardo Torrisi
 
 #include "Interfaces/IHttpRequest.h"
 
+struct FRawResponse;
+
 DECLARE_DELEGATE_OneParam( FRequestCallback, FJsonObject&);
+DECLARE_DELEGATE_OneParam( FRequestRawCallback, const TSharedRef<FRawResponse>&);
 DECLARE_DELEGATE_OneParam( FRequestErrorCallback, const FText& FailureReason);
 
 typedef TFunctionRef<void(FJsonObject&)> RequestCB;
@@ -36,12 +39,18 @@ struct UNREALWALLETADAPTER_API FRequestData
 	uint32 Id;
 	FString Body;
 	FRequestCallback Callback;
+	/** When bound, the response is handed over undecoded instead of through Callback. */
+	FRequestRawCallback RawCallback;
 	FRequestErrorCallback ErrorCallback;
 };
 
 class UNREALWALLETADAPTER_API FRequestManager
 {
 public:
+	/** Reads the RPC settings and starts keeping a warm connection to the cluster. */
+	static void Initialize();
+	static void Shutdown();
+	
 	static int64 GetNextMessageID();
 	static int64 GetLastMessageID();
 
@@ -49,5 +58,5 @@ public:
 	static void CancelRequest(FRequestData* RequestData);
 
 private:
-	static void OnResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
+	static void OnResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, uint32 RequestId);
 };
@@ -23,7 +23,11 @@ struct FRequestData;
 struct FAccountInfoJson;
 struct FBalanceResultJson;
 struct FTokenAccountArrayJson;
+struct FTokenBalanceView;
+struct FRawResponse;
 struct FProgramAccountJson;
+struct FAccountInfoView;
+struct FProgramAccountView;
 
 class FRequestUtils
 {
@@ -31,6 +35,8 @@ public:
 	
 	static FRequestData* RequestAccountInfo(const FString& PublicKey);
 	static FAccountInfoJson ParseAccountInfoResponse(const FJsonObject& Data);
+	/** False if the account doesn't exist. */
+	static bool ParseAccountInfoResponse(FRawResponse& Response, FAccountInfoView& OutAccount);
 
 	static FRequestData* RequestAccountBalance(const FString& PublicKey);
 	static double ParseAccountBalanceResponse(const FJsonObject& Data);
@@ -40,16 +46,23 @@ public:
 
 	static FRequestData* RequestAllTokenAccounts(const FString& PublicKey, const FString& ProgramID);
 	static FTokenAccountArrayJson ParseAllTokenAccountsResponse(const FJsonObject& data);
+	/** Decodes the accounts into the arena of the response, without a heap allocation per field. */
+	static TArrayView<const FTokenBalanceView> ParseAllTokenAccountsResponse(FRawResponse& Response);
 
 	static FRequestData* RequestProgramAccounts(const FString& ProgramID, const uint32& Size, const FString& PublicKey);
 	static TArray<FProgramAccountJson> ParseProgramAccountsResponse(const FJsonObject& Data);
+	static TArrayView<const FProgramAccountView> ParseProgramAccountsResponse(FRawResponse& Response);
 
 	static FRequestData* RequestMultipleAccounts(const TArray<FString>& PublicKey);
 	static TArray<FAccountInfoJson> ParseMultipleAccountsResponse(const FJsonObject& Data);
+	/** One view per requested key, in request order, accounts that don't exist are left empty. */
+	static TArrayView<const FAccountInfoView> ParseMultipleAccountsResponse(FRawResponse& Response);
 	
 	static FRequestData* RequestBlockHash();
 	static FString ParseBlockHashResponse(const FJsonObject& Data);
 	static int32 ParseBlockHashResponseContextSlot(const FJsonObject& Data);
+	/** 0 if the response carries no last valid block height. */
+	static uint64 ParseBlockHashResponseLastValidBlockHeight(const FJsonObject& Data);
 
 	static FRequestData* GetTransactionFeeAmount(const FString& Transaction);
 	static int ParseTransactionFeeAmountResponse(const FJsonObject& Data);
@@ -57,8 +70,13 @@ public:
 	static FRequestData* SendTransaction(const FString& Transaction);
 	static FString ParseTransactionResponse(const FJsonObject& Data);
 	
+	static FRequestData* RequestMinimumBalanceForRentExemption(uint32 DataSize);
+	static uint64 ParseMinimumBalanceForRentExemptionResponse(const FJsonObject& Data);
+	
 	static FRequestData* RequestAirDrop(const FString& PublicKey);
 
+	static FRequestData* RequestHealth();
+
 	static void DisplayError(const FString& Error);
 	static void DisplayInfo(const FString& Info);
 };
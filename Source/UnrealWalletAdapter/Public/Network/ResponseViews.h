@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SolanaUtils/Utils/Types.h"
+
+/*
+ * Views decoded out of an FRawResponse. Strings point into the response and are only valid while it is
+ * referenced, Retain copies a view into the owned structs used by the rest of the game.
+ */
+
+struct UNREALWALLETADAPTER_API FTokenUIBalanceView
+{
+	FUtf8StringView Amount;
+	uint8 Decimals = 0;
+	double UiAmount = 0.0;
+	FUtf8StringView UiAmountString;
+
+	FTokenUIBalanceJson Retain() const;
+};
+
+/** One entry of a jsonParsed getTokenAccountsByOwner result. */
+struct UNREALWALLETADAPTER_API FTokenBalanceView
+{
+	FUtf8StringView Pubkey;
+
+	FUtf8StringView Program;
+	FUtf8StringView AccountType;
+	double Space = 0.0;
+
+	FUtf8StringView Mint;
+	FUtf8StringView Owner;
+	FUtf8StringView State;
+	FUtf8StringView Delegate;
+	bool bIsNative = false;
+	FTokenUIBalanceView TokenAmount;
+	FTokenUIBalanceView DelegatedAmount;
+
+	/** Program owning the token account. */
+	FUtf8StringView AccountOwner;
+	uint64 Lamports = 0;
+	bool bExecutable = false;
+	double RentEpoch = 0.0;
+
+	FTokenBalanceDataJson Retain() const;
+};
+
+/** Account as returned by getAccountInfo and getMultipleAccounts, Data is left in its wire encoding. */
+struct UNREALWALLETADAPTER_API FAccountInfoView
+{
+	FUtf8StringView Data;
+	/** Second member of a [data, encoding] pair, empty for legacy base58 strings. */
+	FUtf8StringView Encoding;
+	bool bExecutable = false;
+	uint64 Lamports = 0;
+	FUtf8StringView Owner;
+	double RentEpoch = 0.0;
+
+	FAccountInfoJson Retain() const;
+};
+
+/** One entry of a getProgramAccounts result. */
+struct UNREALWALLETADAPTER_API FProgramAccountView
+{
+	FUtf8StringView Pubkey;
+	FAccountInfoView Account;
+
+	FProgramAccountJson Retain() const;
+};
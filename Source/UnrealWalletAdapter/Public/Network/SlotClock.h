@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * Local estimate of the cluster slot and block height.
+ *
+ * The clock is synced from the context slot of RPC responses (see FRequestManager) and can also be fed
+ * from slot subscription notifications through SyncSlot. Between syncs it extrapolates from the local
+ * monotonic clock using a slot duration that starts at 400ms and is corrected from the observed slot rate,
+ * so queries are O(1) and never touch the network.
+ */
+class UNREALWALLETADAPTER_API FSlotClock
+{
+public:
+	/** Feeds a slot observed from the cluster (response context or slot notification). */
+	static void SyncSlot(uint64 Slot);
+	/** Feeds a block height that was current at the given slot. */
+	static void SyncBlockHeight(uint64 Slot, uint64 BlockHeight);
+	/** Feeds the context slot and, for blockhash responses, the block height of an RPC response. */
+	static void SyncFromResponse(const FJsonObject& Data);
+
+	/** Returns true once at least one slot has been observed. */
+	static bool IsSynced();
+	/** Returns true once a block height has been observed. */
+	static bool IsBlockHeightSynced();
+
+	/** Returns the estimated current slot, or 0 if the clock has not been synced. */
+	static uint64 GetCurrentSlot();
+	/**
+	 * Returns the estimated current block height, or 0 if no block height has been observed. Extrapolated from the
+	 * latest block height one block per slot, so it runs ahead by the slots skipped since that sample.
+	 */
+	static uint64 GetCurrentBlockHeight();
+	/** Returns the highest slot actually observed from the cluster. Suitable as a MinContextSlot hint. */
+	static uint64 GetLastObservedSlot();
+	/** Returns the current slot duration estimate in seconds. */
+	static double GetSlotDuration();
+
+	/** Returns true if a blockhash with the given last valid block height can no longer land. */
+	static bool IsBlockhashExpired(uint64 LastValidBlockHeight);
+
+	static void Reset();
+};
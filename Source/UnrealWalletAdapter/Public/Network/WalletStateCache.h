@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2023 Solana Mobile Inc.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SolanaUtils/Utils/Types.h"
+
+struct FRawResponse;
+struct FTokenBalanceView;
+
+/** Reads that can be prefetched when a wallet client is authorized. */
+enum class EWalletPrefetch : uint8
+{
+	None			= 0,
+	Balance			= 1 << 0,
+	TokenAccounts	= 1 << 1,
+	LatestBlockhash	= 1 << 2,
+	RentExemption	= 1 << 3,
+	All				= Balance | TokenAccounts | LatestBlockhash | RentExemption
+};
+ENUM_CLASS_FLAGS(EWalletPrefetch);
+
+struct FWalletPrefetchPolicy
+{
+	/** Reads fired after Authorize or Reauthorize succeeds. None disables prefetching. */
+	EWalletPrefetch Items = EWalletPrefetch::None;
+	/** Account data sizes whose rent exemption minimum is fetched. */
+	TArray<uint32> RentExemptionSizes = { 0, AccountDataSize };
+	/** Token program whose accounts are fetched. */
+	FString TokenProgram = TokenProgramId;
+};
+
+/**
+ * In-memory copy of the wallet state read right after authorization.
+ *
+ * With a prefetch policy set, every successful UWalletAdapterClient authorization fires the configured
+ * reads concurrently and stores the results here, so the first screen after connecting can render from
+ * memory instead of waiting on sequential round trips.
+ */
+class UNREALWALLETADAPTER_API FWalletStateCache
+{
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FUpdatedDelegate, EWalletPrefetch Item);
+
+	static void SetPrefetchPolicy(const FWalletPrefetchPolicy& Policy);
+	static const FWalletPrefetchPolicy& GetPrefetchPolicy();
+
+	/** Fires the reads of the current policy concurrently for a base58 encoded account. */
+	static void Prefetch(const FString& PublicKey);
+
+	static bool TryGetBalance(const FString& PublicKey, double& OutLamports, double MaxAge = 30.0);
+	static bool TryGetTokenAccounts(const FString& PublicKey, FTokenAccountArrayJson& OutAccounts, double MaxAge = 30.0);
+	/** Returns the cached accounts without copying them, the views are valid while OutResponse is held. */
+	static bool TryGetTokenAccountViews(const FString& PublicKey, TArrayView<const FTokenBalanceView>& OutViews, TSharedPtr<FRawResponse>& OutResponse, double MaxAge = 30.0);
+	/** Returns the cached blockhash if the slot clock doesn't consider it expired yet. */
+	static bool TryGetLatestBlockhash(FString& OutBlockhash, uint64& OutLastValidBlockHeight, double MaxAge = 30.0);
+	static bool TryGetRentExemption(uint32 DataSize, uint64& OutLamports);
+
+	static void Invalidate();
+
+	/** Broadcast on the game thread whenever a prefetched read lands in the cache. */
+	static FUpdatedDelegate OnUpdated;
+};
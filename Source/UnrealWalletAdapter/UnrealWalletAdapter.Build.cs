@@ -42,5 +42,7 @@ public class UnrealWalletAdapter : ModuleRules
 			"JsonUtilities",
 			"HTTP"
 		});
+
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
 	}
 }